@@ -21,11 +21,16 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 24/02/2024 | Document creation		                         						|
+ * | 17/10/2026 | DMA-backed continuous mode                     						|
+ * | 17/10/2026 | Multi-channel scan mode                        						|
+ * | 17/10/2026 | Calibrated reads in mV through lookup table    						|
+ * | 17/10/2026 | Scan reads keep channels aligned across blocks 						|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include "stdint.h"
+#include "stdbool.h"
 /*==================[macros]=================================================*/
 typedef enum adc_ch {
 	CH0 = 0,				/*!< Channel 0 */
@@ -40,6 +45,9 @@ typedef enum adc_mode {
 } adc_mode_t;
 
 #define DAC	0    			/*!< DAC pin. Override CH0 declaration*/
+
+#define ANALOG_BLOCK_SIZE	256	/*!< Samples per channel delivered on each continuous read (one DMA frame) */
+#define ANALOG_MAX_INPUTS	4	/*!< Maximum number of channels in a scan */
 /*==================[typedef]================================================*/
 /**
  * @brief Analog inputs config structure
@@ -48,17 +56,34 @@ typedef enum adc_mode {
 typedef struct {			
 	adc_ch_t input;			/*!< Inputs: CH0, CH1, CH2, CH3 */
 	adc_mode_t mode;		/*!< Mode: single read or continuous read */
-	void *func_p;			/*!< Pointer to callback function for convertion end (only for continuous mode) */
+	void *func_p;			/*!< Pointer to callback function for block convertion end, called from ISR (only for continuous mode) */
 	void *param_p;			/*!< Pointer to callback function parameters (only for continuous mode) */
-	uint16_t sample_frec;	/*!< Sample frequency min: 20kHz - max: 2MHz (only for continuous mode)  */
+	uint16_t sample_frec;	/*!< Sample frequency min: 611Hz - max: 65kHz (only for continuous mode)  */
 } analog_input_config_t;	
 
+/**
+ * @brief Analog inputs scan config structure
+ * 
+ */
+typedef struct {
+	adc_ch_t inputs[ANALOG_MAX_INPUTS];	/*!< Inputs sampled in each scan, in order: CH0, CH1, CH2, CH3 */
+	uint8_t n_inputs;		/*!< Number of inputs in the scan (1 to ANALOG_MAX_INPUTS) */
+	void *func_p;			/*!< Pointer to callback function for block convertion end, called from ISR */
+	void *param_p;			/*!< Pointer to callback function parameters */
+	uint16_t sample_frec;	/*!< Sample frequency of each input (n_inputs * sample_frec must be between 611Hz and 83kHz) */
+} analog_scan_config_t;
+
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
 /**
  * @brief Analog input initialization
  * 
+ * @note In continuous mode the ADC is sampled by DMA into two frames of ANALOG_BLOCK_SIZE
+ * samples (ping-pong). The callback func_p is invoked from ISR context once per filled 
+ * frame, and the block must then be fetched with AnalogInputReadContinuous(). Only one 
+ * channel can be configured in continuous mode, and it can't be read in single mode too.
+ * 
  * @param config Analog inputs config structure
  * @return null
  */
@@ -75,15 +100,39 @@ void AnalogOutputInit(void);
  * @brief Read single channel.
  * 
  * @param channel Channel selected
- * @param value Read variable pointer (in mV)
+ * @param value Read variable pointer (raw ADC code, from 0 to 4095)
  * @return null
  */
 void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value);
 
 /**
- * @brief Start convertion for ADC module in continuous mode
+ * @brief Read single channel, calibrated.
  * 
  * @param channel Channel selected
+ * @param value Read variable pointer (in mV, 0 if the channel was not initialized)
+ * @return null
+ */
+void AnalogInputReadSingleMv(adc_ch_t channel, uint16_t *value);
+
+/**
+ * @brief Convert a block of raw ADC codes to mV.
+ * 
+ * @note Uses a table built from the channel's calibration curve at AnalogInputInit() (or 
+ * AnalogInputScanInit()), so the cost is one lookup per sample. raw and mv may be the same array.
+ * If the table could not be allocated the calibration curve is evaluated for each sample, and 
+ * samples of a channel that was never initialized are converted to 0.
+ * 
+ * @param channel Channel the samples were read from
+ * @param raw Array of raw ADC codes
+ * @param mv Array to store values (in mV)
+ * @param lenght Number of samples of both arrays
+ */
+void AnalogRawToMv(adc_ch_t channel, uint16_t *raw, uint16_t *mv, uint16_t lenght);
+
+/**
+ * @brief Start convertion for ADC module in continuous mode
+ * 
+ * @param channel Channel selected (previously configured in continuous mode)
  */
 void AnalogStartContinuous(adc_ch_t channel);
 
@@ -95,12 +144,42 @@ void AnalogStartContinuous(adc_ch_t channel);
 void AnalogStopContinuous(adc_ch_t channel);
 
 /**
- * @brief 
+ * @brief Read the oldest completed block of the continuous convertion.
+ * 
+ * @note Must not be called from the func_p callback (ISR context), notify a task instead.
  * 
  * @param channel Channel selected.
- * @param values Read variable array
+ * @param values Read variable array (of lenght = ANALOG_BLOCK_SIZE), in raw ADC codes
+ * @return Number of samples stored in values (0 if no block is ready)
+ */
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+
+/**
+ * @brief Multi-channel continuous initialization (scan mode)
+ * 
+ * @note All inputs are converted in one hardware pattern by DMA, so samples of the same 
+ * index in each block are time-aligned. Overrides any previous continuous configuration.
+ * Use AnalogStartContinuous() and AnalogStopContinuous() to control the convertion.
+ * 
+ * @param config Analog inputs scan config structure
+ * @return true if the scan was configured, false if n_inputs is out of range, an input is 
+ * repeated or the driver could not be configured
+ */
+bool AnalogInputScanInit(analog_scan_config_t *config);
+
+/**
+ * @brief Read the oldest completed scan block, deinterleaved per channel.
+ * 
+ * @note Must not be called from the func_p callback (ISR context), notify a task instead.
+ * Only whole pattern cycles are delivered: if a block ends in the middle of the pattern, the 
+ * extra samples of the first channels are kept and delivered first on the next read, so 
+ * samples of the same index are always from the same scan.
+ * 
+ * @param values Array of n_inputs pointers (in the order of config inputs), each to an 
+ * array of lenght = ANALOG_BLOCK_SIZE, to store raw ADC codes
+ * @return Number of samples stored in each channel array (0 if no block is ready)
  */
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values);
+uint16_t AnalogInputReadScan(uint16_t *values[]);
 
 /**
  * @brief Digital-to-Analog convert.
@@ -10,6 +10,8 @@
  */
 
 /*==================[inclusions]=============================================*/
+#include <string.h>
+#include <stdlib.h>
 #include "analog_io_mcu.h"
 #include "driver/gptimer.h"
 #include "driver/sdm.h"
@@ -19,15 +21,34 @@
 /*==================[macros and definitions]=================================*/
 #define ADC_BITWIDTH 		SOC_ADC_DIGI_MAX_BITWIDTH	// 12 bit resolution
 #define ADC_ATTENUATION		ADC_ATTEN_DB_12				// 12dB attenuation (for 0-3,3V ADC range)
+#define ADC_CONT_FRAME_SIZE	(ANALOG_BLOCK_SIZE * SOC_ADC_DIGI_RESULT_BYTES)	// DMA frame size per channel (in bytes)
+#define ADC_SCAN_NO_SLOT	0xFF						// Channel not included in the scan pattern
+#define ADC_SCAN_SLOTS		8							// Channel field of conversion results is 3 bits wide
+#define ADC_CALI_LUT_SIZE	(1 << ADC_BITWIDTH)			// One entry per raw ADC code
+#define ADC_SCAN_CARRY		4							// Samples per channel kept for the next scan read
 /*==================[internal data declaration]==============================*/
-adc_cali_handle_t adc_calibration_single_0, adc_calibration_single_1, adc_calibration_single_2, adc_calibration_single_3;
 adc_oneshot_unit_handle_t adc1_single; 
-adc_continuous_handle_t adc2_cont;
+adc_continuous_handle_t adc2_cont = NULL;
 sdm_channel_handle_t dac = NULL;
 bool adc1_single_used = false;
+void (*adc_cont_isr_p)(void*) = NULL;	/*!< Pointer to the callback function for block convertion end */
+void *adc_cont_user_data;				/*!< User data for continuous mode callback */
+static uint8_t adc_cont_frame[ANALOG_MAX_INPUTS * ADC_CONT_FRAME_SIZE];	/*!< Raw DMA frame read from the driver */
+static uint32_t adc_cont_frame_size = 0;			/*!< Current DMA frame size (in bytes) */
+static uint8_t adc_scan_slot[ADC_SCAN_SLOTS];	/*!< Output array index for each ADC channel in the scan */
+static uint16_t adc_scan_carry[ANALOG_MAX_INPUTS][ADC_SCAN_CARRY];	/*!< Samples of incomplete pattern cycles, delivered on the next scan read */
+static uint8_t adc_scan_n_carry[ANALOG_MAX_INPUTS] = {0};	/*!< Samples in adc_scan_carry for each slot */
+static uint16_t *adc_cali_lut[ANALOG_MAX_INPUTS] = {NULL};	/*!< Raw code to mV tables, built once per channel */
+static adc_cali_handle_t adc_cali[ANALOG_MAX_INPUTS] = {NULL};	/*!< Calibration schemes kept when a table could not be allocated */
 /*==================[internal functions declaration]=========================*/
-
+static bool IRAM_ATTR adc_cont_isr(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data){
+	if(adc_cont_isr_p != NULL){
+		adc_cont_isr_p(adc_cont_user_data);
+	}
+	return true;
+}
 /*==================[internal data definition]===============================*/
+const adc_channel_t adc_channel_map[] = {ADC_CHANNEL_0, ADC_CHANNEL_1, ADC_CHANNEL_2, ADC_CHANNEL_3};
 adc_oneshot_unit_init_cfg_t init_config_single = {
 	.unit_id = ADC_UNIT_1,
 	.ulp_mode = ADC_ULP_MODE_DISABLE,
@@ -39,6 +60,123 @@ adc_oneshot_chan_cfg_t adc_config_single = {
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Build the raw to mV lookup table of a channel from its calibration scheme
+ * 
+ * @note Evaluating the calibration curve is expensive, so it is done once for every 
+ * possible raw code here and calibrated reads are reduced to a table lookup. If the table 
+ * can't be allocated, the calibration scheme is kept and evaluated on every read.
+ * 
+ * @param channel Channel selected
+ */
+static void adc_cali_lut_init(adc_ch_t channel){
+	adc_cali_handle_t cali_handle;
+	int voltage;
+	if(adc_cali_lut[channel] != NULL || adc_cali[channel] != NULL){
+		return;
+	}
+	adc_cali_curve_fitting_config_t cali_config = {
+		.unit_id = ADC_UNIT_1,
+		.chan = adc_channel_map[channel], 
+		.atten = ADC_ATTENUATION,
+		.bitwidth = ADC_BITWIDTH,
+	};
+	if(adc_cali_create_scheme_curve_fitting(&cali_config, &cali_handle) != ESP_OK){
+		return;
+	}
+	adc_cali_lut[channel] = malloc(ADC_CALI_LUT_SIZE * sizeof(uint16_t));
+	if(adc_cali_lut[channel] == NULL){
+		adc_cali[channel] = cali_handle;
+		return;
+	}
+	for(int raw=0; raw<ADC_CALI_LUT_SIZE; raw++){
+		adc_cali_raw_to_voltage(cali_handle, raw, &voltage);
+		adc_cali_lut[channel][raw] = voltage;
+	}
+	adc_cali_delete_scheme_curve_fitting(cali_handle);
+}
+
+/**
+ * @brief Convert a raw ADC code of a channel to mV
+ * 
+ * @param channel Channel the code was read from
+ * @param raw Raw ADC code
+ * @return Calibrated value (in mV), 0 if the channel has no calibration
+ */
+static uint16_t adc_cali_raw_to_mv(adc_ch_t channel, uint16_t raw){
+	int voltage = 0;
+	if(adc_cali_lut[channel] != NULL){
+		return adc_cali_lut[channel][raw & (ADC_CALI_LUT_SIZE - 1)];
+	}
+	if(adc_cali[channel] != NULL){
+		adc_cali_raw_to_voltage(adc_cali[channel], raw, &voltage);
+	}
+	return voltage;
+}
+
+/**
+ * @brief (Re)create the continuous driver handle for a given conversion pattern
+ * 
+ * @param pattern 		Array of channel patterns (one entry per channel)
+ * @param pattern_num 	Number of channels in the pattern
+ * @param sample_frec 	Sample frequency of each channel (in Hz)
+ * @return true if the driver was configured, false on a driver error
+ */
+static bool adc_cont_setup(adc_digi_pattern_config_t *pattern, uint8_t pattern_num, uint32_t sample_frec){
+	// frame size depends on the number of channels, so the handle is rebuilt on every init
+	if(adc2_cont != NULL){
+		// a running driver can't be deinitialized (ESP_ERR_INVALID_STATE only means already stopped)
+		adc_continuous_stop(adc2_cont);
+		if(adc_continuous_deinit(adc2_cont) != ESP_OK){
+			return false;
+		}
+		adc2_cont = NULL;
+	}
+	adc_cont_frame_size = pattern_num * ADC_CONT_FRAME_SIZE;
+	adc_continuous_handle_cfg_t handle_config = {
+		.max_store_buf_size = 2 * adc_cont_frame_size,	// ping-pong: one frame being filled by DMA, one ready to read
+		.conv_frame_size = adc_cont_frame_size,
+	};
+	if(adc_continuous_new_handle(&handle_config, &adc2_cont) != ESP_OK){
+		adc2_cont = NULL;
+		return false;
+	}
+	adc_continuous_evt_cbs_t cont_callbacks = {
+		.on_conv_done = adc_cont_isr,
+	};
+	if(adc_continuous_register_event_callbacks(adc2_cont, &cont_callbacks, NULL) != ESP_OK){
+		return false;
+	}
+	// hardware sample frequency is shared among all channels in the pattern
+	sample_frec *= pattern_num;
+	if(sample_frec < SOC_ADC_SAMPLE_FREQ_THRES_LOW){
+		sample_frec = SOC_ADC_SAMPLE_FREQ_THRES_LOW;
+	}
+	if(sample_frec > SOC_ADC_SAMPLE_FREQ_THRES_HIGH){
+		sample_frec = SOC_ADC_SAMPLE_FREQ_THRES_HIGH;
+	}
+	adc_continuous_config_t cont_config = {
+		.pattern_num = pattern_num,
+		.adc_pattern = pattern,
+		.sample_freq_hz = sample_frec,
+		.conv_mode = ADC_CONV_SINGLE_UNIT_1,
+		.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+	};
+	return adc_continuous_config(adc2_cont, &cont_config) == ESP_OK;
+}
+
+/**
+ * @brief Read one DMA frame from the continuous driver without blocking
+ * 
+ * @return Number of conversion results stored in adc_cont_frame
+ */
+static uint32_t adc_cont_read_frame(void){
+	uint32_t read_bytes = 0;
+	if(adc_continuous_read(adc2_cont, adc_cont_frame, adc_cont_frame_size, &read_bytes, 0) != ESP_OK){
+		return 0;
+	}
+	return read_bytes / SOC_ADC_DIGI_RESULT_BYTES;
+}
 
 /*==================[external functions definition]==========================*/
 
@@ -54,65 +192,30 @@ void AnalogInputInit(analog_input_config_t *config){
 			switch(config->input){
 				case CH0:
     				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_0, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_0 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_0, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_0, &adc_calibration_single_0));
 				break;
 				case CH1:
     				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_1, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_1 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_1, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_1, &adc_calibration_single_1));
 				break;
 				case CH2:
     				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_2, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_2 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_2, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_2, &adc_calibration_single_2));
 				break;
 				case CH3:
     				adc_oneshot_config_channel(adc1_single, ADC_CHANNEL_3, &adc_config_single);
-					// create calibration curve
-					adc_cali_curve_fitting_config_t cali_config_3 = {
-						.unit_id = ADC_UNIT_1,
-						.chan = ADC_CHANNEL_3, 
-						.atten = ADC_ATTENUATION,
-						.bitwidth = ADC_BITWIDTH,
-					};
-					ESP_ERROR_CHECK(adc_cali_create_scheme_curve_fitting(&cali_config_3, &adc_calibration_single_3));
 				break;
 			}
+			adc_cali_lut_init(config->input);
 		break;
 		case ADC_CONTINUOUS:
-			switch(config->input){
-				case CH0:
-
-				break;
-				case CH1:
-
-				break;
-				case CH2:
-
-				break;
-				case CH3:
-
-				break;
-			}
+			adc_cont_isr_p = config->func_p;
+			adc_cont_user_data = config->param_p;
+			adc_digi_pattern_config_t cont_pattern = {
+				.atten = ADC_ATTENUATION,
+				.channel = adc_channel_map[config->input],
+				.unit = ADC_UNIT_1,
+				.bit_width = ADC_BITWIDTH,
+			};
+			adc_cont_setup(&cont_pattern, 1, config->sample_frec);
+			adc_cali_lut_init(config->input);
 		break;
 	}
 }
@@ -128,32 +231,136 @@ void AnalogOutputInit(void){
 }
 
 void AnalogInputReadSingle(adc_ch_t channel, uint16_t *value){
+	int raw = 0;
     switch(channel){
 		case CH0:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_0, (int*)value);
+			adc_oneshot_read(adc1_single, ADC_CHANNEL_0, &raw);
 		break;
 		case CH1:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_1, (int*)value);
+			adc_oneshot_read(adc1_single, ADC_CHANNEL_1, &raw);
 		break;
 		case CH2:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_2, (int*)value);
+			adc_oneshot_read(adc1_single, ADC_CHANNEL_2, &raw);
 		break;
 		case CH3:
-			adc_oneshot_read(adc1_single, ADC_CHANNEL_3, (int*)value);
+			adc_oneshot_read(adc1_single, ADC_CHANNEL_3, &raw);
 		break;
 	}
+	*value = raw;
 }
 
-void AnalogStartContinuous(adc_ch_t channel){
+void AnalogInputReadSingleMv(adc_ch_t channel, uint16_t *value){
+	uint16_t raw;
+	AnalogInputReadSingle(channel, &raw);
+	*value = adc_cali_raw_to_mv(channel, raw);
+}
 
+void AnalogRawToMv(adc_ch_t channel, uint16_t *raw, uint16_t *mv, uint16_t lenght){
+	const uint16_t *lut = adc_cali_lut[channel];
+	if(lut == NULL){
+		// table not allocated or channel never initialized
+		for(uint16_t i=0; i<lenght; i++){
+			mv[i] = adc_cali_raw_to_mv(channel, raw[i]);
+		}
+		return;
+	}
+	for(uint16_t i=0; i<lenght; i++){
+		mv[i] = lut[raw[i] & (ADC_CALI_LUT_SIZE - 1)];
+	}
+}
+
+void AnalogStartContinuous(adc_ch_t channel){
+	adc_continuous_start(adc2_cont);
 }
 
 void AnalogStopContinuous(adc_ch_t channel){
+	adc_continuous_stop(adc2_cont);
+}
 
+uint16_t AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+	uint16_t n_samples = 0;
+	uint32_t n_results = adc_cont_read_frame();
+	adc_digi_output_data_t *data = (adc_digi_output_data_t *)adc_cont_frame;
+	for(uint32_t i=0; i<n_results; i++){
+		if(data[i].type2.channel == adc_channel_map[channel]){
+			values[n_samples++] = data[i].type2.data;
+		}
+	}
+	return n_samples;
 }
 
-void AnalogInputReadContinuous(adc_ch_t channel, uint16_t *values){
+bool AnalogInputScanInit(analog_scan_config_t *config){
+	adc_digi_pattern_config_t scan_pattern[ANALOG_MAX_INPUTS];
+	if(config->n_inputs == 0 || config->n_inputs > ANALOG_MAX_INPUTS){
+		return false;
+	}
+	memset(adc_scan_slot, ADC_SCAN_NO_SLOT, sizeof(adc_scan_slot));
+	memset(adc_scan_n_carry, 0, sizeof(adc_scan_n_carry));
+	for(uint8_t i=0; i<config->n_inputs; i++){
+		// each channel has one output slot, a repeated channel would leave a slot never filled
+		if(config->inputs[i] > CH3 || adc_scan_slot[adc_channel_map[config->inputs[i]]] != ADC_SCAN_NO_SLOT){
+			return false;
+		}
+		adc_scan_slot[adc_channel_map[config->inputs[i]]] = i;
+	}
+	adc_cont_isr_p = config->func_p;
+	adc_cont_user_data = config->param_p;
+	for(uint8_t i=0; i<config->n_inputs; i++){
+		scan_pattern[i].atten = ADC_ATTENUATION;
+		scan_pattern[i].channel = adc_channel_map[config->inputs[i]];
+		scan_pattern[i].unit = ADC_UNIT_1;
+		scan_pattern[i].bit_width = ADC_BITWIDTH;
+		adc_cali_lut_init(config->inputs[i]);
+	}
+	return adc_cont_setup(scan_pattern, config->n_inputs, config->sample_frec);
+}
 
+uint16_t AnalogInputReadScan(uint16_t *values[]){
+	uint16_t n_samples[ANALOG_MAX_INPUTS];
+	uint16_t n_min = ANALOG_BLOCK_SIZE;
+	uint16_t overflow[ANALOG_MAX_INPUTS][ADC_SCAN_CARRY];
+	uint8_t n_overflow[ANALOG_MAX_INPUTS] = {0};
+	uint8_t n_inputs = adc_cont_frame_size / ADC_CONT_FRAME_SIZE;
+	uint32_t n_results = adc_cont_read_frame();
+	adc_digi_output_data_t *data = (adc_digi_output_data_t *)adc_cont_frame;
+	if(n_results == 0){
+		return 0;
+	}
+	// samples left over by the previous read go first, so index k is the same scan in every channel
+	for(uint8_t i=0; i<n_inputs; i++){
+		memcpy(values[i], adc_scan_carry[i], adc_scan_n_carry[i] * sizeof(uint16_t));
+		n_samples[i] = adc_scan_n_carry[i];
+	}
+	// deinterleave in a single pass: each result goes to the block of its channel
+	for(uint32_t i=0; i<n_results; i++){
+		uint8_t slot = adc_scan_slot[data[i].type2.channel];
+		if(slot == ADC_SCAN_NO_SLOT){
+			continue;
+		}
+		if(n_samples[slot] < ANALOG_BLOCK_SIZE){
+			values[slot][n_samples[slot]++] = data[i].type2.data;
+		}
+		else if(n_overflow[slot] < ADC_SCAN_CARRY){
+			overflow[slot][n_overflow[slot]++] = data[i].type2.data;
+		}
+	}
+	for(uint8_t i=0; i<n_inputs; i++){
+		if(n_samples[i] < n_min){
+			n_min = n_samples[i];
+		}
+	}
+	// only whole pattern cycles are delivered, the rest is kept for the next read (a round-robin
+	// scan leaves at most one sample per channel, more means conversions were lost and are dropped)
+	for(uint8_t i=0; i<n_inputs; i++){
+		adc_scan_n_carry[i] = 0;
+		for(uint16_t k=n_min; k<n_samples[i] && adc_scan_n_carry[i]<ADC_SCAN_CARRY; k++){
+			adc_scan_carry[i][adc_scan_n_carry[i]++] = values[i][k];
+		}
+		for(uint8_t k=0; k<n_overflow[i] && adc_scan_n_carry[i]<ADC_SCAN_CARRY; k++){
+			adc_scan_carry[i][adc_scan_n_carry[i]++] = overflow[i][k];
+		}
+	}
+	return n_min;
 }
 
 void AnalogOutputWrite(uint8_t value){
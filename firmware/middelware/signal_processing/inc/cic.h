@@ -0,0 +1,133 @@
+#ifndef CIC_H_
+#define CIC_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup CIC CIC Decimator
+ */
+
+/** \brief Cascaded integrator-comb (CIC) decimator with compensation FIR
+ * 
+ * Multiplier-free decimation of integer samples (e.g. 64x from the continuous ADC): order
+ * integrators run at the input rate and order combs at the output rate, so the cost is a few
+ * additions per sample whatever the factor. The wraparound integer arithmetic is exact while
+ * input_bits + order * log2(factor) fits in 31 bits (e.g. 12 bit ADC codes, order 3 and 64x).
+ * 
+ * The CIC response droops in the passband (sinc^order) and rejects aliases only around the
+ * multiples of the output rate. A short compensation FIR (a Q15 decimator instance, usually
+ * decimating by 2) flattens the passband and removes the rest of the aliases.
+ * 
+ * @section changelog
+ * 
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "decimator.h"
+/*==================[macros]=================================================*/
+#define CIC_MAX_ORDER       5       /*!< Highest CIC order */
+#define CIC_COMP_MAX_TAPS   64      /*!< Longest compensation FIR */
+/*==================[typedef]================================================*/
+/**
+ * @brief CIC config structure
+ */
+typedef struct {
+    uint16_t factor;        /*!< Decimation factor */
+    uint8_t order;          /*!< Number of integrator and comb stages (1 to CIC_MAX_ORDER) */
+    uint8_t input_bits;     /*!< Bits of the input samples (12 for ADC codes, 16 for any int16_t value) */
+} cic_config_t;
+
+/**
+ * @brief CIC instance
+ */
+typedef struct {
+    uint32_t integ[CIC_MAX_ORDER];  /*!< Integrators (wraparound arithmetic) */
+    uint32_t comb[CIC_MAX_ORDER];   /*!< Comb delays */
+    uint16_t factor;                /*!< Decimation factor */
+    uint16_t count;                 /*!< Input samples since the last output */
+    uint8_t order;                  /*!< Number of stages */
+    uint8_t shift;                  /*!< Output shift (gain = factor^order / 2^shift) */
+    float gain;                     /*!< DC gain, in (0.5, 1] (1 if factor is a power of two) */
+} cic_t;
+
+/**
+ * @brief CIC compensation FIR config structure
+ */
+typedef struct {
+    uint16_t taps;          /*!< FIR lenght (up to CIC_COMP_MAX_TAPS, e.g. 32) */
+    uint16_t factor;        /*!< Decimation factor of the FIR (1 or 2) */
+    float cut_freq;         /*!< Cutoff frequency (-6 dB), relative to the CIC output rate (e.g. 0.25 when factor is 2) */
+} cic_comp_config_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a CIC instance
+ * 
+ * @param cic       CIC instance
+ * @param config    CIC config structure
+ * @return true     CIC initialized
+ * @return false    Invalid order or factor, or too many bits for 32 bit registers
+ */
+bool CicInit(cic_t * cic, cic_config_t * config);
+
+/**
+ * @brief Decimate a block of samples
+ * 
+ * Blocks of any lenght can be pushed, the decimation phase is kept between calls.
+ * 
+ * @param cic       CIC instance
+ * @param input     Input samples array
+ * @param output    Output samples array (of lenght >= (input_lenght + factor - 1) / factor), in input units times the CIC gain
+ * @param lenght    Number of input samples
+ * @return uint16_t Number of output samples
+ */
+uint16_t CicProcess(cic_t * cic, const int16_t * input, int16_t * output, uint16_t lenght);
+
+/**
+ * @brief Clear the integrators and combs of a CIC instance
+ * 
+ * @param cic       CIC instance
+ */
+void CicReset(cic_t * cic);
+
+/**
+ * @brief Design the compensation FIR of a CIC instance
+ * 
+ * Windowed (Hamming) inverse of the CIC response up to cut_freq, with the DC gain that
+ * makes the cascade gain unity.
+ * 
+ * @param cic       CIC instance (initialized)
+ * @param config    Compensation FIR config structure
+ * @param coeff     Array for the coefficients (of lenght = config->taps)
+ * @return true     Coefficients designed
+ * @return false    Invalid lenght, factor or cutoff frequency
+ */
+bool CicCompensatorDesign(cic_t * cic, cic_comp_config_t * config, float * coeff);
+
+/**
+ * @brief Initialize the compensation FIR of a CIC instance, as a fixed point decimator
+ * 
+ * The CIC output is then processed with DecimatorProcessQ15().
+ * 
+ * @param comp      Decimator instance for the compensation FIR
+ * @param cic       CIC instance (initialized)
+ * @param config    Compensation FIR config structure
+ * @param buffer    Array used by the decimator (of lenght = DECIMATOR_BUFFER_SIZE(config->taps, config->factor))
+ * @return true     Compensation FIR initialized
+ * @return false    Invalid config
+ */
+bool CicCompensatorInit(decimator_q15_t * comp, cic_t * cic, cic_comp_config_t * config, int16_t * buffer);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* CIC_H_ */
+
+/*==================[end of file]============================================*/
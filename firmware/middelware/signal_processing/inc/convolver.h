@@ -0,0 +1,100 @@
+#ifndef CONVOLVER_H_
+#define CONVOLVER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Convolver FFT Convolver
+ */
+
+/** \brief Streaming FFT convolution (overlap-save) with long FIR kernels
+ * 
+ * Filters a stream with a kernel of kernel_lenght taps (or correlates it with a template) using
+ * the FFT, with the kernel spectrum calculated once at init. Each complex FFT processes two
+ * consecutive overlap-save frames (as real and imaginary parts, the kernel is real), and every
+ * pair of frames gives 2 * (fft_lenght - kernel_lenght + 1) output samples. E.g. a 256 taps
+ * kernel with a 1024 points FFT costs about 30 multiplications per sample instead of 256.
+ * 
+ * Every input sample returns one output sample, delayed by the frames pair lenght
+ * (CONVOLVER_DELAY()), so the per call cost is not constant: the transforms run each time a
+ * pair of frames is completed.
+ * 
+ * @section changelog
+ * 
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fft.h"
+/*==================[macros]=================================================*/
+#define CONVOLVER_STEP(fft_lenght, kernel_lenght)   ((fft_lenght) - (kernel_lenght) + 1)   /*!< New output samples of each frame */
+#define CONVOLVER_DELAY(fft_lenght, kernel_lenght)  (2 * CONVOLVER_STEP(fft_lenght, kernel_lenght))    /*!< Delay of the output (in samples) */
+#define CONVOLVER_BUFFER_SIZE(fft_lenght, kernel_lenght)    (5 * (fft_lenght) + 3 * CONVOLVER_STEP(fft_lenght, kernel_lenght))   /*!< Floats needed by a convolver buffer */
+/*==================[typedef]================================================*/
+/**
+ * @brief Convolver config structure
+ */
+typedef struct {
+    const float * kernel;       /*!< Kernel (FIR coefficients or template), only used by ConvolverInit() */
+    uint16_t kernel_lenght;     /*!< Kernel lenght */
+    uint16_t fft_lenght;        /*!< FFT lenght (power of two, larger than kernel_lenght, up to MAX_SIGNAL_LENGHT; e.g. 4 * kernel_lenght) */
+    bool correlation;           /*!< Correlate with the kernel (template matching) instead of convolving */
+} convolver_config_t;
+
+/**
+ * @brief Convolver instance
+ */
+typedef struct {
+    float * spectrum;           /*!< Kernel spectrum, scaled by 1 / fft_lenght (fft_lenght complex values) */
+    float * work;               /*!< FFT workspace (fft_lenght complex values) */
+    float * input;              /*!< Input samples: last kernel_lenght - 1 samples and current frames pair */
+    float * output;             /*!< Output samples of the last frames pair */
+    uint16_t fft_lenght;        /*!< FFT lenght */
+    uint16_t kernel_lenght;     /*!< Kernel lenght */
+    uint16_t step;              /*!< New output samples of each frame */
+    uint16_t count;             /*!< Samples of the current frames pair */
+} convolver_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a convolver instance, calculating the kernel spectrum
+ * 
+ * @note FFTInit() must be called before
+ * 
+ * @param conv      Convolver instance
+ * @param config    Convolver config structure
+ * @param buffer    Array used for spectrum, workspace and samples (of lenght = CONVOLVER_BUFFER_SIZE(config->fft_lenght, config->kernel_lenght))
+ * @return true     Convolver initialized
+ * @return false    Invalid lenghts
+ */
+bool ConvolverInit(convolver_t * conv, convolver_config_t * config, float * buffer);
+
+/**
+ * @brief Filter a block of samples
+ * 
+ * @param conv      Convolver instance
+ * @param input     Input samples array
+ * @param output    Output samples array, delayed CONVOLVER_DELAY() samples (can be the same as input)
+ * @param lenght    Number of samples of both arrays
+ */
+void ConvolverProcess(convolver_t * conv, const float * input, float * output, uint16_t lenght);
+
+/**
+ * @brief Clear the samples of a convolver instance (the kernel spectrum is kept)
+ * 
+ * @param conv      Convolver instance
+ */
+void ConvolverReset(convolver_t * conv);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* CONVOLVER_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,160 @@
+#ifndef DECIMATOR_H_
+#define DECIMATOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Decimator Decimator
+ */
+
+/** \brief Polyphase FIR decimation stage (sample rate reduction)
+ * 
+ * Low-pass filters (anti-aliasing) and downsamples a continuous stream by an integer factor,
+ * e.g. 20 kHz ADC blocks to 500 Hz. Only the kept output samples are calculated (esp-dsp
+ * dsps_fird_f32 / dsps_fird_s16), so the cost is taps MACs per output sample. Blocks of any
+ * lenght can be pushed: samples that do not complete an output are kept for the next block.
+ * 
+ * The filter is a Blackman windowed sinc (about 74 dB of stopband rejection, enough for 12 bit
+ * ADC codes) with unity DC gain. Its transition band is about 5.5 * sample_freq / taps wide,
+ * so taps = 14 * factor keeps the aliases out of 0..0.4 * output rate.
+ * 
+ * @section changelog
+ * 
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * | 17/10/2026 | Fixed point decimator with custom coefficients (CIC compensation)		|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "dsps_fir.h"
+/*==================[macros]=================================================*/
+#define DECIMATOR_BUFFER_SIZE(taps, factor)  (2 * (taps) + (factor))   /*!< Elements (float or int16_t) needed by a decimator buffer */
+/*==================[typedef]================================================*/
+/**
+ * @brief Decimator config structure
+ */
+typedef struct {
+    float sample_freq;      /*!< Input sample frequency (in Hz) */
+    uint16_t factor;        /*!< Decimation factor (output rate = sample_freq / factor) */
+    uint16_t taps;          /*!< FIR lenght (e.g. 14 * factor) */
+    float cut_freq;         /*!< Anti-aliasing cutoff frequency (-6 dB, in Hz), 0 to use 0.4 * output rate */
+} decimator_config_t;
+
+/**
+ * @brief Decimator instance (floating point)
+ */
+typedef struct {
+    fir_f32_t fir;          /*!< esp-dsp decimation FIR */
+    float * pending;        /*!< Input samples of the next output (of lenght = factor) */
+    uint16_t count;         /*!< Samples stored in pending */
+} decimator_t;
+
+/**
+ * @brief Decimator instance (fixed point, Q15 coefficients)
+ */
+typedef struct {
+    fir_s16_t fir;          /*!< esp-dsp decimation FIR */
+    int16_t * pending;      /*!< Input samples of the next output (of lenght = factor) */
+    uint16_t count;         /*!< Samples stored in pending */
+} decimator_q15_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Design the anti-aliasing FIR of a decimator (Blackman windowed sinc, unity DC gain)
+ * 
+ * @param config    Decimator config structure
+ * @param coeff     Array for the coefficients (of lenght = config->taps)
+ * @return true     Coefficients designed
+ * @return false    Invalid factor, taps or cutoff frequency
+ */
+bool DecimatorDesign(decimator_config_t * config, float * coeff);
+
+/**
+ * @brief Initialize a decimator instance (floating point)
+ * 
+ * @param decimator Decimator instance
+ * @param config    Decimator config structure
+ * @param buffer    Array used for coefficients, delay line and pending samples (of lenght = DECIMATOR_BUFFER_SIZE(config->taps, config->factor))
+ * @return true     Decimator initialized
+ * @return false    Invalid config
+ */
+bool DecimatorInit(decimator_t * decimator, decimator_config_t * config, float * buffer);
+
+/**
+ * @brief Decimate a block of samples
+ * 
+ * @param decimator Decimator instance
+ * @param input     Input samples array
+ * @param output    Output samples array (of lenght >= (input_lenght + factor - 1) / factor)
+ * @param lenght    Number of input samples
+ * @return uint16_t Number of output samples
+ */
+uint16_t DecimatorProcess(decimator_t * decimator, const float * input, float * output, uint16_t lenght);
+
+/**
+ * @brief Clear the delay line and pending samples of a decimator instance
+ * 
+ * @param decimator Decimator instance
+ */
+void DecimatorReset(decimator_t * decimator);
+
+/**
+ * @brief Initialize a decimator instance (fixed point)
+ * 
+ * Samples are 16 bit integers: 12 bit ADC codes can be used directly (output in ADC codes).
+ * The output is not saturated, input values must leave some headroom for the filter overshoot.
+ * The DC gain is 32767 / 32768 (the largest Q15 coefficient, so short filters fit in Q15).
+ * 
+ * @param decimator Decimator instance
+ * @param config    Decimator config structure
+ * @param buffer    Array used for coefficients, delay line and pending samples (of lenght = DECIMATOR_BUFFER_SIZE(config->taps, config->factor))
+ * @return true     Decimator initialized
+ * @return false    Invalid config, or coefficients out of the Q15 range
+ */
+bool DecimatorInitQ15(decimator_q15_t * decimator, decimator_config_t * config, int16_t * buffer);
+
+/**
+ * @brief Initialize a decimator instance (fixed point) with custom coefficients
+ * 
+ * The coefficients are quantized to Q15 keeping their sum (DC gain). dsps_fird_s16 applies them 
+ * in the given order (coeff[0] to the newest sample).
+ * 
+ * @param decimator Decimator instance
+ * @param coeff     Coefficients array (of lenght = taps, each in [-1, 1) once quantized, center one included after the DC gain correction)
+ * @param taps      FIR lenght
+ * @param factor    Decimation factor (1 for a plain FIR)
+ * @param buffer    Array used for coefficients, delay line and pending samples (of lenght = DECIMATOR_BUFFER_SIZE(taps, factor))
+ * @return true     Decimator initialized
+ * @return false    Invalid lenght, factor or coefficients
+ */
+bool DecimatorInitCoeffQ15(decimator_q15_t * decimator, const float * coeff, uint16_t taps, uint16_t factor, int16_t * buffer);
+
+/**
+ * @brief Decimate a block of samples (fixed point)
+ * 
+ * @param decimator Decimator instance
+ * @param input     Input samples array
+ * @param output    Output samples array (of lenght >= (input_lenght + factor - 1) / factor)
+ * @param lenght    Number of input samples
+ * @return uint16_t Number of output samples
+ */
+uint16_t DecimatorProcessQ15(decimator_q15_t * decimator, const int16_t * input, int16_t * output, uint16_t lenght);
+
+/**
+ * @brief Clear the delay line and pending samples of a decimator instance (fixed point)
+ * 
+ * @param decimator Decimator instance
+ */
+void DecimatorResetQ15(decimator_q15_t * decimator);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* DECIMATOR_H_ */
+
+/*==================[end of file]============================================*/
@@ -16,15 +16,76 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 17/10/2026 | Fixed point (Q15) FFT magnitude                						|
+ * | 17/10/2026 | FFT context with cached window and workspace   						|
+ * | 17/10/2026 | Real input FFT (N/2 complex points)            						|
+ * | 17/10/2026 | Power spectrum accumulation (for Welch PSD)    						|
+ * | 17/10/2026 | Top-K spectral peaks with sub-bin interpolation						|
+ * | 17/10/2026 | Radix-4 and mixed radix-2/4 transforms for FFT contexts				|
+ * | 17/10/2026 | Const twiddle tables in flash (no tables calculated by FFTInit)		|
+ * | 17/10/2026 | MAX_SIGNAL_LENGHT set with menuconfig         						|
+ * | 17/10/2026 | FFTMagnitude() leaves fft untouched on invalid lenghts				|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
 #include <stdbool.h>
+#include "sdkconfig.h"
 /*==================[macros]=================================================*/
-#define MAX_SIGNAL_LENGHT   2048
+#define MAX_SIGNAL_LENGHT   CONFIG_SIGNAL_PROCESSING_FFT_MAX_LENGHT /*!< Longest FFT: 256, 512, 1024 or 2048 (size of the const twiddle tables, set with menuconfig) */
+#define FFT_WORK_SIZE(lenght)   (2 * (lenght))  /*!< Floats needed by the workspace of a FFT context */
+#define FFT_REAL_WORK_SIZE(lenght)  (lenght)    /*!< Floats needed by the workspace of a FFT context used only with FFTContextMagnitudeReal() */
 /*==================[typedef]================================================*/
+/**
+ * @brief Windows available for FFT contexts
+ */
+typedef enum fft_window {
+    FFT_WINDOW_RECT,                /*!< No window */
+    FFT_WINDOW_HANN,                /*!< Hann window (as in FFTMagnitude) */
+    FFT_WINDOW_BLACKMAN,            /*!< Blackman window */
+    FFT_WINDOW_BLACKMAN_HARRIS,     /*!< Blackman-Harris window */
+    FFT_WINDOW_FLAT_TOP,            /*!< Flat top window (accurate amplitude) */
+} fft_window_t;
+
+/**
+ * @brief Transform algorithm of FFT contexts
+ */
+typedef enum fft_radix {
+    FFT_RADIX_2,                    /*!< Radix-2 (dsps_fft2r_fc32) */
+    FFT_RADIX_4,                    /*!< Radix-4 (dsps_fft4r_fc32) for powers of four, two radix-4 halves and a radix-2 stage for the other lenghts */
+} fft_radix_t;
+
+/**
+ * @brief Sub-bin interpolation of spectral peaks
+ */
+typedef enum fft_interp {
+    FFT_INTERP_PARABOLIC,           /*!< Parabola through the magnitudes of the peak and its neighbours */
+    FFT_INTERP_GAUSSIAN,            /*!< Parabola through the log magnitudes (Gaussian main lobe, best for Hann and Blackman windows) */
+} fft_interp_t;
+
+/**
+ * @brief Spectral peak
+ */
+typedef struct {
+    float freq;             /*!< Interpolated frequency (Hz) */
+    float amplitude;        /*!< Interpolated magnitude (same scale as the spectrum) */
+    uint16_t bin;           /*!< Bin of the local maximum */
+} fft_peak_t;
+
+/**
+ * @brief FFT context: lenght, window and workspace of a FFT calculation
+ * 
+ * Window table and workspace are provided by the caller, so each context uses only the 
+ * memory its lenght requires and several contexts (e.g. one per task) can run at the same time.
+ */
+typedef struct {
+    uint16_t lenght;        /*!< Signal lenght (power of two, up to MAX_SIGNAL_LENGHT) */
+    fft_window_t window;    /*!< Window applied to the signal */
+    fft_radix_t radix;      /*!< Transform algorithm (FFT_RADIX_4 after FFTContextInit()) */
+    float * wind;           /*!< Window table (of lenght = lenght), filled once by FFTContextInit() */
+    float * work;           /*!< Workspace (of lenght = FFT_WORK_SIZE(lenght)) */
+} fft_context_t;
 
 /*==================[external data declaration]==============================*/
 
@@ -32,6 +93,9 @@
 /**
  * @brief Initialize the FFT calculation module
  * 
+ * Twiddle tables are const tables stored in flash (see tools/fft_table_gen.py), sized for
+ * MAX_SIGNAL_LENGHT points: nothing is calculated or allocated.
+ * 
  * @return true     FFT initialized
  * @return false    Not possible to initialize FFT
  */
@@ -40,7 +104,8 @@ bool FFTInit(void);
 /**
  * @brief Calculates the Fast Fourier Transform of a given signal
  * 
- * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT), 
+ * otherwise the fft array is not modified
  * 
  * @param signal            Array with signal values (of lenght = signal_lenght)
  * @param fft               Array to store FFT magnitude values (of lenght = signal_lenght / 2)
@@ -48,6 +113,130 @@ bool FFTInit(void);
  */
 void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght);
 
+/**
+ * @brief Initialize a FFT context, calculating its window table
+ * 
+ * @note FFTInit() must be called before using any context
+ * 
+ * @param ctx               FFT context to initialize
+ * @param signal_lenght     Lenght of signal arrays (power of two, up to MAX_SIGNAL_LENGHT)
+ * @param window            Window applied to the signal
+ * @param wind              Array to store the window table (of lenght = signal_lenght)
+ * @param work              Workspace array (of lenght = FFT_WORK_SIZE(signal_lenght))
+ * @return true     Context initialized
+ * @return false    Invalid lenght
+ */
+bool FFTContextInit(fft_context_t * ctx, uint16_t signal_lenght, fft_window_t window, float * wind, float * work);
+
+/**
+ * @brief Select the transform algorithm of a FFT context
+ * 
+ * Radix-4 needs fewer multiplications per point than radix-2, so it is the default. Both 
+ * algorithms give the same results (within float rounding).
+ * 
+ * @param ctx               FFT context
+ * @param radix             Transform algorithm
+ */
+void FFTContextSetRadix(fft_context_t * ctx, fft_radix_t radix);
+
+/**
+ * @brief Calculates the Fast Fourier Transform of a signal using a FFT context
+ * 
+ * Same output as FFTMagnitude(), without recalculating the window nor clearing buffers.
+ * 
+ * @param ctx               FFT context
+ * @param signal            Array with signal values (of lenght = ctx->lenght)
+ * @param fft               Array to store FFT magnitude values (of lenght = ctx->lenght / 2)
+ */
+void FFTContextMagnitude(fft_context_t * ctx, float * signal, float * fft);
+
+/**
+ * @brief Calculates the Fast Fourier Transform of a real signal using a FFT context
+ * 
+ * The N real samples are packed as N/2 complex points (even samples as real part, odd 
+ * samples as imaginary part), so the transform needs half the butterflies and half the 
+ * workspace of FFTContextMagnitude(). Output has the same layout and scale.
+ * 
+ * @param ctx               FFT context (workspace of at least FFT_REAL_WORK_SIZE(ctx->lenght))
+ * @param signal            Array with signal values (of lenght = ctx->lenght)
+ * @param fft               Array to store FFT magnitude values (of lenght = ctx->lenght / 2)
+ */
+void FFTContextMagnitudeReal(fft_context_t * ctx, float * signal, float * fft);
+
+/**
+ * @brief Accumulates the power spectrum of a real signal using a FFT context
+ * 
+ * Updates power[k] = a * power[k] + b * |X[k]|^2 for every bin of the single-sided spectrum, 
+ * where X is the (unscaled) FFT of the windowed signal. Uses the same transform as 
+ * FFTContextMagnitudeReal() and needs no extra buffers (e.g. a = 1, b = 1 for a sum, 
+ * a = 1 - alpha, b = alpha for an exponential average).
+ * 
+ * @param ctx               FFT context (workspace of at least FFT_REAL_WORK_SIZE(ctx->lenght))
+ * @param signal            Array with signal values (of lenght = ctx->lenght)
+ * @param power             Array of accumulated power values (of lenght = ctx->lenght / 2)
+ * @param a                 Weight of the accumulated value
+ * @param b                 Weight of the new power value
+ */
+void FFTContextPowerAccumulate(fft_context_t * ctx, float * signal, float * power, float a, float b);
+
+/**
+ * @brief Initialize the fixed point (Q15) FFT calculation module
+ * 
+ * @return true     FFT initialized
+ * @return false    Not possible to initialize FFT
+ */
+bool FFTInitQ15(void);
+
+/**
+ * @brief Calculates the Fast Fourier Transform of a signal of raw ADC codes in fixed point (Q15)
+ * 
+ * The whole pipeline (window, FFT and magnitude) uses integer arithmetic only, so it is 
+ * much faster than FFTMagnitude() on cores without FPU (as the ESP32-C6).
+ * Output has the same scale as FFTMagnitude() (bin 0 is the signal mean).
+ * 
+ * @note  Lenght of signal array must be a power of two (with maximun value = MAX_SIGNAL_LENGHT)
+ * 
+ * @param signal            Array with 12 bit ADC codes (of lenght = signal_lenght)
+ * @param fft               Array to store FFT magnitude values (of lenght = signal_lenght / 2)
+ * @param signal_lenght     Lenght of signal arrays
+ */
+void FFTMagnitudeQ15(uint16_t * signal, uint16_t * fft, uint16_t signal_lenght);
+
+/**
+ * @brief Find the largest peaks of a magnitude spectrum, with sub-bin frequency and amplitude
+ * 
+ * Single pass over the spectrum (e.g. the FFTMagnitude() output): local maxima above threshold 
+ * are kept sorted while scanning, and only the max_peaks found are interpolated. Frequencies are 
+ * calculated from the bin, so no frequency axis array (FFTFrequency()) is needed. Bins 0 and 
+ * signal_lenght / 2 - 1 are not considered (no neighbours on both sides).
+ * 
+ * @param fft               Array with FFT magnitude values (of lenght = signal_lenght / 2)
+ * @param signal_lenght     Lenght of the transformed signal
+ * @param sample_freq       Sample frequency (in Hz)
+ * @param threshold         Smallest magnitude of a peak
+ * @param interp            Sub-bin interpolation
+ * @param peaks             Array for the peaks found, sorted by decreasing amplitude (of lenght = max_peaks)
+ * @param max_peaks         Number of peaks searched
+ * @return uint16_t         Number of peaks found (up to max_peaks)
+ */
+uint16_t FFTPeaks(const float * fft, uint16_t signal_lenght, float sample_freq, float threshold, fft_interp_t interp, fft_peak_t * peaks, uint16_t max_peaks);
+
+/**
+ * @brief Find the largest peaks of a spectrum calculated with a FFT context
+ * 
+ * As FFTPeaks(), with the lenght of the context and the interpolation that suits its window 
+ * (Gaussian for Hann, Blackman and Blackman-Harris windows, parabolic for the others).
+ * 
+ * @param ctx               FFT context used to calculate the spectrum
+ * @param fft               Array with FFT magnitude values (of lenght = ctx->lenght / 2)
+ * @param sample_freq       Sample frequency (in Hz)
+ * @param threshold         Smallest magnitude of a peak
+ * @param peaks             Array for the peaks found, sorted by decreasing amplitude (of lenght = max_peaks)
+ * @param max_peaks         Number of peaks searched
+ * @return uint16_t         Number of peaks found (up to max_peaks)
+ */
+uint16_t FFTContextPeaks(fft_context_t * ctx, const float * fft, float sample_freq, float threshold, fft_peak_t * peaks, uint16_t max_peaks);
+
 /**
  * @brief Return the FFT frequency axis vector
  * 
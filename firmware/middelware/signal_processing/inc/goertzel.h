@@ -0,0 +1,145 @@
+#ifndef GOERTZEL_H_
+#define GOERTZEL_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Goertzel Goertzel Filter Bank
+ */
+
+/** \brief Goertzel filter bank, tracks the amplitude of a few frequencies
+ * 
+ * Each bin is a Goertzel resonator updated with every new sample (O(bins) per sample, no 
+ * buffering). After a block of lenght samples, the amplitude of each target frequency is 
+ * calculated and the resonators restart. Samples can be pushed one by one (e.g. from a 
+ * sampling task) or by blocks. Frequencies should be multiples of sample_freq / lenght to 
+ * avoid leakage (e.g. 50 Hz with 1000 Hz sample frequency and 100 samples blocks).
+ * 
+ * The fixed point version (Q30 functions) takes raw ADC codes, uses integer arithmetic only 
+ * (the ESP32-C6 has no FPU) and is intended to run inside the sampling task. Its coefficients 
+ * are Q30 (range [-2, 2)), samples and resonators state are 32 bit integers (ADC codes) and 
+ * the products are calculated in 64 bits.
+ * 
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * | 17/10/2026 | Fixed point functions renamed after their Q30 coefficients			|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define GOERTZEL_MAX_BINS   8       /*!< Maximum number of frequencies tracked by a bank */
+/*==================[typedef]================================================*/
+/**
+ * @brief Goertzel bank config structure
+ */
+typedef struct {
+    float sample_freq;      /*!< Sample frequency (in Hz) */
+    uint16_t lenght;        /*!< Samples per block */
+    const float * freqs;    /*!< Array of target frequencies (in Hz, below sample_freq / 2) */
+    uint8_t n_bins;         /*!< Number of target frequencies (up to GOERTZEL_MAX_BINS) */
+    uint16_t offset;        /*!< Offset subtracted to the samples (fixed point version only, e.g. 2048 for 12 bits ADC codes) */
+} goertzel_config_t;
+
+/**
+ * @brief Goertzel bank (floating point)
+ */
+typedef struct {
+    float coeff[GOERTZEL_MAX_BINS];     /*!< Resonators coefficients: 2 * cos(2 * pi * f / fs) */
+    float s1[GOERTZEL_MAX_BINS];        /*!< Resonators state s[n-1] */
+    float s2[GOERTZEL_MAX_BINS];        /*!< Resonators state s[n-2] */
+    float amplitude[GOERTZEL_MAX_BINS]; /*!< Amplitude of each frequency in the last block */
+    uint16_t lenght;                    /*!< Samples per block */
+    uint16_t count;                     /*!< Samples in the current block */
+    uint8_t n_bins;                     /*!< Number of target frequencies */
+} goertzel_t;
+
+/**
+ * @brief Goertzel bank (fixed point, Q30 coefficients)
+ */
+typedef struct {
+    int32_t coeff[GOERTZEL_MAX_BINS];       /*!< Resonators coefficients: 2 * cos(2 * pi * f / fs), in Q30 */
+    int32_t s1[GOERTZEL_MAX_BINS];          /*!< Resonators state s[n-1] */
+    int32_t s2[GOERTZEL_MAX_BINS];          /*!< Resonators state s[n-2] */
+    uint16_t amplitude[GOERTZEL_MAX_BINS];  /*!< Amplitude of each frequency in the last block (in ADC codes) */
+    uint16_t lenght;                        /*!< Samples per block */
+    uint16_t count;                         /*!< Samples in the current block */
+    uint16_t offset;                        /*!< Offset subtracted to the samples */
+    uint8_t n_bins;                         /*!< Number of target frequencies */
+} goertzel_q30_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a Goertzel bank (floating point)
+ * 
+ * @param bank      Goertzel bank
+ * @param config    Goertzel config structure
+ * @return true     Bank initialized
+ * @return false    Invalid number of frequencies or lenght
+ */
+bool GoertzelInit(goertzel_t * bank, goertzel_config_t * config);
+
+/**
+ * @brief Push samples into a Goertzel bank (floating point)
+ * 
+ * When a block is completed, bank->amplitude is updated with the amplitude of each target 
+ * frequency. If more than one block is completed, only the last one is kept.
+ * 
+ * @param bank      Goertzel bank
+ * @param samples   Array of new samples
+ * @param n         Number of samples
+ * @return true     A block was completed (amplitudes updated)
+ * @return false    Block not completed yet
+ */
+bool GoertzelPush(goertzel_t * bank, const float * samples, uint16_t n);
+
+/**
+ * @brief Restart the current block of a Goertzel bank (floating point)
+ * 
+ * @param bank      Goertzel bank
+ */
+void GoertzelReset(goertzel_t * bank);
+
+/**
+ * @brief Initialize a Goertzel bank (fixed point)
+ * 
+ * @param bank      Goertzel bank
+ * @param config    Goertzel config structure
+ * @return true     Bank initialized
+ * @return false    Invalid number of frequencies or lenght
+ */
+bool GoertzelInitQ30(goertzel_q30_t * bank, goertzel_config_t * config);
+
+/**
+ * @brief Push raw ADC codes into a Goertzel bank (fixed point)
+ * 
+ * When a block is completed, bank->amplitude is updated with the amplitude (in ADC codes) of 
+ * each target frequency. If more than one block is completed, only the last one is kept.
+ * 
+ * @param bank      Goertzel bank
+ * @param samples   Array of new samples (12 bits ADC codes)
+ * @param n         Number of samples
+ * @return true     A block was completed (amplitudes updated)
+ * @return false    Block not completed yet
+ */
+bool GoertzelPushQ30(goertzel_q30_t * bank, const uint16_t * samples, uint16_t n);
+
+/**
+ * @brief Restart the current block of a Goertzel bank (fixed point)
+ * 
+ * @param bank      Goertzel bank
+ */
+void GoertzelResetQ30(goertzel_q30_t * bank);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* GOERTZEL_H_ */
+
+/*==================[end of file]============================================*/
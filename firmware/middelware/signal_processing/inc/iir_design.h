@@ -0,0 +1,109 @@
+#ifndef IIR_DESIGN_H_
+#define IIR_DESIGN_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup IIR_Design IIR Design
+ */
+
+/** \brief IIR filters designer (cascades of 2nd order sections)
+ * 
+ * Designs Butterworth, Chebyshev I and Bessel filters of any even order, as low pass, hi pass, 
+ * band pass, band stop or notch filters (analog prototype, frequency transformation and bilinear 
+ * transform with prewarping). Designs can be appended to a filter instance, so several responses 
+ * run in a single cascade, e.g. a 50 Hz notch and a 0.5-40 Hz ECG band pass:
+ * 
+ * @code
+ * iir_design_t notch = {.type = IIR_NOTCH, .design = IIR_BUTTERWORTH, .order = 2, 
+ *                       .sample_frec = 250, .cut_frec = 50, .cut_frec_2 = 2};
+ * iir_design_t band = {.type = IIR_BAND_PASS, .design = IIR_BUTTERWORTH, .order = 4, 
+ *                      .sample_frec = 250, .cut_frec = 0.5, .cut_frec_2 = 40};
+ * IirDesignInit(&ecg_filter, &notch);
+ * IirDesignAppend(&ecg_filter, &band);
+ * @endcode
+ * 
+ * The designed instances are used with the iir_filter.h functions (IirFilterProcess(), 
+ * IirFilterSample(), IirFilterToQ31(), etc.).
+ * 
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * | 17/10/2026 | Numerators kept inside the fixed point range (gain sections)			|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "iir_filter.h"
+/*==================[macros]=================================================*/
+
+/*==================[typedef]================================================*/
+/**
+ * @brief Filter approximations
+ */
+typedef enum filter_design {
+    IIR_BUTTERWORTH,    /*!< Maximally flat pass band */
+    IIR_CHEBYSHEV,      /*!< Chebyshev type I: pass band ripple, steeper transition */
+    IIR_BESSEL          /*!< Maximally flat group delay (-3 dB at the cut-off frequency) */
+} filter_design_t;
+
+/**
+ * @brief Filter design parameters
+ */
+typedef struct {
+    filter_type_t type;         /*!< Filter's type */
+    filter_design_t design;     /*!< Filter's approximation */
+    uint8_t order;              /*!< Filter's order (even), the design uses order / 2 sections */
+    float sample_frec;          /*!< Signal's sample frequency */
+    float cut_frec;             /*!< Cut-off frequency (low and hi pass), lower edge (band pass and stop) or center frequency (notch) */
+    float cut_frec_2;           /*!< Upper edge (band pass and stop) or -3 dB bandwidth (notch), not used by low and hi pass */
+    float ripple;               /*!< Pass band ripple in dB (Chebyshev only) */
+} iir_design_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Design the 2nd order sections of a filter
+ * 
+ * Sections are returned as (b0, b1, b2, a1, a2), as used by dsps_biquad_f32 and iir_filter_t, 
+ * with the pass band gain spread evenly between sections (coefficients suited to fixed point).
+ * Numerator coefficients are kept below 1.99, inside the range of IirFilterToQ31() and 
+ * IirFilterToQ15(); gain that does not fit is moved to pure gain sections (b0 only) at the end.
+ * 
+ * @param design        Filter design parameters
+ * @param sos           Array for the sections coefficients
+ * @param max_sections  Number of sections available in sos
+ * @return uint8_t      Number of sections designed, gain sections included (0 on invalid parameters or not enough sections)
+ */
+uint8_t IirDesignSos(const iir_design_t * design, float sos[][IIR_SOS_COEFF], uint8_t max_sections);
+
+/**
+ * @brief Initialize a filter instance with a design
+ * 
+ * @param filter        Filter instance
+ * @param design        Filter design parameters
+ * @return true         Filter initialized (state cleared)
+ * @return false        Invalid parameters or more than IIR_MAX_SECTIONS sections
+ */
+bool IirDesignInit(iir_filter_t * filter, const iir_design_t * design);
+
+/**
+ * @brief Append a design to a filter instance (in cascade with its current sections)
+ * 
+ * @param filter        Filter instance (initialized)
+ * @param design        Filter design parameters
+ * @return true         Design appended (state cleared)
+ * @return false        Invalid parameters or not enough free sections (filter is not modified)
+ */
+bool IirDesignAppend(iir_filter_t * filter, const iir_design_t * design);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* IIR_DESIGN_H_ */
+
+/*==================[end of file]============================================*/
@@ -16,12 +16,32 @@
  * |   Date	    | Description                                    						|
  * |:----------:|:----------------------------------------------------------------------|
  * | 15/03/2024 | Document creation		                         						|
+ * | 17/10/2026 | Multi-instance filters (iir_filter_t)          						|
+ * | 17/10/2026 | Single pass cascade kernel, fixed point (Q31) filters					|
+ * | 17/10/2026 | Fixed point (Q15) filters, filtering of raw ADC codes					|
+ * | 17/10/2026 | Per sample inline filtering (ISR safe)         						|
+ * | 17/10/2026 | Band pass, band stop and notch filter types    						|
+ * | 17/10/2026 | Filters with const coefficient tables (in flash)						|
+ * | 17/10/2026 | Zero-phase forward-backward filtering (filtfilt)						|
+ * | 17/10/2026 | IIR_MAX_SECTIONS set with menuconfig          						|
  * 
  **/
 
 /*==================[inclusions]=============================================*/
 #include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
 /*==================[macros]=================================================*/
+#define IIR_MAX_SECTIONS    CONFIG_SIGNAL_PROCESSING_IIR_MAX_SECTIONS   /*!< Maximum number of 2nd order sections of a filter (4 to 8, set with menuconfig) */
+#define IIR_SOS_COEFF       5       /*!< Coefficients of a 2nd order section (b0, b1, b2, a1, a2) */
+#define IIR_SOS_DELAY       2       /*!< Delay values of a 2nd order section */
+#define IIR_SOS_DELAY_Q     4       /*!< Delay values of a fixed point 2nd order section (x[n-1], x[n-2], y[n-1], y[n-2]) */
+#define IIR_FILTFILT_PAD    (3 * (2 * IIR_MAX_SECTIONS + 1))    /*!< Largest edge padding used by IirFilterFiltfilt() */
+#define IIR_FILTFILT_SCRATCH_SIZE(lenght)   ((lenght) + 2 * IIR_FILTFILT_PAD)   /*!< Floats needed by the IirFilterFiltfilt() scratch buffer */
+#define IIR_COEFF_Q31_FRAC  30      /*!< Fractional bits of the Q31 filters coefficients (range [-2, 2)) */
+#define IIR_COEFF_Q15_FRAC  14      /*!< Fractional bits of the Q15 filters coefficients (range [-2, 2)) */
+#define IIR_ADC_BITS        12      /*!< Resolution of the ADC codes filtered by the Adc functions */
+#define IIR_ADC_GUARD_BITS  2       /*!< Headroom bits left above the ADC codes in the fixed point samples */
 
 /*==================[typedef]================================================*/
 typedef enum filter_order {
@@ -30,9 +50,357 @@ typedef enum filter_order {
     ORDER_6 = 6,        /*!< 6th order filter */
     ORDER_8 = 8         /*!< 8th order filter */
 } filter_order_t;
+
+typedef enum filter_type {
+    IIR_LOW_PASS,       /*!< Low pass filter */
+    IIR_HI_PASS,        /*!< Hi pass filter */
+    IIR_BAND_PASS,      /*!< Band pass filter (designed with iir_design.h) */
+    IIR_BAND_STOP,      /*!< Band stop filter (designed with iir_design.h) */
+    IIR_NOTCH           /*!< Notch filter (designed with iir_design.h) */
+} filter_type_t;
+
+/**
+ * @brief IIR filter instance (cascade of 2nd order sections), can be statically allocated
+ */
+typedef struct {
+    float coeff[IIR_MAX_SECTIONS][IIR_SOS_COEFF];   /*!< Coefficients of each section */
+    float delay[IIR_MAX_SECTIONS][IIR_SOS_DELAY];   /*!< State of each section */
+    uint8_t n_sections;                             /*!< Number of sections (order / 2) */
+} iir_filter_t;
+
+/**
+ * @brief Fixed point IIR filter instance (cascade of direct form I 2nd order sections)
+ */
+typedef struct {
+    int32_t coeff[IIR_MAX_SECTIONS][IIR_SOS_COEFF];     /*!< Coefficients of each section (in Q30) */
+    int32_t delay[IIR_MAX_SECTIONS][IIR_SOS_DELAY_Q];   /*!< State of each section */
+    uint8_t n_sections;                                 /*!< Number of sections (order / 2) */
+} iir_filter_q31_t;
+
+/**
+ * @brief Fixed point IIR filter instance (cascade of direct form I 2nd order sections)
+ */
+typedef struct {
+    int16_t coeff[IIR_MAX_SECTIONS][IIR_SOS_COEFF];     /*!< Coefficients of each section (in Q14) */
+    int16_t delay[IIR_MAX_SECTIONS][IIR_SOS_DELAY_Q];   /*!< State of each section */
+    uint8_t n_sections;                                 /*!< Number of sections (order / 2) */
+} iir_filter_q15_t;
+
+/**
+ * @brief IIR filter instance with a const coefficients table (e.g. generated with tools/iir_coeff_gen.py)
+ */
+typedef struct {
+    const float (*coeff)[IIR_SOS_COEFF];            /*!< Coefficients of each section (in flash) */
+    float delay[IIR_MAX_SECTIONS][IIR_SOS_DELAY];   /*!< State of each section */
+    uint8_t n_sections;                             /*!< Number of sections */
+} iir_filter_const_t;
+
+/**
+ * @brief Fixed point IIR filter instance with a const coefficients table (e.g. generated with tools/iir_coeff_gen.py)
+ */
+typedef struct {
+    const int32_t (*coeff)[IIR_SOS_COEFF];              /*!< Coefficients of each section (in Q30, in flash) */
+    int32_t delay[IIR_MAX_SECTIONS][IIR_SOS_DELAY_Q];   /*!< State of each section */
+    uint8_t n_sections;                                 /*!< Number of sections */
+} iir_filter_const_q31_t;
 /*==================[external data declaration]==============================*/
 
 /*==================[external functions declaration]=========================*/
+/**
+ * @brief Filter one sample (inline, ISR safe)
+ * 
+ * Loops over the filter->n_sections sections of the filter. Being always inlined, the code runs 
+ * from the caller's memory (e.g. an IRAM_ATTR timer callback registered with TimerInit()); the filter 
+ * instance must be a RAM variable (not const).
+ * 
+ * @note The ESP32-C6 has no FPU: floating point operations call libgcc routines, which can be 
+ * placed in flash. IirFilterSampleQ31() uses integer operations only.
+ * 
+ * @param filter    Filter instance (initialized with IirFilterInit())
+ * @param x         Input sample
+ * @return          Filtered sample
+ */
+static inline __attribute__((always_inline)) float IirFilterSample(iir_filter_t * filter, float x){
+    float d0;
+    for (uint8_t s = 0; s < filter->n_sections; s++){
+        d0 = x - filter->coeff[s][3] * filter->delay[s][0] - filter->coeff[s][4] * filter->delay[s][1];
+        x = filter->coeff[s][0] * d0 + filter->coeff[s][1] * filter->delay[s][0] + filter->coeff[s][2] * filter->delay[s][1];
+        filter->delay[s][1] = filter->delay[s][0];
+        filter->delay[s][0] = d0;
+    }
+    return x;
+}
+
+/**
+ * @brief Filter one fixed point (Q31) sample (inline, ISR safe)
+ * 
+ * Same as IirFilterSample(), with integer operations only. Gives the same output as 
+ * IirFilterProcessQ31().
+ * 
+ * @param filter    Fixed point filter instance (initialized with IirFilterInitQ31() or IirFilterToQ31())
+ * @param x         Input sample
+ * @return          Filtered sample
+ */
+static inline __attribute__((always_inline)) int32_t IirFilterSampleQ31(iir_filter_q31_t * filter, int32_t x){
+    int64_t acc;
+    for (uint8_t s = 0; s < filter->n_sections; s++){
+        acc = (int64_t)1 << (IIR_COEFF_Q31_FRAC - 1);
+        acc += (int64_t)filter->coeff[s][0] * x + (int64_t)filter->coeff[s][1] * filter->delay[s][0] 
+             + (int64_t)filter->coeff[s][2] * filter->delay[s][1];
+        acc -= (int64_t)filter->coeff[s][3] * filter->delay[s][2] + (int64_t)filter->coeff[s][4] * filter->delay[s][3];
+        acc >>= IIR_COEFF_Q31_FRAC;
+        filter->delay[s][1] = filter->delay[s][0];
+        filter->delay[s][0] = x;
+        x = (acc > INT32_MAX) ? INT32_MAX : (acc < INT32_MIN) ? INT32_MIN : (int32_t)acc;
+        filter->delay[s][3] = filter->delay[s][2];
+        filter->delay[s][2] = x;
+    }
+    return x;
+}
+
+/**
+ * @brief Initialize a Butterworth filter instance
+ * 
+ * @param filter        Filter instance
+ * @param type          Filter's type (low pass or hi pass)
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ * @return true         Filter initialized (state cleared)
+ * @return false        Invalid order or type
+ */
+bool IirFilterInit(iir_filter_t * filter, filter_type_t type, float sample_frec, float cut_frec, filter_order_t order);
+
+/**
+ * @brief Apply a filter instance to a signal array
+ * 
+ * All sections are applied to each sample in a single pass over the arrays, with the 
+ * coefficients and state held in local variables.
+ * 
+ * @note The filter state is kept between calls, so a signal can be filtered by consecutive blocks
+ * 
+ * @param filter            Filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IirFilterProcess(iir_filter_t * filter, float * input_signal, float * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Clear the state of a filter instance
+ * 
+ * @param filter        Filter instance
+ */
+void IirFilterReset(iir_filter_t * filter);
+
+/**
+ * @brief Apply a filter instance forward and backward to a signal array (zero-phase filtering)
+ * 
+ * The output has no phase distortion and the squared magnitude response of the filter. The signal 
+ * is extended at both ends by odd reflection (3 * (2 * sections + 1) samples, as scipy sosfiltfilt) 
+ * and each pass starts from the steady state for its first sample, to minimize edge transients. 
+ * The filter state used by IirFilterProcess() is not modified.
+ * 
+ * @param filter            Filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals (at least 2, IIR_FILTFILT_SCRATCH_SIZE(signal_lenght) up to INT16_MAX)
+ * @param scratch           Scratch buffer (of lenght = IIR_FILTFILT_SCRATCH_SIZE(signal_lenght)), can be shared between calls and filters
+ * @return true             Signal filtered
+ * @return false            Invalid lenght
+ */
+bool IirFilterFiltfilt(iir_filter_t * filter, const float * input_signal, float * output_signal, int16_t signal_lenght, float * scratch);
+
+/**
+ * @brief Quantize the coefficients of a filter instance into a fixed point (Q31) instance
+ * 
+ * @param filter        Filter instance (initialized)
+ * @param filter_q31    Fixed point filter instance (state cleared)
+ */
+void IirFilterToQ31(const iir_filter_t * filter, iir_filter_q31_t * filter_q31);
+
+/**
+ * @brief Apply a fixed point filter instance to a signal array
+ * 
+ * Samples are Q31 values (full int32_t range), the output is saturated. The accumulator of 
+ * each section is 64 bits wide.
+ * 
+ * @param filter            Fixed point filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IirFilterProcessQ31(iir_filter_q31_t * filter, int32_t * input_signal, int32_t * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Clear the state of a fixed point filter instance
+ * 
+ * @param filter        Fixed point filter instance
+ */
+void IirFilterResetQ31(iir_filter_q31_t * filter);
+
+/**
+ * @brief Initialize a fixed point (Q31) Butterworth filter instance
+ * 
+ * Coefficients are quantized from the same design used by IirFilterInit().
+ * 
+ * @param filter        Fixed point filter instance
+ * @param type          Filter's type (low pass or hi pass)
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ * @return true         Filter initialized (state cleared)
+ * @return false        Invalid order
+ */
+bool IirFilterInitQ31(iir_filter_q31_t * filter, filter_type_t type, float sample_frec, float cut_frec, filter_order_t order);
+
+/**
+ * @brief Apply a fixed point (Q31) filter instance to an array of raw ADC codes
+ * 
+ * Codes are centered and scaled to Q31 leaving IIR_ADC_GUARD_BITS of headroom, filtered, and 
+ * converted back to codes (rounded and saturated to the ADC range). Hi pass outputs are 
+ * centered at half the ADC range.
+ * 
+ * @param filter            Fixed point filter instance
+ * @param input_signal      Input ADC codes array
+ * @param output_signal     Filtered ADC codes array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IirFilterProcessAdcQ31(iir_filter_q31_t * filter, uint16_t * input_signal, uint16_t * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Quantize the coefficients of a filter instance into a fixed point (Q15) instance
+ * 
+ * @note Q14 coefficients and 16 bits state lose precision for cut-off frequencies below about 
+ * sample_frec / 50 (errors of tens of ADC codes), Q31 filters should be used in that case
+ * 
+ * @param filter        Filter instance (initialized)
+ * @param filter_q15    Fixed point filter instance (state cleared)
+ */
+void IirFilterToQ15(const iir_filter_t * filter, iir_filter_q15_t * filter_q15);
+
+/**
+ * @brief Initialize a fixed point (Q15) Butterworth filter instance
+ * 
+ * Coefficients are quantized from the same design used by IirFilterInit().
+ * 
+ * @param filter        Fixed point filter instance
+ * @param type          Filter's type (low pass or hi pass)
+ * @param sample_frec   Signal's sample frequency
+ * @param cut_frec      Filter's cut-off frequency
+ * @param order         Filter's order (2, 4, 6 or 8)
+ * @return true         Filter initialized (state cleared)
+ * @return false        Invalid order
+ */
+bool IirFilterInitQ15(iir_filter_q15_t * filter, filter_type_t type, float sample_frec, float cut_frec, filter_order_t order);
+
+/**
+ * @brief Apply a fixed point (Q15) filter instance to a signal array
+ * 
+ * Products are accumulated in 64 bits (guard bits above the 30 bits products), sections 
+ * outputs are saturated to the int16_t range.
+ * 
+ * @param filter            Fixed point filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IirFilterProcessQ15(iir_filter_q15_t * filter, int16_t * input_signal, int16_t * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Apply a fixed point (Q15) filter instance to an array of raw ADC codes
+ * 
+ * Codes are centered and scaled to Q15 leaving IIR_ADC_GUARD_BITS of headroom, filtered, and 
+ * converted back to codes (rounded and saturated to the ADC range). Hi pass outputs are 
+ * centered at half the ADC range.
+ * 
+ * @param filter            Fixed point filter instance
+ * @param input_signal      Input ADC codes array
+ * @param output_signal     Filtered ADC codes array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IirFilterProcessAdcQ15(iir_filter_q15_t * filter, uint16_t * input_signal, uint16_t * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Clear the state of a fixed point (Q15) filter instance
+ * 
+ * @param filter        Fixed point filter instance
+ */
+void IirFilterResetQ15(iir_filter_q15_t * filter);
+
+/**
+ * @brief Initialize a filter instance with a const coefficients table
+ * 
+ * Tables are generated at build time by tools/iir_coeff_gen.py (see tools/iir_coeff_gen.cmake), 
+ * so no coefficients are calculated at startup and none are stored in RAM.
+ * 
+ * @param filter        Filter instance
+ * @param coeff         Coefficients table (b0, b1, b2, a1, a2 of each section)
+ * @param n_sections    Number of sections of the table
+ * @return true         Filter initialized (state cleared)
+ * @return false        Invalid number of sections
+ */
+bool IirFilterInitConst(iir_filter_const_t * filter, const float (*coeff)[IIR_SOS_COEFF], uint8_t n_sections);
+
+/**
+ * @brief Apply a filter instance with a const coefficients table to a signal array
+ * 
+ * @param filter            Filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IirFilterProcessConst(iir_filter_const_t * filter, float * input_signal, float * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Clear the state of a filter instance with a const coefficients table
+ * 
+ * @param filter        Filter instance
+ */
+void IirFilterResetConst(iir_filter_const_t * filter);
+
+/**
+ * @brief Initialize a fixed point (Q31) filter instance with a const coefficients table
+ * 
+ * @param filter        Fixed point filter instance
+ * @param coeff         Coefficients table (b0, b1, b2, a1, a2 of each section, in Q30)
+ * @param n_sections    Number of sections of the table
+ * @return true         Filter initialized (state cleared)
+ * @return false        Invalid number of sections
+ */
+bool IirFilterInitConstQ31(iir_filter_const_q31_t * filter, const int32_t (*coeff)[IIR_SOS_COEFF], uint8_t n_sections);
+
+/**
+ * @brief Apply a fixed point (Q31) filter instance with a const coefficients table to a signal array
+ * 
+ * Same as IirFilterProcessQ31().
+ * 
+ * @param filter            Fixed point filter instance
+ * @param input_signal      Input signal array
+ * @param output_signal     Filtered signal array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IirFilterProcessConstQ31(iir_filter_const_q31_t * filter, int32_t * input_signal, int32_t * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Apply a fixed point (Q31) filter instance with a const coefficients table to an array of raw ADC codes
+ * 
+ * Same as IirFilterProcessAdcQ31().
+ * 
+ * @param filter            Fixed point filter instance
+ * @param input_signal      Input ADC codes array
+ * @param output_signal     Filtered ADC codes array (can be the same as input_signal)
+ * @param signal_lenght     Number of samples of both signals
+ */
+void IirFilterProcessAdcConstQ31(iir_filter_const_q31_t * filter, uint16_t * input_signal, uint16_t * output_signal, int16_t signal_lenght);
+
+/**
+ * @brief Clear the state of a fixed point (Q31) filter instance with a const coefficients table
+ * 
+ * @param filter        Fixed point filter instance
+ */
+void IirFilterResetConstQ31(iir_filter_const_q31_t * filter);
+
 /**
  * @brief Initialize a 2nd order Butterwotrh Low Pass Filter
  * 
@@ -52,7 +420,7 @@ void LowPassInit(float sample_frec, float cut_frec, filter_order_t order);
 void HiPassInit(float sample_frec, float cut_frec, filter_order_t order);
 
 /**
- * @brief Apply a low pass filter to a signal array
+ * @brief Apply the low pass filter initialized with LowPassInit() to a signal array
  * 
  * @param input_signal      Input signal array
  * @param output_signal     Filtered signal array
@@ -61,7 +429,7 @@ void HiPassInit(float sample_frec, float cut_frec, filter_order_t order);
 void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght);
 
 /**
- * @brief Apply a hi pass filter to a signal array
+ * @brief Apply the hi pass filter initialized with HiPassInit() to a signal array
  * 
  * @param input_signal      Input signal array
  * @param output_signal     Filtered signal array
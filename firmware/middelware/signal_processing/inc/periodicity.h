@@ -0,0 +1,132 @@
+#ifndef PERIODICITY_H_
+#define PERIODICITY_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Periodicity Periodicity Estimator
+ */
+
+/** \brief Autocorrelation based period (rate) estimator
+ * 
+ * Estimates the fundamental period of a stream (e.g. respiration or heart rate of noisy sensors)
+ * from the autocorrelation of its last lenght samples, every hop samples. The signal offset is
+ * removed with a DC blocker (cut-off at min_freq / 4) and the autocorrelation is only calculated
+ * for the lags of the min_freq to max_freq range. The period is taken from the first lobe with a
+ * maximum reaching PERIODICITY_PEAK_RATIO of the highest one (avoiding multiples of the period),
+ * at the lobe highest maximum refined with a parabolic interpolation. Wideband noise spreads
+ * the lobes, so band limiting the signal first (e.g. IirFilterProcess()) improves the estimate.
+ * 
+ * Two methods give the same autocorrelation values:
+ * - Direct (fft_lenght = 0): dsps_corr_f32 over the lags range. When hop is short compared to
+ *   lenght, the correlation is updated incrementally (samples entering and leaving the window,
+ *   2 * hop products per lag instead of lenght), with a full calculation once per window.
+ * - FFT (fft_lenght >= lenght + max lag + 1): two complex FFTs per estimate, for long windows
+ *   or wide lags ranges.
+ * 
+ * @section changelog
+ * 
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fft.h"
+/*==================[macros]=================================================*/
+#define PERIODICITY_PEAK_RATIO  0.7f    /*!< Fraction of the highest autocorrelation maximum accepted as the period */
+#define PERIODICITY_MAX_LAG(sample_freq, min_freq)  ((uint16_t)((sample_freq) / (min_freq)) + 1)    /*!< Longest lag (in samples) for a min_freq period */
+#define PERIODICITY_BUFFER_SIZE(lenght, hop, max_lag)   ((lenght) + (hop) + 3 * ((max_lag) + 2))     /*!< Floats needed by a direct method buffer */
+#define PERIODICITY_FFT_BUFFER_SIZE(fft_lenght, hop, max_lag)   (3 * (fft_lenght) + (hop) + (max_lag) + 2)  /*!< Floats needed by a FFT method buffer */
+/*==================[typedef]================================================*/
+/**
+ * @brief Periodicity estimator config structure
+ */
+typedef struct {
+    float sample_freq;          /*!< Sample frequency (Hz) */
+    float min_freq;             /*!< Lowest fundamental frequency (Hz) */
+    float max_freq;             /*!< Highest fundamental frequency (Hz, up to sample_freq / 4) */
+    uint16_t lenght;            /*!< Correlation window (samples, e.g. several periods of min_freq) */
+    uint16_t hop;               /*!< Samples between estimates */
+    uint16_t fft_lenght;        /*!< FFT lenght (power of two, up to MAX_SIGNAL_LENGHT), 0 for the direct method */
+} periodicity_config_t;
+
+/**
+ * @brief Period estimate
+ */
+typedef struct {
+    float period;               /*!< Fundamental period (s), 0 if no periodicity was found */
+    float freq;                 /*!< Fundamental frequency (Hz, e.g. * 60 for a rate per minute), 0 if no periodicity was found */
+    float confidence;           /*!< Normalized autocorrelation at the period (0 to 1) */
+} periodicity_estimate_t;
+
+/**
+ * @brief Periodicity estimator instance
+ */
+typedef struct {
+    float * history;            /*!< Last samples (DC removed): lags range, window and current hop */
+    float * corr;               /*!< Autocorrelation, indexed by lag (lag_lo to lag_hi) */
+    float * work;               /*!< dsps_corr_f32 output (direct) or FFT workspace (FFT) */
+    float corr0;                /*!< Window energy (lag 0) */
+    float sample_freq;          /*!< Sample frequency (Hz) */
+    float dc_pole;              /*!< DC blocker pole */
+    float dc_x;                 /*!< DC blocker last input */
+    float dc_y;                 /*!< DC blocker last output */
+    uint16_t lenght;            /*!< Correlation window (samples) */
+    uint16_t hop;               /*!< Samples between estimates */
+    uint16_t fft_lenght;        /*!< FFT lenght (0 for the direct method) */
+    uint16_t lag_lo;            /*!< Shortest lag calculated (one below the shortest period) */
+    uint16_t lag_hi;            /*!< Longest lag calculated (one above the longest period) */
+    uint16_t keep;              /*!< Samples kept between estimates */
+    uint16_t count;             /*!< Samples of the current hop */
+    uint32_t filled;            /*!< Samples received since the last reset (saturated at keep) */
+    uint32_t since_sync;        /*!< Samples since the last full calculation (direct method) */
+} periodicity_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a periodicity estimator instance
+ * 
+ * @note FFTInit() must be called before using the FFT method
+ * 
+ * @param period    Periodicity estimator instance
+ * @param config    Periodicity estimator config structure
+ * @param buffer    Array used for samples and autocorrelation (of lenght = PERIODICITY_BUFFER_SIZE(config->lenght,
+ *                  config->hop, PERIODICITY_MAX_LAG(config->sample_freq, config->min_freq)), or
+ *                  PERIODICITY_FFT_BUFFER_SIZE(config->fft_lenght, ...) for the FFT method)
+ * @return true     Periodicity estimator initialized
+ * @return false    Invalid frequencies or lenghts
+ */
+bool PeriodicityInit(periodicity_t * period, periodicity_config_t * config, float * buffer);
+
+/**
+ * @brief Add a block of samples, estimating the period every hop samples
+ * 
+ * No estimates are made until the window and the lags range are filled (lenght + max lag samples).
+ * 
+ * @param period    Periodicity estimator instance
+ * @param input     Input samples array
+ * @param lenght    Number of samples
+ * @param estimate  Last period estimate (only written when true is returned)
+ * @return true     At least one estimate was made
+ * @return false    No estimates
+ */
+bool PeriodicityProcess(periodicity_t * period, const float * input, uint16_t lenght, periodicity_estimate_t * estimate);
+
+/**
+ * @brief Discard the samples of a periodicity estimator instance
+ * 
+ * @param period    Periodicity estimator instance
+ */
+void PeriodicityReset(periodicity_t * period);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* PERIODICITY_H_ */
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,141 @@
+#ifndef QRS_DETECTOR_H_
+#define QRS_DETECTOR_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup QRS QRS Detector
+ */
+
+/** \brief Streaming QRS detector and heart rate (Pan-Tompkins)
+ * 
+ * Detects the QRS complexes of an ECG stream sampled at QRS_MIN_FREQ to QRS_MAX_FREQ, with
+ * the Pan-Tompkins chain: band-pass filter (5 to 15 Hz, integer moving sums scaled with the
+ * sample rate), derivative, squaring, 150 ms moving window integration and adaptive
+ * thresholds with search back of missed beats and T wave discrimination. Everything runs in
+ * integer arithmetic, with a bounded cost per sample (no loops over the signal history but
+ * the R peak search of each detected peak, up to 2 * 150 ms of samples).
+ * 
+ * Each beat is reported with the sample index of its R peak (located on the band-pass
+ * signal, delay compensated), the RR interval and the instantaneous heart rate. Beats are
+ * reported about 200 to 300 ms after their R peak. The first 2 seconds are used to learn the
+ * signal and noise levels, no beats are reported during them.
+ * 
+ * @section changelog
+ * 
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define QRS_MIN_FREQ    200     /*!< Lowest sample frequency (Hz) */
+#define QRS_MAX_FREQ    500     /*!< Highest sample frequency (Hz) */
+#define QRS_LP_MAX      (6 * QRS_MAX_FREQ / 200)        /*!< Longest low pass moving sum */
+#define QRS_HP_MAX      (32 * QRS_MAX_FREQ / 200 + 1)   /*!< Longest high pass moving sum (odd) */
+#define QRS_MWI_MAX     (15 * QRS_MAX_FREQ / 100)       /*!< Longest integration window (150 ms) */
+#define QRS_RING        (2 * QRS_MWI_MAX + 8)           /*!< Band-pass samples kept for the R peak search */
+#define QRS_RR_AVG      8       /*!< RR intervals averaged */
+/*==================[typedef]================================================*/
+/**
+ * @brief Detected beat
+ */
+typedef struct {
+    uint32_t r_sample;      /*!< Sample index of the R peak (since QrsDetectorInit()) */
+    uint32_t rr;            /*!< RR interval, in samples (0 for the first beat) */
+    uint16_t heart_rate;    /*!< Instantaneous heart rate, in beats per minute (0 for the first beat) */
+} qrs_beat_t;
+
+/**
+ * @brief QRS detector instance
+ */
+typedef struct {
+    uint16_t sample_freq;           /*!< Sample frequency (Hz) */
+    uint32_t n;                     /*!< Samples processed */
+    /* Band-pass filter: low pass (two moving sums) and high pass (delay minus moving average) */
+    int16_t lp_x[QRS_LP_MAX];       /*!< Low pass input samples */
+    int32_t lp_s[QRS_LP_MAX];       /*!< Low pass first moving sum samples */
+    int32_t lp_sum1;                /*!< Low pass first moving sum */
+    int32_t lp_sum2;                /*!< Low pass second moving sum */
+    uint8_t lp_len;                 /*!< Low pass moving sums lenght */
+    uint8_t lp_pos;                 /*!< Low pass oldest sample position */
+    int16_t hp_x[QRS_HP_MAX];       /*!< High pass input samples */
+    int32_t hp_sum;                 /*!< High pass moving sum */
+    uint8_t hp_len;                 /*!< High pass moving sum lenght */
+    uint8_t hp_pos;                 /*!< High pass oldest sample position */
+    int32_t ring[QRS_RING];         /*!< Band-pass samples (indexed by sample index) */
+    uint16_t bp_delay;              /*!< Band-pass filter delay (samples) */
+    /* Derivative, squaring and moving window integration */
+    int32_t d_x[4];                 /*!< Derivative input samples (newest first) */
+    uint32_t mwi_x[QRS_MWI_MAX];    /*!< Integration input samples */
+    uint32_t mwi_sum;               /*!< Integrated signal */
+    uint32_t mwi_last;              /*!< Previous integrated signal value */
+    uint8_t mwi_len;                /*!< Integration window lenght */
+    uint8_t mwi_pos;                /*!< Integration oldest sample position */
+    /* Peak detection and classification */
+    uint32_t peak;                  /*!< Current integrated signal peak (0 if none) */
+    uint32_t peak_n;                /*!< Sample index of the current peak */
+    bool falling;                   /*!< A peak was processed and the signal still falls */
+    uint32_t spk;                   /*!< Signal peaks level */
+    uint32_t npk;                   /*!< Noise peaks level */
+    uint32_t threshold;             /*!< Detection threshold (threshold / 2 for search back) */
+    uint32_t last_r;                /*!< Sample index of the last R peak (0 if none) */
+    uint32_t last_slope;            /*!< Maximum slope of the last QRS */
+    uint32_t cand_peak;             /*!< Largest noise peak above threshold / 2 since the last QRS (0 if none) */
+    uint32_t cand_r;                /*!< R peak sample index of the candidate */
+    uint32_t cand_slope;            /*!< Maximum slope of the candidate */
+    uint32_t rr[QRS_RR_AVG];        /*!< Last RR intervals */
+    uint32_t rr_regular[QRS_RR_AVG];/*!< Last RR intervals within 92% and 116% of their average */
+    uint32_t rr_avg;                /*!< Average of the last RR intervals */
+    uint32_t rr_regular_avg;        /*!< Average of the last regular RR intervals */
+    uint8_t rr_pos;                 /*!< Oldest RR interval position */
+    uint8_t rr_regular_pos;         /*!< Oldest regular RR interval position */
+    uint32_t learn_max;             /*!< Maximum of the integrated signal (learning phase) */
+    uint64_t learn_sum;             /*!< Sum of the integrated signal (learning phase) */
+} qrs_detector_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a QRS detector instance
+ * 
+ * @param qrs           QRS detector instance
+ * @param sample_freq   Sample frequency (QRS_MIN_FREQ to QRS_MAX_FREQ, in Hz)
+ * @return true         QRS detector initialized
+ * @return false        Invalid sample frequency
+ */
+bool QrsDetectorInit(qrs_detector_t * qrs, uint16_t sample_freq);
+
+/**
+ * @brief Process one ECG sample
+ * 
+ * @param qrs       QRS detector instance
+ * @param sample    ECG sample (12 bit ADC code, or any value within +-4095)
+ * @param beat      Detected beat (only written when true is returned)
+ * @return true     A beat was detected
+ * @return false    No beat
+ */
+bool QrsDetectorPush(qrs_detector_t * qrs, int16_t sample, qrs_beat_t * beat);
+
+/**
+ * @brief Process a block of ECG samples
+ * 
+ * @param qrs       QRS detector instance
+ * @param input     ECG samples array (12 bit ADC codes, or any value within +-4095)
+ * @param lenght    Number of samples
+ * @param beats     Array for the detected beats
+ * @param max_beats Lenght of the beats array (beats are discarded when full)
+ * @return uint16_t Number of detected beats
+ */
+uint16_t QrsDetectorProcess(qrs_detector_t * qrs, const int16_t * input, uint16_t lenght, qrs_beat_t * beats, uint16_t max_beats);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* QRS_DETECTOR_H_ */
+
+/*==================[end of file]============================================*/
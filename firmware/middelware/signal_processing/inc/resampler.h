@@ -0,0 +1,114 @@
+#ifndef RESAMPLER_H_
+#define RESAMPLER_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Resampler Resampler
+ */
+
+/** \brief Fractional (Farrow) resampler
+ * 
+ * Converts a stream at any sample rate to another one (e.g. HX711 at 10 SPS, MPU6050 at 200 Hz
+ * and ADC at 1 kHz to a common 100 Hz timeline), with cubic Lagrange interpolation evaluated in
+ * Farrow form. The output timeline is kept in 32.32 fixed point, so it does not drift from the
+ * input one, and the rates can be updated on the fly (e.g. with the measured rate of a sensor).
+ * 
+ * Interpolation does not filter: to reduce the rate by more than about 2, decimate or low-pass
+ * filter the stream first (decimator, iir_filter) to avoid aliasing. Output sample n is at
+ * n / output_freq seconds from the first input sample (plus the phase) for any input rate, so 
+ * streams started together are aligned; it is computed 2 input samples later (interpolator latency).
+ * 
+ * @section changelog
+ * 
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * | 17/10/2026 | Initial phase, to align streams started at different times			|
+ * | 17/10/2026 | Output timeline starts at the first input sample (any input rate)		|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+/*==================[macros]=================================================*/
+#define RESAMPLER_TAPS  4       /*!< Input samples used by the interpolator */
+/*==================[typedef]================================================*/
+/**
+ * @brief Resampler instance
+ */
+typedef struct {
+    float history[RESAMPLER_TAPS];  /*!< Last input samples (oldest first) */
+    int64_t position;               /*!< Time of the next output sample after history[1], in input samples (32.32 fixed point) */
+    uint64_t step;                  /*!< Output sample period, in input samples (32.32 fixed point) */
+    int64_t phase;                  /*!< Time of the first output sample after the first input one, in input samples (32.32 fixed point) */
+    bool primed;                    /*!< The history holds input samples */
+} resampler_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a resampler instance
+ * 
+ * @param resampler     Resampler instance
+ * @param input_freq    Input sample frequency (in Hz)
+ * @param output_freq   Output sample frequency (in Hz)
+ * @return true         Resampler initialized
+ * @return false        Invalid frequencies
+ */
+bool ResamplerInit(resampler_t * resampler, float input_freq, float output_freq);
+
+/**
+ * @brief Change the sample frequencies of a resampler instance, keeping its state (clock drift tracking)
+ * 
+ * @param resampler     Resampler instance
+ * @param input_freq    Input sample frequency (in Hz)
+ * @param output_freq   Output sample frequency (in Hz)
+ * @return true         Frequencies changed
+ * @return false        Invalid frequencies
+ */
+bool ResamplerSetFreq(resampler_t * resampler, float input_freq, float output_freq);
+
+/**
+ * @brief Set the time of the first output sample and restart a resampler instance
+ * 
+ * Aligns the output timeline of a stream that started later than the reference one: if the 
+ * first input sample arrives delay seconds after the reference start, the first output sample on 
+ * the common timeline is at ceil(delay * output_freq) / output_freq, so 
+ * phase = (ceil(delay * output_freq) / output_freq - delay) * input_freq.
+ * 
+ * @param resampler     Resampler instance
+ * @param phase         Time of the first output sample after the first input one (in input samples, >= 0)
+ * @return true         Phase set (history cleared)
+ * @return false        Invalid phase
+ */
+bool ResamplerSetPhase(resampler_t * resampler, float phase);
+
+/**
+ * @brief Resample a block of input samples
+ * 
+ * Blocks of any lenght can be pushed. The first sample after a reset fills the history (no
+ * startup transient from zero).
+ * 
+ * @param resampler     Resampler instance
+ * @param input         Input samples array
+ * @param output        Output samples array (of lenght >= lenght * output_freq / input_freq + 1)
+ * @param lenght        Number of input samples
+ * @return uint16_t     Number of output samples
+ */
+uint16_t ResamplerProcess(resampler_t * resampler, const float * input, float * output, uint16_t lenght);
+
+/**
+ * @brief Clear the history of a resampler instance (the phase is kept)
+ * 
+ * @param resampler     Resampler instance
+ */
+void ResamplerReset(resampler_t * resampler);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* RESAMPLER_H_ */
+
+/*==================[end of file]============================================*/
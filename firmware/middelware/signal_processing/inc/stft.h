@@ -0,0 +1,92 @@
+#ifndef STFT_H_
+#define STFT_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup STFT Short-Time Fourier Transform
+ */
+
+/** \brief Streaming Short-Time Fourier Transform (spectrogram)
+ * 
+ * Samples are pushed in chunks of any size. Every hop samples, once the window is full, 
+ * the magnitude spectrum of the last lenght samples is calculated and passed to a callback.
+ * 
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fft.h"
+/*==================[macros]=================================================*/
+#define STFT_BUFFER_SIZE(lenght)    (4 * (lenght) + (lenght) / 2)   /*!< Floats needed by a STFT buffer */
+/*==================[typedef]================================================*/
+/**
+ * @brief STFT config structure
+ */
+typedef struct {
+    uint16_t lenght;        /*!< Window lenght (power of two, up to MAX_SIGNAL_LENGHT) */
+    uint16_t hop;           /*!< Samples between frames (e.g. lenght / 2 for 50% overlap, lenght / 4 for 75%) */
+    fft_window_t window;    /*!< Window applied to each frame */
+    void *func_p;           /*!< Pointer to callback function called on each frame: void func(float * spectrum, uint16_t bins, void * param) */
+    void *param_p;          /*!< Pointer to callback function parameters */
+} stft_config_t;
+
+/**
+ * @brief STFT instance
+ */
+typedef struct {
+    fft_context_t fft;      /*!< FFT context (window and workspace) */
+    float * ring;           /*!< Ring buffer, stored twice so the last lenght samples are always contiguous */
+    float * spectrum;       /*!< Magnitude spectrum of the last frame (of lenght = lenght / 2) */
+    uint16_t hop;           /*!< Samples between frames */
+    uint16_t pos;           /*!< Position of the oldest sample in the ring buffer */
+    uint16_t filled;        /*!< Samples stored until the ring buffer is full */
+    uint16_t count;         /*!< Samples since the last frame */
+    void (*func_p)(float *, uint16_t, void *);  /*!< Frame callback */
+    void *param_p;          /*!< Frame callback parameters */
+} stft_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a STFT instance
+ * 
+ * @note FFTInit() must be called before
+ * 
+ * @param stft      STFT instance
+ * @param config    STFT config structure
+ * @param buffer    Array used for ring buffer, window, workspace and spectrum (of lenght = STFT_BUFFER_SIZE(config->lenght))
+ * @return true     STFT initialized
+ * @return false    Invalid lenght or hop
+ */
+bool STFTInit(stft_t * stft, stft_config_t * config, float * buffer);
+
+/**
+ * @brief Push samples into a STFT, calling the frame callback every hop samples
+ * 
+ * @param stft      STFT instance
+ * @param samples   Array of new samples
+ * @param n         Number of samples
+ */
+void STFTPush(stft_t * stft, const float * samples, uint16_t n);
+
+/**
+ * @brief Discard all stored samples
+ * 
+ * @param stft      STFT instance
+ */
+void STFTReset(stft_t * stft);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* STFT_H_ */
+
+/*==================[end of file]============================================*/
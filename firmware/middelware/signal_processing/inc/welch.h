@@ -0,0 +1,112 @@
+#ifndef WELCH_H_
+#define WELCH_H_
+/** \addtogroup Drivers_Programable Drivers Programable
+ ** @{ */
+/** \addtogroup Middelware Middelware
+ ** @{ */
+/** \addtogroup Welch Welch Power Spectral Density
+ */
+
+/** \brief Welch power spectral density estimator
+ * 
+ * Splits signal records in windowed segments (overlapped every hop samples) and averages their 
+ * power spectrum, linearly (all segments with the same weight) or exponentially (recent segments 
+ * weight more). The PSD is returned in units^2/Hz, for the FFTFrequency() bins axis.
+ * 
+ * @section changelog
+ *
+ * |   Date	    | Description                                    						|
+ * |:----------:|:----------------------------------------------------------------------|
+ * | 17/10/2026 | Document creation		                         						|
+ * 
+ **/
+
+/*==================[inclusions]=============================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "fft.h"
+/*==================[macros]=================================================*/
+#define WELCH_BUFFER_SIZE(lenght)   (2 * (lenght) + (lenght) / 2)   /*!< Floats needed by a Welch buffer */
+/*==================[typedef]================================================*/
+/**
+ * @brief Segments averaging
+ */
+typedef enum {
+    WELCH_LINEAR,           /*!< Mean of all segments since the last reset */
+    WELCH_EXPONENTIAL,      /*!< Exponential average: psd = (1 - alpha) * psd + alpha * new */
+} welch_average_t;
+
+/**
+ * @brief Welch config structure
+ */
+typedef struct {
+    uint16_t lenght;            /*!< Segment lenght (power of two, up to MAX_SIGNAL_LENGHT) */
+    uint16_t hop;               /*!< Samples between segments (e.g. lenght / 2 for 50% overlap) */
+    fft_window_t window;        /*!< Window applied to each segment */
+    welch_average_t average;    /*!< Segments averaging */
+    float alpha;                /*!< Weight of the new segment (exponential average only, 0 < alpha <= 1) */
+} welch_config_t;
+
+/**
+ * @brief Welch instance
+ */
+typedef struct {
+    fft_context_t fft;          /*!< FFT context (window and workspace) */
+    float * acc;                /*!< Accumulated power spectrum (of lenght = lenght / 2) */
+    uint16_t hop;               /*!< Samples between segments */
+    welch_average_t average;    /*!< Segments averaging */
+    float alpha;                /*!< Weight of the new segment (exponential average) */
+    float wind_power;           /*!< Sum of the squared window values */
+    uint32_t count;             /*!< Segments accumulated since the last reset */
+} welch_t;
+/*==================[external data declaration]==============================*/
+
+/*==================[external functions declaration]=========================*/
+/**
+ * @brief Initialize a Welch instance
+ * 
+ * @note FFTInit() must be called before
+ * 
+ * @param welch     Welch instance
+ * @param config    Welch config structure
+ * @param buffer    Array used for window, workspace and accumulator (of lenght = WELCH_BUFFER_SIZE(config->lenght))
+ * @return true     Welch initialized
+ * @return false    Invalid lenght, hop or alpha
+ */
+bool WelchInit(welch_t * welch, welch_config_t * config, float * buffer);
+
+/**
+ * @brief Add the segments of a signal record to the average
+ * 
+ * Segments start every hop samples, while they fit in the record (samples left are discarded).
+ * 
+ * @param welch     Welch instance
+ * @param signal    Array with signal values
+ * @param lenght    Number of samples (at least welch lenght)
+ * @return uint16_t Number of segments added
+ */
+uint16_t WelchAdd(welch_t * welch, float * signal, uint16_t lenght);
+
+/**
+ * @brief Calculate the power spectral density (single-sided) from the averaged segments
+ * 
+ * @param welch         Welch instance
+ * @param sample_freq   Sample frequency (in Hz)
+ * @param psd           Array for the PSD values, in units^2/Hz (of lenght = welch lenght / 2)
+ * @return uint32_t     Number of segments averaged (0 if none, psd is not modified)
+ */
+uint32_t WelchGetPSD(welch_t * welch, float sample_freq, float * psd);
+
+/**
+ * @brief Discard all accumulated segments
+ * 
+ * @param welch     Welch instance
+ */
+void WelchReset(welch_t * welch);
+
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+/** @} doxygen end group definition */
+#endif /* WELCH_H_ */
+
+/*==================[end of file]============================================*/
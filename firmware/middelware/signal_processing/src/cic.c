@@ -0,0 +1,135 @@
+/**
+ * @file cic.c
+ * @brief Cascaded integrator-comb (CIC) decimator with compensation FIR
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "cic.h"
+#include <math.h>
+/*==================[macros and definitions]=================================*/
+#define REGISTER_BITS   31      /*!< Usable bits of the (signed) CIC registers */
+#define COMP_STEPS      256     /*!< Integration steps of the compensation FIR design */
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+static float cic_response(cic_t * cic, float f);
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Normalized magnitude response of a CIC instance (unity DC gain)
+ * 
+ * @param cic       CIC instance
+ * @param f         Frequency, relative to the CIC output rate
+ * @return float    Magnitude response
+ */
+static float cic_response(cic_t * cic, float f){
+    if (f == 0){
+        return 1;
+    }
+    return powf(fabsf(sinf(M_PI * f) / (cic->factor * sinf(M_PI * f / cic->factor))), cic->order);
+}
+
+/*==================[external functions definition]==========================*/
+bool CicInit(cic_t * cic, cic_config_t * config){
+    float gain;
+    if (config->order == 0 || config->order > CIC_MAX_ORDER || config->factor == 0){
+        return false;
+    }
+    // Bit growth: factor^order, rounded up to a power of two
+    gain = powf(config->factor, config->order);
+    cic->shift = 0;
+    while ((float)(1UL << cic->shift) < gain){
+        cic->shift++;
+        if (config->input_bits + cic->shift > REGISTER_BITS){
+            return false;
+        }
+    }
+    cic->gain = gain / (1UL << cic->shift);
+    cic->factor = config->factor;
+    cic->order = config->order;
+    CicReset(cic);
+    return true;
+}
+
+uint16_t CicProcess(cic_t * cic, const int16_t * input, int16_t * output, uint16_t lenght){
+    uint16_t n_out = 0;
+    uint32_t y, aux;
+    for (uint16_t i = 0; i < lenght; i++){
+        // Integrators, at the input rate
+        cic->integ[0] += (uint32_t)(int32_t)input[i];
+        for (uint8_t k = 1; k < cic->order; k++){
+            cic->integ[k] += cic->integ[k - 1];
+        }
+        if (++cic->count < cic->factor){
+            continue;
+        }
+        // Combs, at the output rate
+        cic->count = 0;
+        y = cic->integ[cic->order - 1];
+        for (uint8_t k = 0; k < cic->order; k++){
+            aux = y;
+            y -= cic->comb[k];
+            cic->comb[k] = aux;
+        }
+        if (cic->shift > 0){
+            y += 1UL << (cic->shift - 1);
+        }
+        output[n_out++] = (int32_t)y >> cic->shift;
+    }
+    return n_out;
+}
+
+void CicReset(cic_t * cic){
+    for (uint8_t k = 0; k < CIC_MAX_ORDER; k++){
+        cic->integ[k] = 0;
+        cic->comb[k] = 0;
+    }
+    cic->count = 0;
+}
+
+bool CicCompensatorDesign(cic_t * cic, cic_comp_config_t * config, float * coeff){
+    float df = config->cut_freq / COMP_STEPS;
+    float f, inverse, sum = 0;
+    if (config->taps < 2 || config->taps > CIC_COMP_MAX_TAPS || config->factor == 0 || config->cut_freq <= 0 || config->cut_freq >= 0.5f){
+        return false;
+    }
+    for (uint16_t i = 0; i < config->taps; i++){
+        coeff[i] = 0;
+    }
+    // Inverse Fourier transform of 1 / CIC response (0 above cut_freq), midpoint rule
+    for (uint16_t j = 0; j < COMP_STEPS; j++){
+        f = (j + 0.5f) * df;
+        inverse = 1 / cic_response(cic, f);
+        for (uint16_t i = 0; i < config->taps; i++){
+            coeff[i] += inverse * cosf(2 * M_PI * f * (i - (config->taps - 1) / 2.0f));
+        }
+    }
+    // Hamming window
+    for (uint16_t i = 0; i < config->taps; i++){
+        coeff[i] *= 0.54f - 0.46f * cosf(2 * M_PI * i / (config->taps - 1));
+        sum += coeff[i];
+    }
+    // DC gain compensates the CIC gain (cascade with unity DC gain)
+    for (uint16_t i = 0; i < config->taps; i++){
+        coeff[i] = coeff[i] / (sum * cic->gain);
+    }
+    return true;
+}
+
+bool CicCompensatorInit(decimator_q15_t * comp, cic_t * cic, cic_comp_config_t * config, int16_t * buffer){
+    float coeff[CIC_COMP_MAX_TAPS];
+    if (!CicCompensatorDesign(cic, config, coeff)){
+        return false;
+    }
+    return DecimatorInitCoeffQ15(comp, coeff, config->taps, config->factor, buffer);
+}
+
+/*==================[end of file]============================================*/
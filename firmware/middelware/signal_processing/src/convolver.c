@@ -0,0 +1,110 @@
+/**
+ * @file convolver.c
+ * @brief Streaming FFT convolution (overlap-save)
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "convolver.h"
+#include <string.h>
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+static void convolve_frames(convolver_t * conv);
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Convolve the current pair of frames and keep the history for the next one
+ * 
+ * Frame A (input[0..N)) is the real part and frame B (input[step..step+N)) the imaginary part
+ * of one complex FFT. As the kernel is real, the inverse transform returns both convolutions
+ * in its real and imaginary parts. The inverse FFT is calculated as conj(FFT(conj(Y))) / N.
+ * 
+ * @param conv      Convolver instance
+ */
+static void convolve_frames(convolver_t * conv){
+    fc32_t * z = (fc32_t *)conv->work;
+    fc32_t * h = (fc32_t *)conv->spectrum;
+    uint16_t n = conv->fft_lenght;
+    uint16_t m = conv->kernel_lenght;
+    uint16_t step = conv->step;
+    float re;
+    for (uint16_t i = 0; i < n; i++){
+        z[i].re = conv->input[i];
+        z[i].im = conv->input[step + i];
+    }
+    dsps_fft2r_fc32(conv->work, n);
+    dsps_bit_rev_fc32(conv->work, n);
+    // conj(Z * H), spectrum is already scaled by 1 / N
+    for (uint16_t k = 0; k < n; k++){
+        re = z[k].re * h[k].re - z[k].im * h[k].im;
+        z[k].im = -(z[k].re * h[k].im + z[k].im * h[k].re);
+        z[k].re = re;
+    }
+    dsps_fft2r_fc32(conv->work, n);
+    dsps_bit_rev_fc32(conv->work, n);
+    // First kernel_lenght - 1 samples of each frame are circular (discarded)
+    for (uint16_t i = 0; i < step; i++){
+        conv->output[i] = z[m - 1 + i].re;
+        conv->output[step + i] = -z[m - 1 + i].im;
+    }
+    memmove(conv->input, &conv->input[2 * step], (m - 1) * sizeof(float));
+}
+
+/*==================[external functions definition]==========================*/
+bool ConvolverInit(convolver_t * conv, convolver_config_t * config, float * buffer){
+    uint16_t n = config->fft_lenght;
+    uint16_t m = config->kernel_lenght;
+    if (!dsp_is_power_of_two(n) || n > MAX_SIGNAL_LENGHT || m == 0 || m >= n){
+        return false;
+    }
+    // buffer layout: spectrum (2n) | workspace (2n) | input (n + step) | output (2 * step)
+    conv->fft_lenght = n;
+    conv->kernel_lenght = m;
+    conv->step = CONVOLVER_STEP(n, m);
+    conv->spectrum = buffer;
+    conv->work = &buffer[2 * n];
+    conv->input = &buffer[4 * n];
+    conv->output = &conv->input[n + conv->step];
+    // Kernel spectrum (zero padded, reversed for correlation)
+    memset(conv->spectrum, 0, 2 * n * sizeof(float));
+    for (uint16_t i = 0; i < m; i++){
+        conv->spectrum[2 * i] = config->correlation ? config->kernel[m - 1 - i] : config->kernel[i];
+    }
+    dsps_fft2r_fc32(conv->spectrum, n);
+    dsps_bit_rev_fc32(conv->spectrum, n);
+    for (uint16_t i = 0; i < 2 * n; i++){
+        conv->spectrum[i] = conv->spectrum[i] / n;
+    }
+    ConvolverReset(conv);
+    return true;
+}
+
+void ConvolverProcess(convolver_t * conv, const float * input, float * output, uint16_t lenght){
+    float x;
+    for (uint16_t i = 0; i < lenght; i++){
+        x = input[i];
+        output[i] = conv->output[conv->count];
+        conv->input[conv->kernel_lenght - 1 + conv->count] = x;
+        if (++conv->count == 2 * conv->step){
+            convolve_frames(conv);
+            conv->count = 0;
+        }
+    }
+}
+
+void ConvolverReset(convolver_t * conv){
+    memset(conv->input, 0, (conv->fft_lenght + 3 * conv->step) * sizeof(float));
+    conv->count = 0;
+}
+
+/*==================[end of file]============================================*/
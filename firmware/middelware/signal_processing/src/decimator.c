@@ -0,0 +1,247 @@
+/**
+ * @file decimator.c
+ * @brief Polyphase FIR decimation stage
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include "decimator.h"
+#include <math.h>
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define DEFAULT_CUT     0.4f    /*!< Default cutoff frequency (relative to the output rate) */
+#define COEFF_Q15_ONE   32768   /*!< Unity in Q15 */
+#define COEFF_Q15_GAIN  INT16_MAX   /*!< DC gain of the designed Q15 filters (largest Q15 coefficient, a single tap filter must fit) */
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+static float cut_frequency(decimator_config_t * config);
+static float windowed_sinc(uint16_t i, uint16_t taps, float fc);
+static bool quantize_q15(float value, float scale, int16_t * coeff);
+static bool init_q15(decimator_q15_t * decimator, int16_t * buffer, uint16_t taps, uint16_t factor, int32_t sum_q15, int32_t gain_q15);
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Normalized cutoff frequency of a decimator (relative to the input rate)
+ *
+ * @param config    Decimator config structure
+ * @return float    Cutoff frequency (0 if invalid)
+ */
+static float cut_frequency(decimator_config_t * config){
+    float fc;
+    if (config->factor == 0 || config->taps < 2 || config->sample_freq <= 0){
+        return 0;
+    }
+    if (config->cut_freq > 0){
+        fc = config->cut_freq / config->sample_freq;
+    } else {
+        fc = DEFAULT_CUT / config->factor;
+    }
+    if (fc >= 0.5f){
+        return 0;
+    }
+    return fc;
+}
+
+/**
+ * @brief Coefficient of a Blackman windowed sinc low-pass filter (not normalized)
+ *
+ * @param i         Coefficient index
+ * @param taps      Filter lenght
+ * @param fc        Normalized cutoff frequency
+ * @return float    Coefficient value
+ */
+static float windowed_sinc(uint16_t i, uint16_t taps, float fc){
+    float t = i - (taps - 1) / 2.0f;
+    float phase = 2 * M_PI * i / (taps - 1);
+    float sinc = (t == 0) ? 2 * fc : sinf(2 * M_PI * fc * t) / (M_PI * t);
+    return sinc * (0.42f - 0.5f * cosf(phase) + 0.08f * cosf(2 * phase));
+}
+
+/**
+ * @brief Quantize a coefficient to Q15
+ *
+ * @param value     Coefficient
+ * @param scale     Scale to Q15
+ * @param coeff     Quantized coefficient
+ * @return true     Coefficient quantized
+ * @return false    Out of the int16_t range
+ */
+static bool quantize_q15(float value, float scale, int16_t * coeff){
+    long q = lroundf(value * scale);
+    if (q < INT16_MIN || q > INT16_MAX){
+        return false;
+    }
+    *coeff = q;
+    return true;
+}
+
+/**
+ * @brief Fix the rounding of the Q15 coefficients and initialize the esp-dsp decimation FIR
+ *
+ * @param decimator Decimator instance
+ * @param buffer    Decimator buffer, with the Q15 coefficients at the beginning
+ * @param taps      Filter lenght
+ * @param factor    Decimation factor
+ * @param sum_q15   Sum of the rounded coefficients
+ * @param gain_q15  Required DC gain (sum of the coefficients)
+ * @return true     Decimator initialized
+ * @return false    Invalid lenght or factor, or corrected center coefficient out of the int16_t range
+ */
+static bool init_q15(decimator_q15_t * decimator, int16_t * buffer, uint16_t taps, uint16_t factor, int32_t sum_q15, int32_t gain_q15){
+    // Rounding error to the center coefficient, for an exact DC gain
+    int32_t center = buffer[taps / 2] + gain_q15 - sum_q15;
+    if (center < INT16_MIN || center > INT16_MAX){
+        return false;
+    }
+    buffer[taps / 2] = center;
+    // buffer layout: coefficients (taps) | delay line (taps) | pending (factor)
+    if (dsps_fird_init_s16(&decimator->fir, buffer, &buffer[taps], taps, factor, 0, 0) != ESP_OK){
+        return false;
+    }
+    decimator->pending = &buffer[2 * taps];
+    decimator->count = 0;
+    return true;
+}
+
+/*==================[external functions definition]==========================*/
+bool DecimatorDesign(decimator_config_t * config, float * coeff){
+    float fc = cut_frequency(config);
+    float sum = 0;
+    if (fc == 0){
+        return false;
+    }
+    for (uint16_t i = 0; i < config->taps; i++){
+        coeff[i] = windowed_sinc(i, config->taps, fc);
+        sum += coeff[i];
+    }
+    for (uint16_t i = 0; i < config->taps; i++){
+        coeff[i] = coeff[i] / sum;
+    }
+    return true;
+}
+
+bool DecimatorInit(decimator_t * decimator, decimator_config_t * config, float * buffer){
+    // buffer layout: coefficients (taps) | delay line (taps) | pending (factor)
+    if (!DecimatorDesign(config, buffer)){
+        return false;
+    }
+    // The coefficients are symmetric, the reversed order used by dsps_fird_f32 does not matter
+    if (dsps_fird_init_f32(&decimator->fir, buffer, &buffer[config->taps], config->taps, config->factor) != ESP_OK){
+        return false;
+    }
+    decimator->pending = &buffer[2 * config->taps];
+    decimator->count = 0;
+    return true;
+}
+
+uint16_t DecimatorProcess(decimator_t * decimator, const float * input, float * output, uint16_t lenght){
+    uint16_t factor = decimator->fir.decim;
+    uint16_t n_out = 0;
+    uint16_t i = 0;
+    uint16_t blocks;
+    // Complete the output started by the previous block
+    if (decimator->count > 0){
+        while (decimator->count < factor && i < lenght){
+            decimator->pending[decimator->count++] = input[i++];
+        }
+        if (decimator->count < factor){
+            return 0;
+        }
+        n_out = dsps_fird_f32(&decimator->fir, decimator->pending, output, 1);
+        decimator->count = 0;
+    }
+    blocks = (lenght - i) / factor;
+    n_out += dsps_fird_f32(&decimator->fir, &input[i], &output[n_out], blocks);
+    i += blocks * factor;
+    while (i < lenght){
+        decimator->pending[decimator->count++] = input[i++];
+    }
+    return n_out;
+}
+
+void DecimatorReset(decimator_t * decimator){
+    for (uint16_t i = 0; i < decimator->fir.N; i++){
+        decimator->fir.delay[i] = 0;
+    }
+    decimator->fir.pos = 0;
+    decimator->count = 0;
+}
+
+bool DecimatorInitQ15(decimator_q15_t * decimator, decimator_config_t * config, int16_t * buffer){
+    float fc = cut_frequency(config);
+    float sum = 0;
+    int32_t sum_q15 = 0;
+    if (fc == 0){
+        return false;
+    }
+    for (uint16_t i = 0; i < config->taps; i++){
+        sum += windowed_sinc(i, config->taps, fc);
+    }
+    for (uint16_t i = 0; i < config->taps; i++){
+        if (!quantize_q15(windowed_sinc(i, config->taps, fc), COEFF_Q15_GAIN / sum, &buffer[i])){
+            return false;
+        }
+        sum_q15 += buffer[i];
+    }
+    return init_q15(decimator, buffer, config->taps, config->factor, sum_q15, COEFF_Q15_GAIN);
+}
+
+bool DecimatorInitCoeffQ15(decimator_q15_t * decimator, const float * coeff, uint16_t taps, uint16_t factor, int16_t * buffer){
+    float sum = 0;
+    int32_t sum_q15 = 0;
+    if (factor == 0){
+        return false;
+    }
+    for (uint16_t i = 0; i < taps; i++){
+        if (!quantize_q15(coeff[i], COEFF_Q15_ONE, &buffer[i])){
+            return false;
+        }
+        sum_q15 += buffer[i];
+        sum += coeff[i];
+    }
+    return init_q15(decimator, buffer, taps, factor, sum_q15, lroundf(sum * COEFF_Q15_ONE));
+}
+
+uint16_t DecimatorProcessQ15(decimator_q15_t * decimator, const int16_t * input, int16_t * output, uint16_t lenght){
+    uint16_t factor = decimator->fir.decim;
+    uint16_t n_out = 0;
+    uint16_t i = 0;
+    uint16_t blocks;
+    // Complete the output started by the previous block
+    if (decimator->count > 0){
+        while (decimator->count < factor && i < lenght){
+            decimator->pending[decimator->count++] = input[i++];
+        }
+        if (decimator->count < factor){
+            return 0;
+        }
+        n_out = dsps_fird_s16(&decimator->fir, decimator->pending, output, 1);
+        decimator->count = 0;
+    }
+    blocks = (lenght - i) / factor;
+    n_out += dsps_fird_s16(&decimator->fir, &input[i], &output[n_out], blocks);
+    i += blocks * factor;
+    while (i < lenght){
+        decimator->pending[decimator->count++] = input[i++];
+    }
+    return n_out;
+}
+
+void DecimatorResetQ15(decimator_q15_t * decimator){
+    for (uint16_t i = 0; i < decimator->fir.coeffs_len; i++){
+        decimator->fir.delay[i] = 0;
+    }
+    decimator->fir.pos = 0;
+    decimator->fir.d_pos = 0;
+    decimator->count = 0;
+}
+
+/*==================[end of file]============================================*/
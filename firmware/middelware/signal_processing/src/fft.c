@@ -13,50 +13,381 @@
 #include <string.h>
 #include <math.h>
 #include "fft.h"
+#include "fft_tables.h"
 #include "esp_dsp.h"
 #include "esp_log.h"
 /*==================[macros and definitions]=================================*/
 #define TAG "FFT Module"
+#define ADC_TO_Q15_SHIFT    3   // 12 bit ADC codes to Q15 full scale
 /*==================[internal data declaration]==============================*/
-static float fft_complex[2 * MAX_SIGNAL_LENGHT];
+static float fft_complex[FFT_WORK_SIZE(MAX_SIGNAL_LENGHT)];
 static float wind[MAX_SIGNAL_LENGHT];
+static fft_context_t fft_default_ctx = {.lenght = 0};   // Context used by FFTMagnitude()
+static int16_t fft_complex_q15[2 * MAX_SIGNAL_LENGHT];
 /*==================[internal functions declaration]=========================*/
+static uint32_t isqrt32(uint32_t x);
+static inline uint16_t fft_input_index(fft_context_t * ctx, uint16_t i, uint16_t n);
+static void fft_transform(fft_context_t * ctx, float * data, uint16_t n);
+static void fft_real_transform(fft_context_t * ctx, float * signal);
+static void interpolate_peak(const float * fft, fft_peak_t * peak, fft_interp_t interp, float freq_step);
 
 /*==================[internal data definition]===============================*/
 
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Integer square root (bit by bit, no multiplications)
+ * 
+ * @param x     Radicand
+ * @return      floor(sqrt(x))
+ */
+static uint32_t isqrt32(uint32_t x){
+    uint32_t res = 0;
+    uint32_t bit = 1UL << 30;
+    while(bit > x){
+        bit >>= 2;
+    }
+    while(bit != 0){
+        if(x >= res + bit){
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else{
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+/**
+ * @brief Position of an input point in the workspace of a transform
+ * 
+ * The mixed radix transform (lenghts that are not a power of four) needs the even points in 
+ * the first half of the workspace and the odd points in the second half, so input arrays are 
+ * reordered while they are copied (and windowed) into the workspace.
+ * 
+ * @param ctx   FFT context
+ * @param i     Input point index
+ * @param n     Transform lenght (complex points)
+ * @return      Workspace point index
+ */
+static inline uint16_t fft_input_index(fft_context_t * ctx, uint16_t i, uint16_t n){
+    if (ctx->radix == FFT_RADIX_4 && (dsp_power_of_two(n) & 1)){
+        return (i & 1) ? n / 2 + i / 2 : i / 2;
+    }
+    return i;
+}
+
+/**
+ * @brief Complex FFT of the workspace, with the result in natural order
+ * 
+ * Radix-4 lenghts that are not a power of four are calculated as two radix-4 transforms of 
+ * n/2 points (even points E and odd points O, see fft_input_index()) and a radix-2 stage: 
+ * X[k] = E[k] + W^k * O[k], X[k + n/2] = E[k] - W^k * O[k].
+ * 
+ * @param ctx   FFT context
+ * @param data  Complex array (of lenght = n), input ordered by fft_input_index()
+ * @param n     Transform lenght (complex points)
+ */
+static void fft_transform(fft_context_t * ctx, float * data, uint16_t n){
+    fc32_t * e = (fc32_t *)data;
+    fc32_t * o = &e[n / 2];
+    // Radix-4 twiddle table holds W^i = (cos, sin)(2 * pi * i / dsps_fft4r_w_table_size), in natural order
+    fc32_t * w_table = (fc32_t *)dsps_fft4r_w_table_fc32;
+    uint16_t w_step = dsps_fft4r_w_table_size / n;
+    fc32_t t, w;
+    if (ctx->radix == FFT_RADIX_2){
+        dsps_fft2r_fc32(data, n);
+        dsps_bit_rev_fc32(data, n);
+        return;
+    }
+    if ((dsp_power_of_two(n) & 1) == 0){
+        dsps_fft4r_fc32(data, n);
+        dsps_bit_rev4r_fc32(data, n);
+        return;
+    }
+    dsps_fft4r_fc32(data, n / 2);
+    dsps_bit_rev4r_fc32(data, n / 2);
+    dsps_fft4r_fc32(&data[n], n / 2);
+    dsps_bit_rev4r_fc32(&data[n], n / 2);
+    for (uint16_t k = 0; k < n / 2; k++){
+        w = w_table[k * w_step];
+        t.re = w.re * o[k].re + w.im * o[k].im;
+        t.im = w.re * o[k].im - w.im * o[k].re;
+        o[k].re = e[k].re - t.re;
+        o[k].im = e[k].im - t.im;
+        e[k].re += t.re;
+        e[k].im += t.im;
+    }
+}
+
+/**
+ * @brief Windowed FFT of a real signal, calculated as a N/2 points complex FFT
+ * 
+ * @note Leaves 2 * X[k] (for k < N/2) in the context workspace, as complex values.
+ * 
+ * @param ctx       FFT context
+ * @param signal    Array with signal values (of lenght = ctx->lenght)
+ */
+static void fft_real_transform(fft_context_t * ctx, float * signal){
+    fc32_t * z = (fc32_t *)ctx->work;
+    // Radix-4 twiddle table (natural order) is used for both radixes, no bit reversed indexes
+    fc32_t * w_table = (fc32_t *)dsps_fft4r_w_table_fc32;
+    uint16_t n = ctx->lenght;
+    uint16_t m = n / 2;
+    uint16_t w_step = dsps_fft4r_w_table_size / n;
+    fc32_t zk, zc, e, o, t, w;
+    uint16_t j;
+    // Multiply input array with window, consecutive samples are packed as real and imaginary parts
+    for (int i = 0; i < m; i++){
+        j = fft_input_index(ctx, i, m);
+        z[j].re = signal[2 * i] * ctx->wind[2 * i];
+        z[j].im = signal[2 * i + 1] * ctx->wind[2 * i + 1];
+    }
+    // Calculate N/2 points FFT (natural order)
+    fft_transform(ctx, ctx->work, m);
+    // Split into the spectrum of the real signal, in place and by pairs (k, m-k):
+    // 2X[k] = E[k] + W^k * O[k], E[k] = Z[k] + Z*[m-k], O[k] = (Z[k] - Z*[m-k]) / j
+    // 2X[m-k] = (E[k] - W^k * O[k])*
+    z[0].re = 2 * (z[0].re + z[0].im);
+    z[0].im = 0;
+    for (int k = 1; k <= m / 2; k++){
+        zk = z[k];
+        zc.re = z[m - k].re;
+        zc.im = -z[m - k].im;
+        e.re = zk.re + zc.re;
+        e.im = zk.im + zc.im;
+        o.re = zk.im - zc.im;
+        o.im = zc.re - zk.re;
+        w = w_table[k * w_step];
+        t.re = w.re * o.re + w.im * o.im;
+        t.im = w.re * o.im - w.im * o.re;
+        z[m - k].re = e.re - t.re;
+        z[m - k].im = t.im - e.im;
+        z[k].re = e.re + t.re;
+        z[k].im = e.im + t.im;
+    }
+}
+
+/**
+ * @brief Sub-bin frequency and amplitude of a spectral peak
+ * 
+ * Fits a parabola through the peak bin and its neighbours (magnitudes or log magnitudes):
+ * delta = (a - c) / (2 * (a - 2b + c)), peak = b - (a - c) * delta / 4.
+ * 
+ * @param fft           Array with FFT magnitude values
+ * @param peak          Peak (bin as input, frequency and amplitude as output)
+ * @param interp        Sub-bin interpolation
+ * @param freq_step     Frequency between bins (in Hz)
+ */
+static void interpolate_peak(const float * fft, fft_peak_t * peak, fft_interp_t interp, float freq_step){
+    float a = fft[peak->bin - 1];
+    float b = fft[peak->bin];
+    float c = fft[peak->bin + 1];
+    float d, delta = 0;
+    if (interp == FFT_INTERP_GAUSSIAN){
+        if (a > 0 && c > 0){
+            a = logf(a);
+            b = logf(b);
+            c = logf(c);
+        } else {
+            interp = FFT_INTERP_PARABOLIC;
+        }
+    }
+    d = a - 2 * b + c;
+    if (d < 0){
+        delta = 0.5f * (a - c) / d;
+        b -= 0.25f * (a - c) * delta;
+    }
+    peak->freq = (peak->bin + delta) * freq_step;
+    peak->amplitude = (interp == FFT_INTERP_GAUSSIAN) ? expf(b) : b;
+}
 
 /*==================[external functions definition]==========================*/
 bool FFTInit(void){
-    esp_err_t ret = dsps_fft2r_init_fc32(NULL, CONFIG_DSP_MAX_FFT_SIZE);
-    if (ret != ESP_OK){
-        return false;
+    // dsps_fft2r_init_fc32() and dsps_fft4r_init_fc32() always calculate their tables (in RAM),
+    // the const tables are set directly as the transforms only read them
+    if (!dsps_fft2r_initialized){
+        dsps_fft_w_table_fc32 = (float *)fft_w_table_r2;
+        dsps_fft_w_table_size = MAX_SIGNAL_LENGHT;
+        dsps_fft2r_initialized = 1;
+    }
+    if (!dsps_fft4r_initialized){
+        dsps_fft4r_w_table_fc32 = (float *)fft_w_table_r4;
+        dsps_fft4r_w_table_size = MAX_SIGNAL_LENGHT;
+        dsps_fft4r_initialized = 1;
     }
     return true;
 }
 
 void FFTMagnitude(float * signal, float * fft, uint16_t signal_lenght){
-    // Generate Hann window
-    dsps_wind_hann_f32(wind, signal_lenght);
-    // Clear fft array
-    memset(fft_complex, 0, 2 * MAX_SIGNAL_LENGHT * sizeof(float));
+    // Window is only recalculated when the lenght changes
+    if (fft_default_ctx.lenght != signal_lenght){
+        if (!FFTContextInit(&fft_default_ctx, signal_lenght, FFT_WINDOW_HANN, wind, fft_complex)){
+            // Invalid lenght: fft is not written and the next call recalculates the window
+            fft_default_ctx.lenght = 0;
+            return;
+        }
+    }
+    FFTContextMagnitude(&fft_default_ctx, signal, fft);
+}
+
+bool FFTContextInit(fft_context_t * ctx, uint16_t signal_lenght, fft_window_t window, float * wind, float * work){
+    if (!dsp_is_power_of_two(signal_lenght) || signal_lenght > MAX_SIGNAL_LENGHT){
+        ESP_LOGE(TAG, "Invalid signal lenght: %d", signal_lenght);
+        return false;
+    }
+    ctx->lenght = signal_lenght;
+    ctx->window = window;
+    ctx->radix = FFT_RADIX_4;
+    ctx->wind = wind;
+    ctx->work = work;
+    switch (window){
+        case FFT_WINDOW_RECT:
+            for (int i = 0; i < signal_lenght; i++){
+                wind[i] = 1;
+            }
+        break;
+        case FFT_WINDOW_HANN:
+            dsps_wind_hann_f32(wind, signal_lenght);
+        break;
+        case FFT_WINDOW_BLACKMAN:
+            dsps_wind_blackman_f32(wind, signal_lenght);
+        break;
+        case FFT_WINDOW_BLACKMAN_HARRIS:
+            dsps_wind_blackman_harris_f32(wind, signal_lenght);
+        break;
+        case FFT_WINDOW_FLAT_TOP:
+            dsps_wind_flat_top_f32(wind, signal_lenght);
+        break;
+    }
+    return true;
+}
+
+void FFTContextSetRadix(fft_context_t * ctx, fft_radix_t radix){
+    ctx->radix = radix;
+}
+
+void FFTContextMagnitude(fft_context_t * ctx, float * signal, float * fft){
+    float * work = ctx->work;
+    uint16_t n = ctx->lenght;
+    uint16_t j;
+    // Multiply input array with window and store as real part, clearing imaginary part
+    for (int i = 0; i < n; i++){
+        j = fft_input_index(ctx, i, n);
+        work[2 * j] = signal[i] * ctx->wind[i];
+        work[2 * j + 1] = 0;
+    }
+    // Calculate FFT (natural order)
+    fft_transform(ctx, work, n);
+    // Convert one complex vector to two complex vectors
+    dsps_cplx2reC_fc32(work, n);
+    // Calculate FFT magnitude (only the single-sided half is needed)
+    for (int j = 0; j < n / 2; j++){
+        fft[j] = 2 * sqrtf(work[j * 2 + 0] * work[j * 2 + 0] + work[j * 2 + 1] * work[j * 2 + 1]) / (n / 2);
+    }
+    fft[0] = fft[0] / 2;
+}
+
+void FFTContextMagnitudeReal(fft_context_t * ctx, float * signal, float * fft){
+    fc32_t * x = (fc32_t *)ctx->work;
+    uint16_t n = ctx->lenght;
+    fft_real_transform(ctx, signal);
+    // 2 * |X[k]| / (N/2), as FFTMagnitude() (workspace holds 2 * X[k])
+    for (int k = 0; k < n / 2; k++){
+        fft[k] = 2 * sqrtf(x[k].re * x[k].re + x[k].im * x[k].im) / (n / 2);
+    }
+    // FFTMagnitude() DC is |X[0]| / (N/2), workspace holds 2 * X[0] as every other bin
+    fft[0] = fft[0] / 4;
+}
+
+void FFTContextPowerAccumulate(fft_context_t * ctx, float * signal, float * power, float a, float b){
+    fc32_t * x = (fc32_t *)ctx->work;
+    // Workspace holds 2 * X[k], so |X[k]|^2 = |2 * X[k]|^2 / 4
+    b = b / 4;
+    fft_real_transform(ctx, signal);
+    for (int k = 0; k < ctx->lenght / 2; k++){
+        power[k] = a * power[k] + b * (x[k].re * x[k].re + x[k].im * x[k].im);
+    }
+}
+
+bool FFTInitQ15(void){
+    // Same as FFTInit(), dsps_fft2r_init_sc16() would calculate the table in RAM
+    if (!dsps_fft2r_sc16_initialized){
+        dsps_fft_w_table_sc16 = (int16_t *)fft_w_table_sc16;
+        dsps_fft_w_table_sc16_size = MAX_SIGNAL_LENGHT;
+        dsps_fft2r_sc16_initialized = 1;
+    }
+    return true;
+}
+
+void FFTMagnitudeQ15(uint16_t * signal, uint16_t * fft, uint16_t signal_lenght){
+    uint32_t sum = 0;
+    uint16_t mean, wind_step = MAX_SIGNAL_LENGHT / signal_lenght;
+    int32_t re, im;
+    int16_t w;
+    // Remove mean, so the whole Q15 range is used by the signal components
+    for (int i = 0; i < signal_lenght; i++){
+        sum += signal[i];
+    }
+    mean = sum / signal_lenght;
     // Multiply input array with window and store as real part
-    dsps_mul_f32(signal, wind, fft_complex, signal_lenght, 1, 1, 2);    
-    // Calculate FFT  
-    dsps_fft2r_fc32(fft_complex, signal_lenght);
+    for (int i = 0; i < signal_lenght; i++){
+        // Hann window is symmetric and a length N window is the MAX_SIGNAL_LENGHT one
+        // decimated by MAX_SIGNAL_LENGHT / N, so half a table serves every length
+        w = (i <= signal_lenght / 2) ? fft_hann_q15[i * wind_step] : fft_hann_q15[(signal_lenght - i) * wind_step];
+        fft_complex_q15[2 * i] = (((int32_t)signal[i] - mean) * (w << ADC_TO_Q15_SHIFT)) >> 15;
+        fft_complex_q15[2 * i + 1] = 0;
+    }
+    // Calculate FFT (each stage is scaled by 1/2, so the result is divided by signal_lenght)
+    dsps_fft2r_sc16_ansi(fft_complex_q15, signal_lenght);
     // Bit reverse
-    dsps_bit_rev_fc32(fft_complex, signal_lenght);
-    // Convert one complex vector to two complex vectors
-    dsps_cplx2reC_fc32(fft_complex, signal_lenght);
-    // Calculate FFT magnitude 
-    for (int j = 0; j < signal_lenght; j++){
-            fft_complex[j] = 2*(sqrt(fft_complex[j*2+0]*fft_complex[j*2+0] + fft_complex[j*2+1]*fft_complex[j*2+1])) / (signal_lenght/2);
-    }
-    fft_complex[0] = fft_complex[0] / 2;
-    // Copy result in fft array
-    memcpy(fft, fft_complex, (signal_lenght / 2) * sizeof(float));
+    dsps_bit_rev_sc16_ansi(fft_complex_q15, signal_lenght);
+    // Calculate FFT magnitude (already in ADC codes: 2^ADC_TO_Q15_SHIFT * hann gain / 2 = 1)
+    fft[0] = mean;
+    for (int j = 1; j < signal_lenght / 2; j++){
+        re = fft_complex_q15[2 * j];
+        im = fft_complex_q15[2 * j + 1];
+        fft[j] = isqrt32(re * re + im * im);
+    }
+}
+
+uint16_t FFTPeaks(const float * fft, uint16_t signal_lenght, float sample_freq, float threshold, fft_interp_t interp, fft_peak_t * peaks, uint16_t max_peaks){
+    uint16_t n_peaks = 0;
+    uint16_t i;
+    if (max_peaks == 0){
+        return 0;
+    }
+    for (uint16_t k = 1; k < signal_lenght / 2 - 1; k++){
+        if (fft[k] <= threshold || fft[k] <= fft[k - 1] || fft[k] < fft[k + 1]){
+            continue;
+        }
+        // Insertion in the sorted list (the smallest peak is dropped when full)
+        if (n_peaks == max_peaks){
+            if (fft[k] <= fft[peaks[n_peaks - 1].bin]){
+                continue;
+            }
+            n_peaks--;
+        }
+        for (i = n_peaks; i > 0 && fft[peaks[i - 1].bin] < fft[k]; i--){
+            peaks[i].bin = peaks[i - 1].bin;
+        }
+        peaks[i].bin = k;
+        n_peaks++;
+    }
+    for (i = 0; i < n_peaks; i++){
+        interpolate_peak(fft, &peaks[i], interp, sample_freq / signal_lenght);
+    }
+    return n_peaks;
+}
+
+uint16_t FFTContextPeaks(fft_context_t * ctx, const float * fft, float sample_freq, float threshold, fft_peak_t * peaks, uint16_t max_peaks){
+    fft_interp_t interp = FFT_INTERP_PARABOLIC;
+    if (ctx->window == FFT_WINDOW_HANN || ctx->window == FFT_WINDOW_BLACKMAN || ctx->window == FFT_WINDOW_BLACKMAN_HARRIS){
+        interp = FFT_INTERP_GAUSSIAN;
+    }
+    return FFTPeaks(fft, ctx->lenght, sample_freq, threshold, interp, peaks, max_peaks);
 }
 
 void FFTFrequency(float sample_freq, uint16_t signal_lenght, float * f){
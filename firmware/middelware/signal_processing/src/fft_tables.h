@@ -0,0 +1,2212 @@
+/* Generated by fft_table_gen.py, do not edit */
+/* --size 256 --size 512 --size 1024 --size 2048 */
+#ifndef FFT_TABLES_H_
+#define FFT_TABLES_H_
+
+#include <stdint.h>
+
+#if MAX_SIGNAL_LENGHT == 256
+static const float fft_w_table_r2[256] __attribute__((aligned(16))) = {
+    1.0f, 0.0f, 6.12323426e-17f, 1.0f, 0.707106769f, 0.707106769f, -0.707106769f, 0.707106769f,
+    0.923879504f, 0.382683426f, -0.382683426f, 0.923879504f, 0.382683426f, 0.923879504f, -0.923879504f, 0.382683426f,
+    0.980785251f, 0.195090324f, -0.195090324f, 0.980785251f, 0.555570245f, 0.831469595f, -0.831469595f, 0.555570245f,
+    0.831469595f, 0.555570245f, -0.555570245f, 0.831469595f, 0.195090324f, 0.980785251f, -0.980785251f, 0.195090324f,
+    0.99518472f, 0.0980171412f, -0.0980171412f, 0.99518472f, 0.634393275f, 0.773010433f, -0.773010433f, 0.634393275f,
+    0.881921291f, 0.471396744f, -0.471396744f, 0.881921291f, 0.290284663f, 0.956940353f, -0.956940353f, 0.290284663f,
+    0.956940353f, 0.290284663f, -0.290284663f, 0.956940353f, 0.471396744f, 0.881921291f, -0.881921291f, 0.471396744f,
+    0.773010433f, 0.634393275f, -0.634393275f, 0.773010433f, 0.0980171412f, 0.99518472f, -0.99518472f, 0.0980171412f,
+    0.99879545f, 0.0490676761f, -0.0490676761f, 0.99879545f, 0.671558976f, 0.740951121f, -0.740951121f, 0.671558976f,
+    0.903989315f, 0.427555084f, -0.427555084f, 0.903989315f, 0.336889863f, 0.941544056f, -0.941544056f, 0.336889863f,
+    0.970031261f, 0.242980182f, -0.242980182f, 0.970031261f, 0.514102757f, 0.857728601f, -0.857728601f, 0.514102757f,
+    0.803207517f, 0.59569931f, -0.59569931f, 0.803207517f, 0.146730468f, 0.989176512f, -0.989176512f, 0.146730468f,
+    0.989176512f, 0.146730468f, -0.146730468f, 0.989176512f, 0.59569931f, 0.803207517f, -0.803207517f, 0.59569931f,
+    0.857728601f, 0.514102757f, -0.514102757f, 0.857728601f, 0.242980182f, 0.970031261f, -0.970031261f, 0.242980182f,
+    0.941544056f, 0.336889863f, -0.336889863f, 0.941544056f, 0.427555084f, 0.903989315f, -0.903989315f, 0.427555084f,
+    0.740951121f, 0.671558976f, -0.671558976f, 0.740951121f, 0.0490676761f, 0.99879545f, -0.99879545f, 0.0490676761f,
+    0.999698818f, 0.024541229f, -0.024541229f, 0.999698818f, 0.689540565f, 0.724247098f, -0.724247098f, 0.689540565f,
+    0.914209783f, 0.405241311f, -0.405241311f, 0.914209783f, 0.359895051f, 0.932992816f, -0.932992816f, 0.359895051f,
+    0.975702107f, 0.219101235f, -0.219101235f, 0.975702107f, 0.534997642f, 0.84485358f, -0.84485358f, 0.534997642f,
+    0.817584813f, 0.575808167f, -0.575808167f, 0.817584813f, 0.170961887f, 0.985277653f, -0.985277653f, 0.170961887f,
+    0.992479563f, 0.122410677f, -0.122410677f, 0.992479563f, 0.615231574f, 0.78834641f, -0.78834641f, 0.615231574f,
+    0.870086968f, 0.492898196f, -0.492898196f, 0.870086968f, 0.266712755f, 0.963776052f, -0.963776052f, 0.266712755f,
+    0.949528158f, 0.313681751f, -0.313681751f, 0.949528158f, 0.449611336f, 0.893224299f, -0.893224299f, 0.449611336f,
+    0.757208824f, 0.653172851f, -0.653172851f, 0.757208824f, 0.0735645667f, 0.997290432f, -0.997290432f, 0.0735645667f,
+    0.997290432f, 0.0735645667f, -0.0735645667f, 0.997290432f, 0.653172851f, 0.757208824f, -0.757208824f, 0.653172851f,
+    0.893224299f, 0.449611336f, -0.449611336f, 0.893224299f, 0.313681751f, 0.949528158f, -0.949528158f, 0.313681751f,
+    0.963776052f, 0.266712755f, -0.266712755f, 0.963776052f, 0.492898196f, 0.870086968f, -0.870086968f, 0.492898196f,
+    0.78834641f, 0.615231574f, -0.615231574f, 0.78834641f, 0.122410677f, 0.992479563f, -0.992479563f, 0.122410677f,
+    0.985277653f, 0.170961887f, -0.170961887f, 0.985277653f, 0.575808167f, 0.817584813f, -0.817584813f, 0.575808167f,
+    0.84485358f, 0.534997642f, -0.534997642f, 0.84485358f, 0.219101235f, 0.975702107f, -0.975702107f, 0.219101235f,
+    0.932992816f, 0.359895051f, -0.359895051f, 0.932992816f, 0.405241311f, 0.914209783f, -0.914209783f, 0.405241311f,
+    0.724247098f, 0.689540565f, -0.689540565f, 0.724247098f, 0.024541229f, 0.999698818f, -0.999698818f, 0.024541229f,
+};
+static const float fft_w_table_r4[512] __attribute__((aligned(16))) = {
+    1.0f, 0.0f, 0.999698818f, 0.024541229f, 0.99879545f, 0.0490676761f, 0.997290432f, 0.0735645667f,
+    0.99518472f, 0.0980171412f, 0.992479563f, 0.122410677f, 0.989176512f, 0.146730468f, 0.985277653f, 0.170961887f,
+    0.980785251f, 0.195090324f, 0.975702107f, 0.219101235f, 0.970031261f, 0.242980182f, 0.963776052f, 0.266712755f,
+    0.956940353f, 0.290284663f, 0.949528158f, 0.313681751f, 0.941544056f, 0.336889863f, 0.932992816f, 0.359895051f,
+    0.923879504f, 0.382683426f, 0.914209783f, 0.405241311f, 0.903989315f, 0.427555084f, 0.893224299f, 0.449611336f,
+    0.881921291f, 0.471396744f, 0.870086968f, 0.492898196f, 0.857728601f, 0.514102757f, 0.84485358f, 0.534997642f,
+    0.831469595f, 0.555570245f, 0.817584813f, 0.575808167f, 0.803207517f, 0.59569931f, 0.78834641f, 0.615231574f,
+    0.773010433f, 0.634393275f, 0.757208824f, 0.653172851f, 0.740951121f, 0.671558976f, 0.724247098f, 0.689540565f,
+    0.707106769f, 0.707106769f, 0.689540565f, 0.724247098f, 0.671558976f, 0.740951121f, 0.653172851f, 0.757208824f,
+    0.634393275f, 0.773010433f, 0.615231574f, 0.78834641f, 0.59569931f, 0.803207517f, 0.575808167f, 0.817584813f,
+    0.555570245f, 0.831469595f, 0.534997642f, 0.84485358f, 0.514102757f, 0.857728601f, 0.492898196f, 0.870086968f,
+    0.471396744f, 0.881921291f, 0.449611336f, 0.893224299f, 0.427555084f, 0.903989315f, 0.405241311f, 0.914209783f,
+    0.382683426f, 0.923879504f, 0.359895051f, 0.932992816f, 0.336889863f, 0.941544056f, 0.313681751f, 0.949528158f,
+    0.290284663f, 0.956940353f, 0.266712755f, 0.963776052f, 0.242980182f, 0.970031261f, 0.219101235f, 0.975702107f,
+    0.195090324f, 0.980785251f, 0.170961887f, 0.985277653f, 0.146730468f, 0.989176512f, 0.122410677f, 0.992479563f,
+    0.0980171412f, 0.99518472f, 0.0735645667f, 0.997290432f, 0.0490676761f, 0.99879545f, 0.024541229f, 0.999698818f,
+    6.12323426e-17f, 1.0f, -0.024541229f, 0.999698818f, -0.0490676761f, 0.99879545f, -0.0735645667f, 0.997290432f,
+    -0.0980171412f, 0.99518472f, -0.122410677f, 0.992479563f, -0.146730468f, 0.989176512f, -0.170961887f, 0.985277653f,
+    -0.195090324f, 0.980785251f, -0.219101235f, 0.975702107f, -0.242980182f, 0.970031261f, -0.266712755f, 0.963776052f,
+    -0.290284663f, 0.956940353f, -0.313681751f, 0.949528158f, -0.336889863f, 0.941544056f, -0.359895051f, 0.932992816f,
+    -0.382683426f, 0.923879504f, -0.405241311f, 0.914209783f, -0.427555084f, 0.903989315f, -0.449611336f, 0.893224299f,
+    -0.471396744f, 0.881921291f, -0.492898196f, 0.870086968f, -0.514102757f, 0.857728601f, -0.534997642f, 0.84485358f,
+    -0.555570245f, 0.831469595f, -0.575808167f, 0.817584813f, -0.59569931f, 0.803207517f, -0.615231574f, 0.78834641f,
+    -0.634393275f, 0.773010433f, -0.653172851f, 0.757208824f, -0.671558976f, 0.740951121f, -0.689540565f, 0.724247098f,
+    -0.707106769f, 0.707106769f, -0.724247098f, 0.689540565f, -0.740951121f, 0.671558976f, -0.757208824f, 0.653172851f,
+    -0.773010433f, 0.634393275f, -0.78834641f, 0.615231574f, -0.803207517f, 0.59569931f, -0.817584813f, 0.575808167f,
+    -0.831469595f, 0.555570245f, -0.84485358f, 0.534997642f, -0.857728601f, 0.514102757f, -0.870086968f, 0.492898196f,
+    -0.881921291f, 0.471396744f, -0.893224299f, 0.449611336f, -0.903989315f, 0.427555084f, -0.914209783f, 0.405241311f,
+    -0.923879504f, 0.382683426f, -0.932992816f, 0.359895051f, -0.941544056f, 0.336889863f, -0.949528158f, 0.313681751f,
+    -0.956940353f, 0.290284663f, -0.963776052f, 0.266712755f, -0.970031261f, 0.242980182f, -0.975702107f, 0.219101235f,
+    -0.980785251f, 0.195090324f, -0.985277653f, 0.170961887f, -0.989176512f, 0.146730468f, -0.992479563f, 0.122410677f,
+    -0.99518472f, 0.0980171412f, -0.997290432f, 0.0735645667f, -0.99879545f, 0.0490676761f, -0.999698818f, 0.024541229f,
+    -1.0f, 1.22464685e-16f, -0.999698818f, -0.024541229f, -0.99879545f, -0.0490676761f, -0.997290432f, -0.0735645667f,
+    -0.99518472f, -0.0980171412f, -0.992479563f, -0.122410677f, -0.989176512f, -0.146730468f, -0.985277653f, -0.170961887f,
+    -0.980785251f, -0.195090324f, -0.975702107f, -0.219101235f, -0.970031261f, -0.242980182f, -0.963776052f, -0.266712755f,
+    -0.956940353f, -0.290284663f, -0.949528158f, -0.313681751f, -0.941544056f, -0.336889863f, -0.932992816f, -0.359895051f,
+    -0.923879504f, -0.382683426f, -0.914209783f, -0.405241311f, -0.903989315f, -0.427555084f, -0.893224299f, -0.449611336f,
+    -0.881921291f, -0.471396744f, -0.870086968f, -0.492898196f, -0.857728601f, -0.514102757f, -0.84485358f, -0.534997642f,
+    -0.831469595f, -0.555570245f, -0.817584813f, -0.575808167f, -0.803207517f, -0.59569931f, -0.78834641f, -0.615231574f,
+    -0.773010433f, -0.634393275f, -0.757208824f, -0.653172851f, -0.740951121f, -0.671558976f, -0.724247098f, -0.689540565f,
+    -0.707106769f, -0.707106769f, -0.689540565f, -0.724247098f, -0.671558976f, -0.740951121f, -0.653172851f, -0.757208824f,
+    -0.634393275f, -0.773010433f, -0.615231574f, -0.78834641f, -0.59569931f, -0.803207517f, -0.575808167f, -0.817584813f,
+    -0.555570245f, -0.831469595f, -0.534997642f, -0.84485358f, -0.514102757f, -0.857728601f, -0.492898196f, -0.870086968f,
+    -0.471396744f, -0.881921291f, -0.449611336f, -0.893224299f, -0.427555084f, -0.903989315f, -0.405241311f, -0.914209783f,
+    -0.382683426f, -0.923879504f, -0.359895051f, -0.932992816f, -0.336889863f, -0.941544056f, -0.313681751f, -0.949528158f,
+    -0.290284663f, -0.956940353f, -0.266712755f, -0.963776052f, -0.242980182f, -0.970031261f, -0.219101235f, -0.975702107f,
+    -0.195090324f, -0.980785251f, -0.170961887f, -0.985277653f, -0.146730468f, -0.989176512f, -0.122410677f, -0.992479563f,
+    -0.0980171412f, -0.99518472f, -0.0735645667f, -0.997290432f, -0.0490676761f, -0.99879545f, -0.024541229f, -0.999698818f,
+    -1.83697015e-16f, -1.0f, 0.024541229f, -0.999698818f, 0.0490676761f, -0.99879545f, 0.0735645667f, -0.997290432f,
+    0.0980171412f, -0.99518472f, 0.122410677f, -0.992479563f, 0.146730468f, -0.989176512f, 0.170961887f, -0.985277653f,
+    0.195090324f, -0.980785251f, 0.219101235f, -0.975702107f, 0.242980182f, -0.970031261f, 0.266712755f, -0.963776052f,
+    0.290284663f, -0.956940353f, 0.313681751f, -0.949528158f, 0.336889863f, -0.941544056f, 0.359895051f, -0.932992816f,
+    0.382683426f, -0.923879504f, 0.405241311f, -0.914209783f, 0.427555084f, -0.903989315f, 0.449611336f, -0.893224299f,
+    0.471396744f, -0.881921291f, 0.492898196f, -0.870086968f, 0.514102757f, -0.857728601f, 0.534997642f, -0.84485358f,
+    0.555570245f, -0.831469595f, 0.575808167f, -0.817584813f, 0.59569931f, -0.803207517f, 0.615231574f, -0.78834641f,
+    0.634393275f, -0.773010433f, 0.653172851f, -0.757208824f, 0.671558976f, -0.740951121f, 0.689540565f, -0.724247098f,
+    0.707106769f, -0.707106769f, 0.724247098f, -0.689540565f, 0.740951121f, -0.671558976f, 0.757208824f, -0.653172851f,
+    0.773010433f, -0.634393275f, 0.78834641f, -0.615231574f, 0.803207517f, -0.59569931f, 0.817584813f, -0.575808167f,
+    0.831469595f, -0.555570245f, 0.84485358f, -0.534997642f, 0.857728601f, -0.514102757f, 0.870086968f, -0.492898196f,
+    0.881921291f, -0.471396744f, 0.893224299f, -0.449611336f, 0.903989315f, -0.427555084f, 0.914209783f, -0.405241311f,
+    0.923879504f, -0.382683426f, 0.932992816f, -0.359895051f, 0.941544056f, -0.336889863f, 0.949528158f, -0.313681751f,
+    0.956940353f, -0.290284663f, 0.963776052f, -0.266712755f, 0.970031261f, -0.242980182f, 0.975702107f, -0.219101235f,
+    0.980785251f, -0.195090324f, 0.985277653f, -0.170961887f, 0.989176512f, -0.146730468f, 0.992479563f, -0.122410677f,
+    0.99518472f, -0.0980171412f, 0.997290432f, -0.0735645667f, 0.99879545f, -0.0490676761f, 0.999698818f, -0.024541229f,
+};
+static const int16_t fft_w_table_sc16[256] __attribute__((aligned(16))) = {
+    32767, 0, 0, 32767, 23169, 23169, -23169, 23169,
+    30272, 12539, -12539, 30272, 12539, 30272, -30272, 12539,
+    32137, 6392, -6392, 32137, 18204, 27244, -27244, 18204,
+    27244, 18204, -18204, 27244, 6392, 32137, -32137, 6392,
+    32609, 3211, -3211, 32609, 20787, 25329, -25329, 20787,
+    28897, 15446, -15446, 28897, 9511, 31356, -31356, 9511,
+    31356, 9511, -9511, 31356, 15446, 28897, -28897, 15446,
+    25329, 20787, -20787, 25329, 3211, 32609, -32609, 3211,
+    32727, 1607, -1607, 32727, 22004, 24278, -24278, 22004,
+    29621, 14009, -14009, 29621, 11038, 30851, -30851, 11038,
+    31785, 7961, -7961, 31785, 16845, 28105, -28105, 16845,
+    26318, 19519, -19519, 26318, 4807, 32412, -32412, 4807,
+    32412, 4807, -4807, 32412, 19519, 26318, -26318, 19519,
+    28105, 16845, -16845, 28105, 7961, 31785, -31785, 7961,
+    30851, 11038, -11038, 30851, 14009, 29621, -29621, 14009,
+    24278, 22004, -22004, 24278, 1607, 32727, -32727, 1607,
+    32757, 804, -804, 32757, 22594, 23731, -23731, 22594,
+    29955, 13278, -13278, 29955, 11792, 30571, -30571, 11792,
+    31970, 7179, -7179, 31970, 17530, 27683, -27683, 17530,
+    26789, 18867, -18867, 26789, 5601, 32284, -32284, 5601,
+    32520, 4011, -4011, 32520, 20159, 25831, -25831, 20159,
+    28510, 16150, -16150, 28510, 8739, 31580, -31580, 8739,
+    31113, 10278, -10278, 31113, 14732, 29268, -29268, 14732,
+    24811, 21402, -21402, 24811, 2410, 32678, -32678, 2410,
+    32678, 2410, -2410, 32678, 21402, 24811, -24811, 21402,
+    29268, 14732, -14732, 29268, 10278, 31113, -31113, 10278,
+    31580, 8739, -8739, 31580, 16150, 28510, -28510, 16150,
+    25831, 20159, -20159, 25831, 4011, 32520, -32520, 4011,
+    32284, 5601, -5601, 32284, 18867, 26789, -26789, 18867,
+    27683, 17530, -17530, 27683, 7179, 31970, -31970, 7179,
+    30571, 11792, -11792, 30571, 13278, 29955, -29955, 13278,
+    23731, 22594, -22594, 23731, 804, 32757, -32757, 804,
+};
+static const int16_t fft_hann_q15[129] = {
+    0, 4, 19, 44, 78, 123, 177, 241,
+    314, 398, 490, 593, 705, 826, 957, 1097,
+    1247, 1405, 1572, 1749, 1934, 2128, 2330, 2541,
+    2761, 2988, 3224, 3467, 3718, 3977, 4244, 4517,
+    4798, 5086, 5381, 5682, 5989, 6303, 6623, 6949,
+    7281, 7618, 7960, 8308, 8660, 9017, 9378, 9744,
+    10113, 10487, 10864, 11244, 11627, 12013, 12402, 12793,
+    13187, 13582, 13979, 14377, 14777, 15178, 15579, 15981,
+    16383, 16785, 17187, 17588, 17989, 18389, 18787, 19184,
+    19579, 19973, 20364, 20753, 21139, 21522, 21902, 22279,
+    22653, 23022, 23388, 23749, 24106, 24458, 24806, 25148,
+    25485, 25817, 26143, 26463, 26777, 27084, 27385, 27680,
+    27968, 28249, 28522, 28789, 29048, 29299, 29542, 29778,
+    30005, 30225, 30436, 30638, 30832, 31017, 31194, 31361,
+    31519, 31669, 31809, 31940, 32061, 32173, 32276, 32368,
+    32452, 32525, 32589, 32643, 32688, 32722, 32747, 32762,
+    32767,
+};
+#elif MAX_SIGNAL_LENGHT == 512
+static const float fft_w_table_r2[512] __attribute__((aligned(16))) = {
+    1.0f, 0.0f, 6.12323426e-17f, 1.0f, 0.707106769f, 0.707106769f, -0.707106769f, 0.707106769f,
+    0.923879504f, 0.382683426f, -0.382683426f, 0.923879504f, 0.382683426f, 0.923879504f, -0.923879504f, 0.382683426f,
+    0.980785251f, 0.195090324f, -0.195090324f, 0.980785251f, 0.555570245f, 0.831469595f, -0.831469595f, 0.555570245f,
+    0.831469595f, 0.555570245f, -0.555570245f, 0.831469595f, 0.195090324f, 0.980785251f, -0.980785251f, 0.195090324f,
+    0.99518472f, 0.0980171412f, -0.0980171412f, 0.99518472f, 0.634393275f, 0.773010433f, -0.773010433f, 0.634393275f,
+    0.881921291f, 0.471396744f, -0.471396744f, 0.881921291f, 0.290284663f, 0.956940353f, -0.956940353f, 0.290284663f,
+    0.956940353f, 0.290284663f, -0.290284663f, 0.956940353f, 0.471396744f, 0.881921291f, -0.881921291f, 0.471396744f,
+    0.773010433f, 0.634393275f, -0.634393275f, 0.773010433f, 0.0980171412f, 0.99518472f, -0.99518472f, 0.0980171412f,
+    0.99879545f, 0.0490676761f, -0.0490676761f, 0.99879545f, 0.671558976f, 0.740951121f, -0.740951121f, 0.671558976f,
+    0.903989315f, 0.427555084f, -0.427555084f, 0.903989315f, 0.336889863f, 0.941544056f, -0.941544056f, 0.336889863f,
+    0.970031261f, 0.242980182f, -0.242980182f, 0.970031261f, 0.514102757f, 0.857728601f, -0.857728601f, 0.514102757f,
+    0.803207517f, 0.59569931f, -0.59569931f, 0.803207517f, 0.146730468f, 0.989176512f, -0.989176512f, 0.146730468f,
+    0.989176512f, 0.146730468f, -0.146730468f, 0.989176512f, 0.59569931f, 0.803207517f, -0.803207517f, 0.59569931f,
+    0.857728601f, 0.514102757f, -0.514102757f, 0.857728601f, 0.242980182f, 0.970031261f, -0.970031261f, 0.242980182f,
+    0.941544056f, 0.336889863f, -0.336889863f, 0.941544056f, 0.427555084f, 0.903989315f, -0.903989315f, 0.427555084f,
+    0.740951121f, 0.671558976f, -0.671558976f, 0.740951121f, 0.0490676761f, 0.99879545f, -0.99879545f, 0.0490676761f,
+    0.999698818f, 0.024541229f, -0.024541229f, 0.999698818f, 0.689540565f, 0.724247098f, -0.724247098f, 0.689540565f,
+    0.914209783f, 0.405241311f, -0.405241311f, 0.914209783f, 0.359895051f, 0.932992816f, -0.932992816f, 0.359895051f,
+    0.975702107f, 0.219101235f, -0.219101235f, 0.975702107f, 0.534997642f, 0.84485358f, -0.84485358f, 0.534997642f,
+    0.817584813f, 0.575808167f, -0.575808167f, 0.817584813f, 0.170961887f, 0.985277653f, -0.985277653f, 0.170961887f,
+    0.992479563f, 0.122410677f, -0.122410677f, 0.992479563f, 0.615231574f, 0.78834641f, -0.78834641f, 0.615231574f,
+    0.870086968f, 0.492898196f, -0.492898196f, 0.870086968f, 0.266712755f, 0.963776052f, -0.963776052f, 0.266712755f,
+    0.949528158f, 0.313681751f, -0.313681751f, 0.949528158f, 0.449611336f, 0.893224299f, -0.893224299f, 0.449611336f,
+    0.757208824f, 0.653172851f, -0.653172851f, 0.757208824f, 0.0735645667f, 0.997290432f, -0.997290432f, 0.0735645667f,
+    0.997290432f, 0.0735645667f, -0.0735645667f, 0.997290432f, 0.653172851f, 0.757208824f, -0.757208824f, 0.653172851f,
+    0.893224299f, 0.449611336f, -0.449611336f, 0.893224299f, 0.313681751f, 0.949528158f, -0.949528158f, 0.313681751f,
+    0.963776052f, 0.266712755f, -0.266712755f, 0.963776052f, 0.492898196f, 0.870086968f, -0.870086968f, 0.492898196f,
+    0.78834641f, 0.615231574f, -0.615231574f, 0.78834641f, 0.122410677f, 0.992479563f, -0.992479563f, 0.122410677f,
+    0.985277653f, 0.170961887f, -0.170961887f, 0.985277653f, 0.575808167f, 0.817584813f, -0.817584813f, 0.575808167f,
+    0.84485358f, 0.534997642f, -0.534997642f, 0.84485358f, 0.219101235f, 0.975702107f, -0.975702107f, 0.219101235f,
+    0.932992816f, 0.359895051f, -0.359895051f, 0.932992816f, 0.405241311f, 0.914209783f, -0.914209783f, 0.405241311f,
+    0.724247098f, 0.689540565f, -0.689540565f, 0.724247098f, 0.024541229f, 0.999698818f, -0.999698818f, 0.024541229f,
+    0.999924719f, 0.0122715384f, -0.0122715384f, 0.999924719f, 0.698376238f, 0.715730846f, -0.715730846f, 0.698376238f,
+    0.919113874f, 0.393992037f, -0.393992037f, 0.919113874f, 0.371317208f, 0.928506076f, -0.928506076f, 0.371317208f,
+    0.97831738f, 0.207111374f, -0.207111374f, 0.97831738f, 0.545324981f, 0.838224709f, -0.838224709f, 0.545324981f,
+    0.824589312f, 0.565731823f, -0.565731823f, 0.824589312f, 0.183039889f, 0.983105481f, -0.983105481f, 0.183039889f,
+    0.993906975f, 0.110222206f, -0.110222206f, 0.993906975f, 0.624859512f, 0.780737221f, -0.780737221f, 0.624859512f,
+    0.876070082f, 0.482183784f, -0.482183784f, 0.876070082f, 0.27851969f, 0.960430503f, -0.960430503f, 0.27851969f,
+    0.953306019f, 0.302005947f, -0.302005947f, 0.953306019f, 0.460538715f, 0.887639642f, -0.887639642f, 0.460538715f,
+    0.765167236f, 0.643831551f, -0.643831551f, 0.765167236f, 0.0857973099f, 0.996312618f, -0.996312618f, 0.0857973099f,
+    0.998118103f, 0.061320737f, -0.061320737f, 0.998118103f, 0.662415802f, 0.749136388f, -0.749136388f, 0.662415802f,
+    0.898674488f, 0.438616246f, -0.438616246f, 0.898674488f, 0.32531029f, 0.945607305f, -0.945607305f, 0.32531029f,
+    0.966976464f, 0.254865646f, -0.254865646f, 0.966976464f, 0.50353837f, 0.863972843f, -0.863972843f, 0.50353837f,
+    0.795836926f, 0.605511069f, -0.605511069f, 0.795836926f, 0.134580702f, 0.990902662f, -0.990902662f, 0.134580702f,
+    0.987301409f, 0.15885815f, -0.15885815f, 0.987301409f, 0.585797846f, 0.81045717f, -0.81045717f, 0.585797846f,
+    0.851355195f, 0.524589658f, -0.524589658f, 0.851355195f, 0.231058106f, 0.972939968f, -0.972939968f, 0.231058106f,
+    0.937339008f, 0.348418683f, -0.348418683f, 0.937339008f, 0.416429549f, 0.909168005f, -0.909168005f, 0.416429549f,
+    0.732654274f, 0.680601001f, -0.680601001f, 0.732654274f, 0.0368072242f, 0.999322355f, -0.999322355f, 0.0368072242f,
+    0.999322355f, 0.0368072242f, -0.0368072242f, 0.999322355f, 0.680601001f, 0.732654274f, -0.732654274f, 0.680601001f,
+    0.909168005f, 0.416429549f, -0.416429549f, 0.909168005f, 0.348418683f, 0.937339008f, -0.937339008f, 0.348418683f,
+    0.972939968f, 0.231058106f, -0.231058106f, 0.972939968f, 0.524589658f, 0.851355195f, -0.851355195f, 0.524589658f,
+    0.81045717f, 0.585797846f, -0.585797846f, 0.81045717f, 0.15885815f, 0.987301409f, -0.987301409f, 0.15885815f,
+    0.990902662f, 0.134580702f, -0.134580702f, 0.990902662f, 0.605511069f, 0.795836926f, -0.795836926f, 0.605511069f,
+    0.863972843f, 0.50353837f, -0.50353837f, 0.863972843f, 0.254865646f, 0.966976464f, -0.966976464f, 0.254865646f,
+    0.945607305f, 0.32531029f, -0.32531029f, 0.945607305f, 0.438616246f, 0.898674488f, -0.898674488f, 0.438616246f,
+    0.749136388f, 0.662415802f, -0.662415802f, 0.749136388f, 0.061320737f, 0.998118103f, -0.998118103f, 0.061320737f,
+    0.996312618f, 0.0857973099f, -0.0857973099f, 0.996312618f, 0.643831551f, 0.765167236f, -0.765167236f, 0.643831551f,
+    0.887639642f, 0.460538715f, -0.460538715f, 0.887639642f, 0.302005947f, 0.953306019f, -0.953306019f, 0.302005947f,
+    0.960430503f, 0.27851969f, -0.27851969f, 0.960430503f, 0.482183784f, 0.876070082f, -0.876070082f, 0.482183784f,
+    0.780737221f, 0.624859512f, -0.624859512f, 0.780737221f, 0.110222206f, 0.993906975f, -0.993906975f, 0.110222206f,
+    0.983105481f, 0.183039889f, -0.183039889f, 0.983105481f, 0.565731823f, 0.824589312f, -0.824589312f, 0.565731823f,
+    0.838224709f, 0.545324981f, -0.545324981f, 0.838224709f, 0.207111374f, 0.97831738f, -0.97831738f, 0.207111374f,
+    0.928506076f, 0.371317208f, -0.371317208f, 0.928506076f, 0.393992037f, 0.919113874f, -0.919113874f, 0.393992037f,
+    0.715730846f, 0.698376238f, -0.698376238f, 0.715730846f, 0.0122715384f, 0.999924719f, -0.999924719f, 0.0122715384f,
+};
+static const float fft_w_table_r4[1024] __attribute__((aligned(16))) = {
+    1.0f, 0.0f, 0.999924719f, 0.0122715384f, 0.999698818f, 0.024541229f, 0.999322355f, 0.0368072242f,
+    0.99879545f, 0.0490676761f, 0.998118103f, 0.061320737f, 0.997290432f, 0.0735645667f, 0.996312618f, 0.0857973099f,
+    0.99518472f, 0.0980171412f, 0.993906975f, 0.110222206f, 0.992479563f, 0.122410677f, 0.990902662f, 0.134580702f,
+    0.989176512f, 0.146730468f, 0.987301409f, 0.15885815f, 0.985277653f, 0.170961887f, 0.983105481f, 0.183039889f,
+    0.980785251f, 0.195090324f, 0.97831738f, 0.207111374f, 0.975702107f, 0.219101235f, 0.972939968f, 0.231058106f,
+    0.970031261f, 0.242980182f, 0.966976464f, 0.254865646f, 0.963776052f, 0.266712755f, 0.960430503f, 0.27851969f,
+    0.956940353f, 0.290284663f, 0.953306019f, 0.302005947f, 0.949528158f, 0.313681751f, 0.945607305f, 0.32531029f,
+    0.941544056f, 0.336889863f, 0.937339008f, 0.348418683f, 0.932992816f, 0.359895051f, 0.928506076f, 0.371317208f,
+    0.923879504f, 0.382683426f, 0.919113874f, 0.393992037f, 0.914209783f, 0.405241311f, 0.909168005f, 0.416429549f,
+    0.903989315f, 0.427555084f, 0.898674488f, 0.438616246f, 0.893224299f, 0.449611336f, 0.887639642f, 0.460538715f,
+    0.881921291f, 0.471396744f, 0.876070082f, 0.482183784f, 0.870086968f, 0.492898196f, 0.863972843f, 0.50353837f,
+    0.857728601f, 0.514102757f, 0.851355195f, 0.524589658f, 0.84485358f, 0.534997642f, 0.838224709f, 0.545324981f,
+    0.831469595f, 0.555570245f, 0.824589312f, 0.565731823f, 0.817584813f, 0.575808167f, 0.81045717f, 0.585797846f,
+    0.803207517f, 0.59569931f, 0.795836926f, 0.605511069f, 0.78834641f, 0.615231574f, 0.780737221f, 0.624859512f,
+    0.773010433f, 0.634393275f, 0.765167236f, 0.643831551f, 0.757208824f, 0.653172851f, 0.749136388f, 0.662415802f,
+    0.740951121f, 0.671558976f, 0.732654274f, 0.680601001f, 0.724247098f, 0.689540565f, 0.715730846f, 0.698376238f,
+    0.707106769f, 0.707106769f, 0.698376238f, 0.715730846f, 0.689540565f, 0.724247098f, 0.680601001f, 0.732654274f,
+    0.671558976f, 0.740951121f, 0.662415802f, 0.749136388f, 0.653172851f, 0.757208824f, 0.643831551f, 0.765167236f,
+    0.634393275f, 0.773010433f, 0.624859512f, 0.780737221f, 0.615231574f, 0.78834641f, 0.605511069f, 0.795836926f,
+    0.59569931f, 0.803207517f, 0.585797846f, 0.81045717f, 0.575808167f, 0.817584813f, 0.565731823f, 0.824589312f,
+    0.555570245f, 0.831469595f, 0.545324981f, 0.838224709f, 0.534997642f, 0.84485358f, 0.524589658f, 0.851355195f,
+    0.514102757f, 0.857728601f, 0.50353837f, 0.863972843f, 0.492898196f, 0.870086968f, 0.482183784f, 0.876070082f,
+    0.471396744f, 0.881921291f, 0.460538715f, 0.887639642f, 0.449611336f, 0.893224299f, 0.438616246f, 0.898674488f,
+    0.427555084f, 0.903989315f, 0.416429549f, 0.909168005f, 0.405241311f, 0.914209783f, 0.393992037f, 0.919113874f,
+    0.382683426f, 0.923879504f, 0.371317208f, 0.928506076f, 0.359895051f, 0.932992816f, 0.348418683f, 0.937339008f,
+    0.336889863f, 0.941544056f, 0.32531029f, 0.945607305f, 0.313681751f, 0.949528158f, 0.302005947f, 0.953306019f,
+    0.290284663f, 0.956940353f, 0.27851969f, 0.960430503f, 0.266712755f, 0.963776052f, 0.254865646f, 0.966976464f,
+    0.242980182f, 0.970031261f, 0.231058106f, 0.972939968f, 0.219101235f, 0.975702107f, 0.207111374f, 0.97831738f,
+    0.195090324f, 0.980785251f, 0.183039889f, 0.983105481f, 0.170961887f, 0.985277653f, 0.15885815f, 0.987301409f,
+    0.146730468f, 0.989176512f, 0.134580702f, 0.990902662f, 0.122410677f, 0.992479563f, 0.110222206f, 0.993906975f,
+    0.0980171412f, 0.99518472f, 0.0857973099f, 0.996312618f, 0.0735645667f, 0.997290432f, 0.061320737f, 0.998118103f,
+    0.0490676761f, 0.99879545f, 0.0368072242f, 0.999322355f, 0.024541229f, 0.999698818f, 0.0122715384f, 0.999924719f,
+    6.12323426e-17f, 1.0f, -0.0122715384f, 0.999924719f, -0.024541229f, 0.999698818f, -0.0368072242f, 0.999322355f,
+    -0.0490676761f, 0.99879545f, -0.061320737f, 0.998118103f, -0.0735645667f, 0.997290432f, -0.0857973099f, 0.996312618f,
+    -0.0980171412f, 0.99518472f, -0.110222206f, 0.993906975f, -0.122410677f, 0.992479563f, -0.134580702f, 0.990902662f,
+    -0.146730468f, 0.989176512f, -0.15885815f, 0.987301409f, -0.170961887f, 0.985277653f, -0.183039889f, 0.983105481f,
+    -0.195090324f, 0.980785251f, -0.207111374f, 0.97831738f, -0.219101235f, 0.975702107f, -0.231058106f, 0.972939968f,
+    -0.242980182f, 0.970031261f, -0.254865646f, 0.966976464f, -0.266712755f, 0.963776052f, -0.27851969f, 0.960430503f,
+    -0.290284663f, 0.956940353f, -0.302005947f, 0.953306019f, -0.313681751f, 0.949528158f, -0.32531029f, 0.945607305f,
+    -0.336889863f, 0.941544056f, -0.348418683f, 0.937339008f, -0.359895051f, 0.932992816f, -0.371317208f, 0.928506076f,
+    -0.382683426f, 0.923879504f, -0.393992037f, 0.919113874f, -0.405241311f, 0.914209783f, -0.416429549f, 0.909168005f,
+    -0.427555084f, 0.903989315f, -0.438616246f, 0.898674488f, -0.449611336f, 0.893224299f, -0.460538715f, 0.887639642f,
+    -0.471396744f, 0.881921291f, -0.482183784f, 0.876070082f, -0.492898196f, 0.870086968f, -0.50353837f, 0.863972843f,
+    -0.514102757f, 0.857728601f, -0.524589658f, 0.851355195f, -0.534997642f, 0.84485358f, -0.545324981f, 0.838224709f,
+    -0.555570245f, 0.831469595f, -0.565731823f, 0.824589312f, -0.575808167f, 0.817584813f, -0.585797846f, 0.81045717f,
+    -0.59569931f, 0.803207517f, -0.605511069f, 0.795836926f, -0.615231574f, 0.78834641f, -0.624859512f, 0.780737221f,
+    -0.634393275f, 0.773010433f, -0.643831551f, 0.765167236f, -0.653172851f, 0.757208824f, -0.662415802f, 0.749136388f,
+    -0.671558976f, 0.740951121f, -0.680601001f, 0.732654274f, -0.689540565f, 0.724247098f, -0.698376238f, 0.715730846f,
+    -0.707106769f, 0.707106769f, -0.715730846f, 0.698376238f, -0.724247098f, 0.689540565f, -0.732654274f, 0.680601001f,
+    -0.740951121f, 0.671558976f, -0.749136388f, 0.662415802f, -0.757208824f, 0.653172851f, -0.765167236f, 0.643831551f,
+    -0.773010433f, 0.634393275f, -0.780737221f, 0.624859512f, -0.78834641f, 0.615231574f, -0.795836926f, 0.605511069f,
+    -0.803207517f, 0.59569931f, -0.81045717f, 0.585797846f, -0.817584813f, 0.575808167f, -0.824589312f, 0.565731823f,
+    -0.831469595f, 0.555570245f, -0.838224709f, 0.545324981f, -0.84485358f, 0.534997642f, -0.851355195f, 0.524589658f,
+    -0.857728601f, 0.514102757f, -0.863972843f, 0.50353837f, -0.870086968f, 0.492898196f, -0.876070082f, 0.482183784f,
+    -0.881921291f, 0.471396744f, -0.887639642f, 0.460538715f, -0.893224299f, 0.449611336f, -0.898674488f, 0.438616246f,
+    -0.903989315f, 0.427555084f, -0.909168005f, 0.416429549f, -0.914209783f, 0.405241311f, -0.919113874f, 0.393992037f,
+    -0.923879504f, 0.382683426f, -0.928506076f, 0.371317208f, -0.932992816f, 0.359895051f, -0.937339008f, 0.348418683f,
+    -0.941544056f, 0.336889863f, -0.945607305f, 0.32531029f, -0.949528158f, 0.313681751f, -0.953306019f, 0.302005947f,
+    -0.956940353f, 0.290284663f, -0.960430503f, 0.27851969f, -0.963776052f, 0.266712755f, -0.966976464f, 0.254865646f,
+    -0.970031261f, 0.242980182f, -0.972939968f, 0.231058106f, -0.975702107f, 0.219101235f, -0.97831738f, 0.207111374f,
+    -0.980785251f, 0.195090324f, -0.983105481f, 0.183039889f, -0.985277653f, 0.170961887f, -0.987301409f, 0.15885815f,
+    -0.989176512f, 0.146730468f, -0.990902662f, 0.134580702f, -0.992479563f, 0.122410677f, -0.993906975f, 0.110222206f,
+    -0.99518472f, 0.0980171412f, -0.996312618f, 0.0857973099f, -0.997290432f, 0.0735645667f, -0.998118103f, 0.061320737f,
+    -0.99879545f, 0.0490676761f, -0.999322355f, 0.0368072242f, -0.999698818f, 0.024541229f, -0.999924719f, 0.0122715384f,
+    -1.0f, 1.22464685e-16f, -0.999924719f, -0.0122715384f, -0.999698818f, -0.024541229f, -0.999322355f, -0.0368072242f,
+    -0.99879545f, -0.0490676761f, -0.998118103f, -0.061320737f, -0.997290432f, -0.0735645667f, -0.996312618f, -0.0857973099f,
+    -0.99518472f, -0.0980171412f, -0.993906975f, -0.110222206f, -0.992479563f, -0.122410677f, -0.990902662f, -0.134580702f,
+    -0.989176512f, -0.146730468f, -0.987301409f, -0.15885815f, -0.985277653f, -0.170961887f, -0.983105481f, -0.183039889f,
+    -0.980785251f, -0.195090324f, -0.97831738f, -0.207111374f, -0.975702107f, -0.219101235f, -0.972939968f, -0.231058106f,
+    -0.970031261f, -0.242980182f, -0.966976464f, -0.254865646f, -0.963776052f, -0.266712755f, -0.960430503f, -0.27851969f,
+    -0.956940353f, -0.290284663f, -0.953306019f, -0.302005947f, -0.949528158f, -0.313681751f, -0.945607305f, -0.32531029f,
+    -0.941544056f, -0.336889863f, -0.937339008f, -0.348418683f, -0.932992816f, -0.359895051f, -0.928506076f, -0.371317208f,
+    -0.923879504f, -0.382683426f, -0.919113874f, -0.393992037f, -0.914209783f, -0.405241311f, -0.909168005f, -0.416429549f,
+    -0.903989315f, -0.427555084f, -0.898674488f, -0.438616246f, -0.893224299f, -0.449611336f, -0.887639642f, -0.460538715f,
+    -0.881921291f, -0.471396744f, -0.876070082f, -0.482183784f, -0.870086968f, -0.492898196f, -0.863972843f, -0.50353837f,
+    -0.857728601f, -0.514102757f, -0.851355195f, -0.524589658f, -0.84485358f, -0.534997642f, -0.838224709f, -0.545324981f,
+    -0.831469595f, -0.555570245f, -0.824589312f, -0.565731823f, -0.817584813f, -0.575808167f, -0.81045717f, -0.585797846f,
+    -0.803207517f, -0.59569931f, -0.795836926f, -0.605511069f, -0.78834641f, -0.615231574f, -0.780737221f, -0.624859512f,
+    -0.773010433f, -0.634393275f, -0.765167236f, -0.643831551f, -0.757208824f, -0.653172851f, -0.749136388f, -0.662415802f,
+    -0.740951121f, -0.671558976f, -0.732654274f, -0.680601001f, -0.724247098f, -0.689540565f, -0.715730846f, -0.698376238f,
+    -0.707106769f, -0.707106769f, -0.698376238f, -0.715730846f, -0.689540565f, -0.724247098f, -0.680601001f, -0.732654274f,
+    -0.671558976f, -0.740951121f, -0.662415802f, -0.749136388f, -0.653172851f, -0.757208824f, -0.643831551f, -0.765167236f,
+    -0.634393275f, -0.773010433f, -0.624859512f, -0.780737221f, -0.615231574f, -0.78834641f, -0.605511069f, -0.795836926f,
+    -0.59569931f, -0.803207517f, -0.585797846f, -0.81045717f, -0.575808167f, -0.817584813f, -0.565731823f, -0.824589312f,
+    -0.555570245f, -0.831469595f, -0.545324981f, -0.838224709f, -0.534997642f, -0.84485358f, -0.524589658f, -0.851355195f,
+    -0.514102757f, -0.857728601f, -0.50353837f, -0.863972843f, -0.492898196f, -0.870086968f, -0.482183784f, -0.876070082f,
+    -0.471396744f, -0.881921291f, -0.460538715f, -0.887639642f, -0.449611336f, -0.893224299f, -0.438616246f, -0.898674488f,
+    -0.427555084f, -0.903989315f, -0.416429549f, -0.909168005f, -0.405241311f, -0.914209783f, -0.393992037f, -0.919113874f,
+    -0.382683426f, -0.923879504f, -0.371317208f, -0.928506076f, -0.359895051f, -0.932992816f, -0.348418683f, -0.937339008f,
+    -0.336889863f, -0.941544056f, -0.32531029f, -0.945607305f, -0.313681751f, -0.949528158f, -0.302005947f, -0.953306019f,
+    -0.290284663f, -0.956940353f, -0.27851969f, -0.960430503f, -0.266712755f, -0.963776052f, -0.254865646f, -0.966976464f,
+    -0.242980182f, -0.970031261f, -0.231058106f, -0.972939968f, -0.219101235f, -0.975702107f, -0.207111374f, -0.97831738f,
+    -0.195090324f, -0.980785251f, -0.183039889f, -0.983105481f, -0.170961887f, -0.985277653f, -0.15885815f, -0.987301409f,
+    -0.146730468f, -0.989176512f, -0.134580702f, -0.990902662f, -0.122410677f, -0.992479563f, -0.110222206f, -0.993906975f,
+    -0.0980171412f, -0.99518472f, -0.0857973099f, -0.996312618f, -0.0735645667f, -0.997290432f, -0.061320737f, -0.998118103f,
+    -0.0490676761f, -0.99879545f, -0.0368072242f, -0.999322355f, -0.024541229f, -0.999698818f, -0.0122715384f, -0.999924719f,
+    -1.83697015e-16f, -1.0f, 0.0122715384f, -0.999924719f, 0.024541229f, -0.999698818f, 0.0368072242f, -0.999322355f,
+    0.0490676761f, -0.99879545f, 0.061320737f, -0.998118103f, 0.0735645667f, -0.997290432f, 0.0857973099f, -0.996312618f,
+    0.0980171412f, -0.99518472f, 0.110222206f, -0.993906975f, 0.122410677f, -0.992479563f, 0.134580702f, -0.990902662f,
+    0.146730468f, -0.989176512f, 0.15885815f, -0.987301409f, 0.170961887f, -0.985277653f, 0.183039889f, -0.983105481f,
+    0.195090324f, -0.980785251f, 0.207111374f, -0.97831738f, 0.219101235f, -0.975702107f, 0.231058106f, -0.972939968f,
+    0.242980182f, -0.970031261f, 0.254865646f, -0.966976464f, 0.266712755f, -0.963776052f, 0.27851969f, -0.960430503f,
+    0.290284663f, -0.956940353f, 0.302005947f, -0.953306019f, 0.313681751f, -0.949528158f, 0.32531029f, -0.945607305f,
+    0.336889863f, -0.941544056f, 0.348418683f, -0.937339008f, 0.359895051f, -0.932992816f, 0.371317208f, -0.928506076f,
+    0.382683426f, -0.923879504f, 0.393992037f, -0.919113874f, 0.405241311f, -0.914209783f, 0.416429549f, -0.909168005f,
+    0.427555084f, -0.903989315f, 0.438616246f, -0.898674488f, 0.449611336f, -0.893224299f, 0.460538715f, -0.887639642f,
+    0.471396744f, -0.881921291f, 0.482183784f, -0.876070082f, 0.492898196f, -0.870086968f, 0.50353837f, -0.863972843f,
+    0.514102757f, -0.857728601f, 0.524589658f, -0.851355195f, 0.534997642f, -0.84485358f, 0.545324981f, -0.838224709f,
+    0.555570245f, -0.831469595f, 0.565731823f, -0.824589312f, 0.575808167f, -0.817584813f, 0.585797846f, -0.81045717f,
+    0.59569931f, -0.803207517f, 0.605511069f, -0.795836926f, 0.615231574f, -0.78834641f, 0.624859512f, -0.780737221f,
+    0.634393275f, -0.773010433f, 0.643831551f, -0.765167236f, 0.653172851f, -0.757208824f, 0.662415802f, -0.749136388f,
+    0.671558976f, -0.740951121f, 0.680601001f, -0.732654274f, 0.689540565f, -0.724247098f, 0.698376238f, -0.715730846f,
+    0.707106769f, -0.707106769f, 0.715730846f, -0.698376238f, 0.724247098f, -0.689540565f, 0.732654274f, -0.680601001f,
+    0.740951121f, -0.671558976f, 0.749136388f, -0.662415802f, 0.757208824f, -0.653172851f, 0.765167236f, -0.643831551f,
+    0.773010433f, -0.634393275f, 0.780737221f, -0.624859512f, 0.78834641f, -0.615231574f, 0.795836926f, -0.605511069f,
+    0.803207517f, -0.59569931f, 0.81045717f, -0.585797846f, 0.817584813f, -0.575808167f, 0.824589312f, -0.565731823f,
+    0.831469595f, -0.555570245f, 0.838224709f, -0.545324981f, 0.84485358f, -0.534997642f, 0.851355195f, -0.524589658f,
+    0.857728601f, -0.514102757f, 0.863972843f, -0.50353837f, 0.870086968f, -0.492898196f, 0.876070082f, -0.482183784f,
+    0.881921291f, -0.471396744f, 0.887639642f, -0.460538715f, 0.893224299f, -0.449611336f, 0.898674488f, -0.438616246f,
+    0.903989315f, -0.427555084f, 0.909168005f, -0.416429549f, 0.914209783f, -0.405241311f, 0.919113874f, -0.393992037f,
+    0.923879504f, -0.382683426f, 0.928506076f, -0.371317208f, 0.932992816f, -0.359895051f, 0.937339008f, -0.348418683f,
+    0.941544056f, -0.336889863f, 0.945607305f, -0.32531029f, 0.949528158f, -0.313681751f, 0.953306019f, -0.302005947f,
+    0.956940353f, -0.290284663f, 0.960430503f, -0.27851969f, 0.963776052f, -0.266712755f, 0.966976464f, -0.254865646f,
+    0.970031261f, -0.242980182f, 0.972939968f, -0.231058106f, 0.975702107f, -0.219101235f, 0.97831738f, -0.207111374f,
+    0.980785251f, -0.195090324f, 0.983105481f, -0.183039889f, 0.985277653f, -0.170961887f, 0.987301409f, -0.15885815f,
+    0.989176512f, -0.146730468f, 0.990902662f, -0.134580702f, 0.992479563f, -0.122410677f, 0.993906975f, -0.110222206f,
+    0.99518472f, -0.0980171412f, 0.996312618f, -0.0857973099f, 0.997290432f, -0.0735645667f, 0.998118103f, -0.061320737f,
+    0.99879545f, -0.0490676761f, 0.999322355f, -0.0368072242f, 0.999698818f, -0.024541229f, 0.999924719f, -0.0122715384f,
+};
+static const int16_t fft_w_table_sc16[512] __attribute__((aligned(16))) = {
+    32767, 0, 0, 32767, 23169, 23169, -23169, 23169,
+    30272, 12539, -12539, 30272, 12539, 30272, -30272, 12539,
+    32137, 6392, -6392, 32137, 18204, 27244, -27244, 18204,
+    27244, 18204, -18204, 27244, 6392, 32137, -32137, 6392,
+    32609, 3211, -3211, 32609, 20787, 25329, -25329, 20787,
+    28897, 15446, -15446, 28897, 9511, 31356, -31356, 9511,
+    31356, 9511, -9511, 31356, 15446, 28897, -28897, 15446,
+    25329, 20787, -20787, 25329, 3211, 32609, -32609, 3211,
+    32727, 1607, -1607, 32727, 22004, 24278, -24278, 22004,
+    29621, 14009, -14009, 29621, 11038, 30851, -30851, 11038,
+    31785, 7961, -7961, 31785, 16845, 28105, -28105, 16845,
+    26318, 19519, -19519, 26318, 4807, 32412, -32412, 4807,
+    32412, 4807, -4807, 32412, 19519, 26318, -26318, 19519,
+    28105, 16845, -16845, 28105, 7961, 31785, -31785, 7961,
+    30851, 11038, -11038, 30851, 14009, 29621, -29621, 14009,
+    24278, 22004, -22004, 24278, 1607, 32727, -32727, 1607,
+    32757, 804, -804, 32757, 22594, 23731, -23731, 22594,
+    29955, 13278, -13278, 29955, 11792, 30571, -30571, 11792,
+    31970, 7179, -7179, 31970, 17530, 27683, -27683, 17530,
+    26789, 18867, -18867, 26789, 5601, 32284, -32284, 5601,
+    32520, 4011, -4011, 32520, 20159, 25831, -25831, 20159,
+    28510, 16150, -16150, 28510, 8739, 31580, -31580, 8739,
+    31113, 10278, -10278, 31113, 14732, 29268, -29268, 14732,
+    24811, 21402, -21402, 24811, 2410, 32678, -32678, 2410,
+    32678, 2410, -2410, 32678, 21402, 24811, -24811, 21402,
+    29268, 14732, -14732, 29268, 10278, 31113, -31113, 10278,
+    31580, 8739, -8739, 31580, 16150, 28510, -28510, 16150,
+    25831, 20159, -20159, 25831, 4011, 32520, -32520, 4011,
+    32284, 5601, -5601, 32284, 18867, 26789, -26789, 18867,
+    27683, 17530, -17530, 27683, 7179, 31970, -31970, 7179,
+    30571, 11792, -11792, 30571, 13278, 29955, -29955, 13278,
+    23731, 22594, -22594, 23731, 804, 32757, -32757, 804,
+    32764, 402, -402, 32764, 22883, 23452, -23452, 22883,
+    30116, 12909, -12909, 30116, 12166, 30424, -30424, 12166,
+    32056, 6786, -6786, 32056, 17868, 27466, -27466, 17868,
+    27019, 18537, -18537, 27019, 5997, 32213, -32213, 5997,
+    32567, 3611, -3611, 32567, 20474, 25582, -25582, 20474,
+    28706, 15799, -15799, 28706, 9126, 31470, -31470, 9126,
+    31236, 9895, -9895, 31236, 15090, 29085, -29085, 15090,
+    25072, 21096, -21096, 25072, 2811, 32646, -32646, 2811,
+    32705, 2009, -2009, 32705, 21705, 24546, -24546, 21705,
+    29446, 14372, -14372, 29446, 10659, 30984, -30984, 10659,
+    31684, 8351, -8351, 31684, 16499, 28309, -28309, 16499,
+    26077, 19840, -19840, 26077, 4409, 32468, -32468, 4409,
+    32350, 5205, -5205, 32350, 19194, 26556, -26556, 19194,
+    27896, 17189, -17189, 27896, 7571, 31880, -31880, 7571,
+    30713, 11416, -11416, 30713, 13645, 29790, -29790, 13645,
+    24006, 22301, -22301, 24006, 1206, 32744, -32744, 1206,
+    32744, 1206, -1206, 32744, 22301, 24006, -24006, 22301,
+    29790, 13645, -13645, 29790, 11416, 30713, -30713, 11416,
+    31880, 7571, -7571, 31880, 17189, 27896, -27896, 17189,
+    26556, 19194, -19194, 26556, 5205, 32350, -32350, 5205,
+    32468, 4409, -4409, 32468, 19840, 26077, -26077, 19840,
+    28309, 16499, -16499, 28309, 8351, 31684, -31684, 8351,
+    30984, 10659, -10659, 30984, 14372, 29446, -29446, 14372,
+    24546, 21705, -21705, 24546, 2009, 32705, -32705, 2009,
+    32646, 2811, -2811, 32646, 21096, 25072, -25072, 21096,
+    29085, 15090, -15090, 29085, 9895, 31236, -31236, 9895,
+    31470, 9126, -9126, 31470, 15799, 28706, -28706, 15799,
+    25582, 20474, -20474, 25582, 3611, 32567, -32567, 3611,
+    32213, 5997, -5997, 32213, 18537, 27019, -27019, 18537,
+    27466, 17868, -17868, 27466, 6786, 32056, -32056, 6786,
+    30424, 12166, -12166, 30424, 12909, 30116, -30116, 12909,
+    23452, 22883, -22883, 23452, 402, 32764, -32764, 402,
+};
+static const int16_t fft_hann_q15[257] = {
+    0, 1, 4, 11, 19, 30, 44, 60,
+    78, 99, 123, 149, 177, 208, 241, 276,
+    314, 355, 398, 443, 490, 541, 593, 648,
+    705, 765, 826, 891, 957, 1026, 1097, 1171,
+    1247, 1325, 1405, 1488, 1572, 1660, 1749, 1840,
+    1934, 2030, 2128, 2228, 2330, 2435, 2541, 2650,
+    2761, 2873, 2988, 3105, 3224, 3344, 3467, 3592,
+    3718, 3847, 3977, 4110, 4244, 4380, 4517, 4657,
+    4798, 4941, 5086, 5232, 5381, 5530, 5682, 5835,
+    5989, 6146, 6303, 6463, 6623, 6786, 6949, 7114,
+    7281, 7449, 7618, 7788, 7960, 8133, 8308, 8483,
+    8660, 8838, 9017, 9197, 9378, 9560, 9744, 9928,
+    10113, 10300, 10487, 10675, 10864, 11053, 11244, 11435,
+    11627, 11820, 12013, 12207, 12402, 12597, 12793, 12990,
+    13187, 13384, 13582, 13780, 13979, 14178, 14377, 14577,
+    14777, 14977, 15178, 15378, 15579, 15780, 15981, 16182,
+    16383, 16584, 16785, 16986, 17187, 17388, 17588, 17789,
+    17989, 18189, 18389, 18588, 18787, 18986, 19184, 19382,
+    19579, 19776, 19973, 20169, 20364, 20559, 20753, 20946,
+    21139, 21331, 21522, 21713, 21902, 22091, 22279, 22466,
+    22653, 22838, 23022, 23206, 23388, 23569, 23749, 23928,
+    24106, 24283, 24458, 24633, 24806, 24978, 25148, 25317,
+    25485, 25652, 25817, 25980, 26143, 26303, 26463, 26620,
+    26777, 26931, 27084, 27236, 27385, 27534, 27680, 27825,
+    27968, 28109, 28249, 28386, 28522, 28656, 28789, 28919,
+    29048, 29174, 29299, 29422, 29542, 29661, 29778, 29893,
+    30005, 30116, 30225, 30331, 30436, 30538, 30638, 30736,
+    30832, 30926, 31017, 31106, 31194, 31278, 31361, 31441,
+    31519, 31595, 31669, 31740, 31809, 31875, 31940, 32001,
+    32061, 32118, 32173, 32225, 32276, 32323, 32368, 32411,
+    32452, 32490, 32525, 32558, 32589, 32617, 32643, 32667,
+    32688, 32706, 32722, 32736, 32747, 32755, 32762, 32765,
+    32767,
+};
+#elif MAX_SIGNAL_LENGHT == 1024
+static const float fft_w_table_r2[1024] __attribute__((aligned(16))) = {
+    1.0f, 0.0f, 6.12323426e-17f, 1.0f, 0.707106769f, 0.707106769f, -0.707106769f, 0.707106769f,
+    0.923879504f, 0.382683426f, -0.382683426f, 0.923879504f, 0.382683426f, 0.923879504f, -0.923879504f, 0.382683426f,
+    0.980785251f, 0.195090324f, -0.195090324f, 0.980785251f, 0.555570245f, 0.831469595f, -0.831469595f, 0.555570245f,
+    0.831469595f, 0.555570245f, -0.555570245f, 0.831469595f, 0.195090324f, 0.980785251f, -0.980785251f, 0.195090324f,
+    0.99518472f, 0.0980171412f, -0.0980171412f, 0.99518472f, 0.634393275f, 0.773010433f, -0.773010433f, 0.634393275f,
+    0.881921291f, 0.471396744f, -0.471396744f, 0.881921291f, 0.290284663f, 0.956940353f, -0.956940353f, 0.290284663f,
+    0.956940353f, 0.290284663f, -0.290284663f, 0.956940353f, 0.471396744f, 0.881921291f, -0.881921291f, 0.471396744f,
+    0.773010433f, 0.634393275f, -0.634393275f, 0.773010433f, 0.0980171412f, 0.99518472f, -0.99518472f, 0.0980171412f,
+    0.99879545f, 0.0490676761f, -0.0490676761f, 0.99879545f, 0.671558976f, 0.740951121f, -0.740951121f, 0.671558976f,
+    0.903989315f, 0.427555084f, -0.427555084f, 0.903989315f, 0.336889863f, 0.941544056f, -0.941544056f, 0.336889863f,
+    0.970031261f, 0.242980182f, -0.242980182f, 0.970031261f, 0.514102757f, 0.857728601f, -0.857728601f, 0.514102757f,
+    0.803207517f, 0.59569931f, -0.59569931f, 0.803207517f, 0.146730468f, 0.989176512f, -0.989176512f, 0.146730468f,
+    0.989176512f, 0.146730468f, -0.146730468f, 0.989176512f, 0.59569931f, 0.803207517f, -0.803207517f, 0.59569931f,
+    0.857728601f, 0.514102757f, -0.514102757f, 0.857728601f, 0.242980182f, 0.970031261f, -0.970031261f, 0.242980182f,
+    0.941544056f, 0.336889863f, -0.336889863f, 0.941544056f, 0.427555084f, 0.903989315f, -0.903989315f, 0.427555084f,
+    0.740951121f, 0.671558976f, -0.671558976f, 0.740951121f, 0.0490676761f, 0.99879545f, -0.99879545f, 0.0490676761f,
+    0.999698818f, 0.024541229f, -0.024541229f, 0.999698818f, 0.689540565f, 0.724247098f, -0.724247098f, 0.689540565f,
+    0.914209783f, 0.405241311f, -0.405241311f, 0.914209783f, 0.359895051f, 0.932992816f, -0.932992816f, 0.359895051f,
+    0.975702107f, 0.219101235f, -0.219101235f, 0.975702107f, 0.534997642f, 0.84485358f, -0.84485358f, 0.534997642f,
+    0.817584813f, 0.575808167f, -0.575808167f, 0.817584813f, 0.170961887f, 0.985277653f, -0.985277653f, 0.170961887f,
+    0.992479563f, 0.122410677f, -0.122410677f, 0.992479563f, 0.615231574f, 0.78834641f, -0.78834641f, 0.615231574f,
+    0.870086968f, 0.492898196f, -0.492898196f, 0.870086968f, 0.266712755f, 0.963776052f, -0.963776052f, 0.266712755f,
+    0.949528158f, 0.313681751f, -0.313681751f, 0.949528158f, 0.449611336f, 0.893224299f, -0.893224299f, 0.449611336f,
+    0.757208824f, 0.653172851f, -0.653172851f, 0.757208824f, 0.0735645667f, 0.997290432f, -0.997290432f, 0.0735645667f,
+    0.997290432f, 0.0735645667f, -0.0735645667f, 0.997290432f, 0.653172851f, 0.757208824f, -0.757208824f, 0.653172851f,
+    0.893224299f, 0.449611336f, -0.449611336f, 0.893224299f, 0.313681751f, 0.949528158f, -0.949528158f, 0.313681751f,
+    0.963776052f, 0.266712755f, -0.266712755f, 0.963776052f, 0.492898196f, 0.870086968f, -0.870086968f, 0.492898196f,
+    0.78834641f, 0.615231574f, -0.615231574f, 0.78834641f, 0.122410677f, 0.992479563f, -0.992479563f, 0.122410677f,
+    0.985277653f, 0.170961887f, -0.170961887f, 0.985277653f, 0.575808167f, 0.817584813f, -0.817584813f, 0.575808167f,
+    0.84485358f, 0.534997642f, -0.534997642f, 0.84485358f, 0.219101235f, 0.975702107f, -0.975702107f, 0.219101235f,
+    0.932992816f, 0.359895051f, -0.359895051f, 0.932992816f, 0.405241311f, 0.914209783f, -0.914209783f, 0.405241311f,
+    0.724247098f, 0.689540565f, -0.689540565f, 0.724247098f, 0.024541229f, 0.999698818f, -0.999698818f, 0.024541229f,
+    0.999924719f, 0.0122715384f, -0.0122715384f, 0.999924719f, 0.698376238f, 0.715730846f, -0.715730846f, 0.698376238f,
+    0.919113874f, 0.393992037f, -0.393992037f, 0.919113874f, 0.371317208f, 0.928506076f, -0.928506076f, 0.371317208f,
+    0.97831738f, 0.207111374f, -0.207111374f, 0.97831738f, 0.545324981f, 0.838224709f, -0.838224709f, 0.545324981f,
+    0.824589312f, 0.565731823f, -0.565731823f, 0.824589312f, 0.183039889f, 0.983105481f, -0.983105481f, 0.183039889f,
+    0.993906975f, 0.110222206f, -0.110222206f, 0.993906975f, 0.624859512f, 0.780737221f, -0.780737221f, 0.624859512f,
+    0.876070082f, 0.482183784f, -0.482183784f, 0.876070082f, 0.27851969f, 0.960430503f, -0.960430503f, 0.27851969f,
+    0.953306019f, 0.302005947f, -0.302005947f, 0.953306019f, 0.460538715f, 0.887639642f, -0.887639642f, 0.460538715f,
+    0.765167236f, 0.643831551f, -0.643831551f, 0.765167236f, 0.0857973099f, 0.996312618f, -0.996312618f, 0.0857973099f,
+    0.998118103f, 0.061320737f, -0.061320737f, 0.998118103f, 0.662415802f, 0.749136388f, -0.749136388f, 0.662415802f,
+    0.898674488f, 0.438616246f, -0.438616246f, 0.898674488f, 0.32531029f, 0.945607305f, -0.945607305f, 0.32531029f,
+    0.966976464f, 0.254865646f, -0.254865646f, 0.966976464f, 0.50353837f, 0.863972843f, -0.863972843f, 0.50353837f,
+    0.795836926f, 0.605511069f, -0.605511069f, 0.795836926f, 0.134580702f, 0.990902662f, -0.990902662f, 0.134580702f,
+    0.987301409f, 0.15885815f, -0.15885815f, 0.987301409f, 0.585797846f, 0.81045717f, -0.81045717f, 0.585797846f,
+    0.851355195f, 0.524589658f, -0.524589658f, 0.851355195f, 0.231058106f, 0.972939968f, -0.972939968f, 0.231058106f,
+    0.937339008f, 0.348418683f, -0.348418683f, 0.937339008f, 0.416429549f, 0.909168005f, -0.909168005f, 0.416429549f,
+    0.732654274f, 0.680601001f, -0.680601001f, 0.732654274f, 0.0368072242f, 0.999322355f, -0.999322355f, 0.0368072242f,
+    0.999322355f, 0.0368072242f, -0.0368072242f, 0.999322355f, 0.680601001f, 0.732654274f, -0.732654274f, 0.680601001f,
+    0.909168005f, 0.416429549f, -0.416429549f, 0.909168005f, 0.348418683f, 0.937339008f, -0.937339008f, 0.348418683f,
+    0.972939968f, 0.231058106f, -0.231058106f, 0.972939968f, 0.524589658f, 0.851355195f, -0.851355195f, 0.524589658f,
+    0.81045717f, 0.585797846f, -0.585797846f, 0.81045717f, 0.15885815f, 0.987301409f, -0.987301409f, 0.15885815f,
+    0.990902662f, 0.134580702f, -0.134580702f, 0.990902662f, 0.605511069f, 0.795836926f, -0.795836926f, 0.605511069f,
+    0.863972843f, 0.50353837f, -0.50353837f, 0.863972843f, 0.254865646f, 0.966976464f, -0.966976464f, 0.254865646f,
+    0.945607305f, 0.32531029f, -0.32531029f, 0.945607305f, 0.438616246f, 0.898674488f, -0.898674488f, 0.438616246f,
+    0.749136388f, 0.662415802f, -0.662415802f, 0.749136388f, 0.061320737f, 0.998118103f, -0.998118103f, 0.061320737f,
+    0.996312618f, 0.0857973099f, -0.0857973099f, 0.996312618f, 0.643831551f, 0.765167236f, -0.765167236f, 0.643831551f,
+    0.887639642f, 0.460538715f, -0.460538715f, 0.887639642f, 0.302005947f, 0.953306019f, -0.953306019f, 0.302005947f,
+    0.960430503f, 0.27851969f, -0.27851969f, 0.960430503f, 0.482183784f, 0.876070082f, -0.876070082f, 0.482183784f,
+    0.780737221f, 0.624859512f, -0.624859512f, 0.780737221f, 0.110222206f, 0.993906975f, -0.993906975f, 0.110222206f,
+    0.983105481f, 0.183039889f, -0.183039889f, 0.983105481f, 0.565731823f, 0.824589312f, -0.824589312f, 0.565731823f,
+    0.838224709f, 0.545324981f, -0.545324981f, 0.838224709f, 0.207111374f, 0.97831738f, -0.97831738f, 0.207111374f,
+    0.928506076f, 0.371317208f, -0.371317208f, 0.928506076f, 0.393992037f, 0.919113874f, -0.919113874f, 0.393992037f,
+    0.715730846f, 0.698376238f, -0.698376238f, 0.715730846f, 0.0122715384f, 0.999924719f, -0.999924719f, 0.0122715384f,
+    0.999981165f, 0.00613588467f, -0.00613588467f, 0.999981165f, 0.702754736f, 0.711432219f, -0.711432219f, 0.702754736f,
+    0.921514034f, 0.388345033f, -0.388345033f, 0.921514034f, 0.377007425f, 0.926210225f, -0.926210225f, 0.377007425f,
+    0.979569793f, 0.201104641f, -0.201104641f, 0.979569793f, 0.550457954f, 0.834862888f, -0.834862888f, 0.550457954f,
+    0.82804507f, 0.560661554f, -0.560661554f, 0.82804507f, 0.18906866f, 0.981963873f, -0.981963873f, 0.18906866f,
+    0.994564593f, 0.104121633f, -0.104121633f, 0.994564593f, 0.629638255f, 0.77688849f, -0.77688849f, 0.629638255f,
+    0.879012227f, 0.47679922f, -0.47679922f, 0.879012227f, 0.284407526f, 0.958703458f, -0.958703458f, 0.284407526f,
+    0.955141187f, 0.296150893f, -0.296150893f, 0.955141187f, 0.465976506f, 0.884797096f, -0.884797096f, 0.465976506f,
+    0.769103348f, 0.639124453f, -0.639124453f, 0.769103348f, 0.0919089541f, 0.995767415f, -0.995767415f, 0.0919089541f,
+    0.998475552f, 0.0551952459f, -0.0551952459f, 0.998475552f, 0.666999936f, 0.745057762f, -0.745057762f, 0.666999936f,
+    0.901348829f, 0.433093816f, -0.433093816f, 0.901348829f, 0.331106305f, 0.943593442f, -0.943593442f, 0.331106305f,
+    0.968522072f, 0.248927608f, -0.248927608f, 0.968522072f, 0.50883013f, 0.860866964f, -0.860866964f, 0.50883013f,
+    0.799537241f, 0.600616455f, -0.600616455f, 0.799537241f, 0.140658244f, 0.990058184f, -0.990058184f, 0.140658244f,
+    0.988257587f, 0.152797192f, -0.152797192f, 0.988257587f, 0.590759695f, 0.806847572f, -0.806847572f, 0.590759695f,
+    0.854557991f, 0.519356012f, -0.519356012f, 0.854557991f, 0.237023607f, 0.971503913f, -0.971503913f, 0.237023607f,
+    0.939459205f, 0.342660725f, -0.342660725f, 0.939459205f, 0.422000259f, 0.906595707f, -0.906595707f, 0.422000259f,
+    0.736816585f, 0.676092684f, -0.676092684f, 0.736816585f, 0.0429382585f, 0.999077737f, -0.999077737f, 0.0429382585f,
+    0.999529421f, 0.030674804f, -0.030674804f, 0.999529421f, 0.685083687f, 0.728464365f, -0.728464365f, 0.685083687f,
+    0.91170603f, 0.410843164f, -0.410843164f, 0.91170603f, 0.354163527f, 0.935183525f, -0.935183525f, 0.354163527f,
+    0.974339366f, 0.225083917f, -0.225083917f, 0.974339366f, 0.529803634f, 0.848120332f, -0.848120332f, 0.529803634f,
+    0.81403631f, 0.580813944f, -0.580813944f, 0.81403631f, 0.164913118f, 0.986308098f, -0.986308098f, 0.164913118f,
+    0.991709769f, 0.128498107f, -0.128498107f, 0.991709769f, 0.610382795f, 0.792106569f, -0.792106569f, 0.610382795f,
+    0.867046237f, 0.498227656f, -0.498227656f, 0.867046237f, 0.260794103f, 0.965394437f, -0.965394437f, 0.260794103f,
+    0.947585583f, 0.319502026f, -0.319502026f, 0.947585583f, 0.444122136f, 0.895966232f, -0.895966232f, 0.444122136f,
+    0.753186822f, 0.657806695f, -0.657806695f, 0.753186822f, 0.0674439222f, 0.997723043f, -0.997723043f, 0.0674439222f,
+    0.996820271f, 0.0796824396f, -0.0796824396f, 0.996820271f, 0.64851439f, 0.761202395f, -0.761202395f, 0.64851439f,
+    0.890448749f, 0.455083579f, -0.455083579f, 0.890448749f, 0.307849646f, 0.95143503f, -0.95143503f, 0.307849646f,
+    0.962121427f, 0.272621363f, -0.272621363f, 0.962121427f, 0.487550169f, 0.873094976f, -0.873094976f, 0.487550169f,
+    0.784556568f, 0.620057225f, -0.620057225f, 0.784556568f, 0.116318628f, 0.993211925f, -0.993211925f, 0.116318628f,
+    0.984210074f, 0.177004218f, -0.177004218f, 0.984210074f, 0.570780754f, 0.8211025f, -0.8211025f, 0.570780754f,
+    0.841554999f, 0.540171444f, -0.540171444f, 0.841554999f, 0.213110313f, 0.977028131f, -0.977028131f, 0.213110313f,
+    0.93076694f, 0.365612984f, -0.365612984f, 0.93076694f, 0.399624199f, 0.916679084f, -0.916679084f, 0.399624199f,
+    0.720002532f, 0.693971455f, -0.693971455f, 0.720002532f, 0.0184067301f, 0.999830604f, -0.999830604f, 0.0184067301f,
+    0.999830604f, 0.0184067301f, -0.0184067301f, 0.999830604f, 0.693971455f, 0.720002532f, -0.720002532f, 0.693971455f,
+    0.916679084f, 0.399624199f, -0.399624199f, 0.916679084f, 0.365612984f, 0.93076694f, -0.93076694f, 0.365612984f,
+    0.977028131f, 0.213110313f, -0.213110313f, 0.977028131f, 0.540171444f, 0.841554999f, -0.841554999f, 0.540171444f,
+    0.8211025f, 0.570780754f, -0.570780754f, 0.8211025f, 0.177004218f, 0.984210074f, -0.984210074f, 0.177004218f,
+    0.993211925f, 0.116318628f, -0.116318628f, 0.993211925f, 0.620057225f, 0.784556568f, -0.784556568f, 0.620057225f,
+    0.873094976f, 0.487550169f, -0.487550169f, 0.873094976f, 0.272621363f, 0.962121427f, -0.962121427f, 0.272621363f,
+    0.95143503f, 0.307849646f, -0.307849646f, 0.95143503f, 0.455083579f, 0.890448749f, -0.890448749f, 0.455083579f,
+    0.761202395f, 0.64851439f, -0.64851439f, 0.761202395f, 0.0796824396f, 0.996820271f, -0.996820271f, 0.0796824396f,
+    0.997723043f, 0.0674439222f, -0.0674439222f, 0.997723043f, 0.657806695f, 0.753186822f, -0.753186822f, 0.657806695f,
+    0.895966232f, 0.444122136f, -0.444122136f, 0.895966232f, 0.319502026f, 0.947585583f, -0.947585583f, 0.319502026f,
+    0.965394437f, 0.260794103f, -0.260794103f, 0.965394437f, 0.498227656f, 0.867046237f, -0.867046237f, 0.498227656f,
+    0.792106569f, 0.610382795f, -0.610382795f, 0.792106569f, 0.128498107f, 0.991709769f, -0.991709769f, 0.128498107f,
+    0.986308098f, 0.164913118f, -0.164913118f, 0.986308098f, 0.580813944f, 0.81403631f, -0.81403631f, 0.580813944f,
+    0.848120332f, 0.529803634f, -0.529803634f, 0.848120332f, 0.225083917f, 0.974339366f, -0.974339366f, 0.225083917f,
+    0.935183525f, 0.354163527f, -0.354163527f, 0.935183525f, 0.410843164f, 0.91170603f, -0.91170603f, 0.410843164f,
+    0.728464365f, 0.685083687f, -0.685083687f, 0.728464365f, 0.030674804f, 0.999529421f, -0.999529421f, 0.030674804f,
+    0.999077737f, 0.0429382585f, -0.0429382585f, 0.999077737f, 0.676092684f, 0.736816585f, -0.736816585f, 0.676092684f,
+    0.906595707f, 0.422000259f, -0.422000259f, 0.906595707f, 0.342660725f, 0.939459205f, -0.939459205f, 0.342660725f,
+    0.971503913f, 0.237023607f, -0.237023607f, 0.971503913f, 0.519356012f, 0.854557991f, -0.854557991f, 0.519356012f,
+    0.806847572f, 0.590759695f, -0.590759695f, 0.806847572f, 0.152797192f, 0.988257587f, -0.988257587f, 0.152797192f,
+    0.990058184f, 0.140658244f, -0.140658244f, 0.990058184f, 0.600616455f, 0.799537241f, -0.799537241f, 0.600616455f,
+    0.860866964f, 0.50883013f, -0.50883013f, 0.860866964f, 0.248927608f, 0.968522072f, -0.968522072f, 0.248927608f,
+    0.943593442f, 0.331106305f, -0.331106305f, 0.943593442f, 0.433093816f, 0.901348829f, -0.901348829f, 0.433093816f,
+    0.745057762f, 0.666999936f, -0.666999936f, 0.745057762f, 0.0551952459f, 0.998475552f, -0.998475552f, 0.0551952459f,
+    0.995767415f, 0.0919089541f, -0.0919089541f, 0.995767415f, 0.639124453f, 0.769103348f, -0.769103348f, 0.639124453f,
+    0.884797096f, 0.465976506f, -0.465976506f, 0.884797096f, 0.296150893f, 0.955141187f, -0.955141187f, 0.296150893f,
+    0.958703458f, 0.284407526f, -0.284407526f, 0.958703458f, 0.47679922f, 0.879012227f, -0.879012227f, 0.47679922f,
+    0.77688849f, 0.629638255f, -0.629638255f, 0.77688849f, 0.104121633f, 0.994564593f, -0.994564593f, 0.104121633f,
+    0.981963873f, 0.18906866f, -0.18906866f, 0.981963873f, 0.560661554f, 0.82804507f, -0.82804507f, 0.560661554f,
+    0.834862888f, 0.550457954f, -0.550457954f, 0.834862888f, 0.201104641f, 0.979569793f, -0.979569793f, 0.201104641f,
+    0.926210225f, 0.377007425f, -0.377007425f, 0.926210225f, 0.388345033f, 0.921514034f, -0.921514034f, 0.388345033f,
+    0.711432219f, 0.702754736f, -0.702754736f, 0.711432219f, 0.00613588467f, 0.999981165f, -0.999981165f, 0.00613588467f,
+};
+static const float fft_w_table_r4[2048] __attribute__((aligned(16))) = {
+    1.0f, 0.0f, 0.999981165f, 0.00613588467f, 0.999924719f, 0.0122715384f, 0.999830604f, 0.0184067301f,
+    0.999698818f, 0.024541229f, 0.999529421f, 0.030674804f, 0.999322355f, 0.0368072242f, 0.999077737f, 0.0429382585f,
+    0.99879545f, 0.0490676761f, 0.998475552f, 0.0551952459f, 0.998118103f, 0.061320737f, 0.997723043f, 0.0674439222f,
+    0.997290432f, 0.0735645667f, 0.996820271f, 0.0796824396f, 0.996312618f, 0.0857973099f, 0.995767415f, 0.0919089541f,
+    0.99518472f, 0.0980171412f, 0.994564593f, 0.104121633f, 0.993906975f, 0.110222206f, 0.993211925f, 0.116318628f,
+    0.992479563f, 0.122410677f, 0.991709769f, 0.128498107f, 0.990902662f, 0.134580702f, 0.990058184f, 0.140658244f,
+    0.989176512f, 0.146730468f, 0.988257587f, 0.152797192f, 0.987301409f, 0.15885815f, 0.986308098f, 0.164913118f,
+    0.985277653f, 0.170961887f, 0.984210074f, 0.177004218f, 0.983105481f, 0.183039889f, 0.981963873f, 0.18906866f,
+    0.980785251f, 0.195090324f, 0.979569793f, 0.201104641f, 0.97831738f, 0.207111374f, 0.977028131f, 0.213110313f,
+    0.975702107f, 0.219101235f, 0.974339366f, 0.225083917f, 0.972939968f, 0.231058106f, 0.971503913f, 0.237023607f,
+    0.970031261f, 0.242980182f, 0.968522072f, 0.248927608f, 0.966976464f, 0.254865646f, 0.965394437f, 0.260794103f,
+    0.963776052f, 0.266712755f, 0.962121427f, 0.272621363f, 0.960430503f, 0.27851969f, 0.958703458f, 0.284407526f,
+    0.956940353f, 0.290284663f, 0.955141187f, 0.296150893f, 0.953306019f, 0.302005947f, 0.95143503f, 0.307849646f,
+    0.949528158f, 0.313681751f, 0.947585583f, 0.319502026f, 0.945607305f, 0.32531029f, 0.943593442f, 0.331106305f,
+    0.941544056f, 0.336889863f, 0.939459205f, 0.342660725f, 0.937339008f, 0.348418683f, 0.935183525f, 0.354163527f,
+    0.932992816f, 0.359895051f, 0.93076694f, 0.365612984f, 0.928506076f, 0.371317208f, 0.926210225f, 0.377007425f,
+    0.923879504f, 0.382683426f, 0.921514034f, 0.388345033f, 0.919113874f, 0.393992037f, 0.916679084f, 0.399624199f,
+    0.914209783f, 0.405241311f, 0.91170603f, 0.410843164f, 0.909168005f, 0.416429549f, 0.906595707f, 0.422000259f,
+    0.903989315f, 0.427555084f, 0.901348829f, 0.433093816f, 0.898674488f, 0.438616246f, 0.895966232f, 0.444122136f,
+    0.893224299f, 0.449611336f, 0.890448749f, 0.455083579f, 0.887639642f, 0.460538715f, 0.884797096f, 0.465976506f,
+    0.881921291f, 0.471396744f, 0.879012227f, 0.47679922f, 0.876070082f, 0.482183784f, 0.873094976f, 0.487550169f,
+    0.870086968f, 0.492898196f, 0.867046237f, 0.498227656f, 0.863972843f, 0.50353837f, 0.860866964f, 0.50883013f,
+    0.857728601f, 0.514102757f, 0.854557991f, 0.519356012f, 0.851355195f, 0.524589658f, 0.848120332f, 0.529803634f,
+    0.84485358f, 0.534997642f, 0.841554999f, 0.540171444f, 0.838224709f, 0.545324981f, 0.834862888f, 0.550457954f,
+    0.831469595f, 0.555570245f, 0.82804507f, 0.560661554f, 0.824589312f, 0.565731823f, 0.8211025f, 0.570780754f,
+    0.817584813f, 0.575808167f, 0.81403631f, 0.580813944f, 0.81045717f, 0.585797846f, 0.806847572f, 0.590759695f,
+    0.803207517f, 0.59569931f, 0.799537241f, 0.600616455f, 0.795836926f, 0.605511069f, 0.792106569f, 0.610382795f,
+    0.78834641f, 0.615231574f, 0.784556568f, 0.620057225f, 0.780737221f, 0.624859512f, 0.77688849f, 0.629638255f,
+    0.773010433f, 0.634393275f, 0.769103348f, 0.639124453f, 0.765167236f, 0.643831551f, 0.761202395f, 0.64851439f,
+    0.757208824f, 0.653172851f, 0.753186822f, 0.657806695f, 0.749136388f, 0.662415802f, 0.745057762f, 0.666999936f,
+    0.740951121f, 0.671558976f, 0.736816585f, 0.676092684f, 0.732654274f, 0.680601001f, 0.728464365f, 0.685083687f,
+    0.724247098f, 0.689540565f, 0.720002532f, 0.693971455f, 0.715730846f, 0.698376238f, 0.711432219f, 0.702754736f,
+    0.707106769f, 0.707106769f, 0.702754736f, 0.711432219f, 0.698376238f, 0.715730846f, 0.693971455f, 0.720002532f,
+    0.689540565f, 0.724247098f, 0.685083687f, 0.728464365f, 0.680601001f, 0.732654274f, 0.676092684f, 0.736816585f,
+    0.671558976f, 0.740951121f, 0.666999936f, 0.745057762f, 0.662415802f, 0.749136388f, 0.657806695f, 0.753186822f,
+    0.653172851f, 0.757208824f, 0.64851439f, 0.761202395f, 0.643831551f, 0.765167236f, 0.639124453f, 0.769103348f,
+    0.634393275f, 0.773010433f, 0.629638255f, 0.77688849f, 0.624859512f, 0.780737221f, 0.620057225f, 0.784556568f,
+    0.615231574f, 0.78834641f, 0.610382795f, 0.792106569f, 0.605511069f, 0.795836926f, 0.600616455f, 0.799537241f,
+    0.59569931f, 0.803207517f, 0.590759695f, 0.806847572f, 0.585797846f, 0.81045717f, 0.580813944f, 0.81403631f,
+    0.575808167f, 0.817584813f, 0.570780754f, 0.8211025f, 0.565731823f, 0.824589312f, 0.560661554f, 0.82804507f,
+    0.555570245f, 0.831469595f, 0.550457954f, 0.834862888f, 0.545324981f, 0.838224709f, 0.540171444f, 0.841554999f,
+    0.534997642f, 0.84485358f, 0.529803634f, 0.848120332f, 0.524589658f, 0.851355195f, 0.519356012f, 0.854557991f,
+    0.514102757f, 0.857728601f, 0.50883013f, 0.860866964f, 0.50353837f, 0.863972843f, 0.498227656f, 0.867046237f,
+    0.492898196f, 0.870086968f, 0.487550169f, 0.873094976f, 0.482183784f, 0.876070082f, 0.47679922f, 0.879012227f,
+    0.471396744f, 0.881921291f, 0.465976506f, 0.884797096f, 0.460538715f, 0.887639642f, 0.455083579f, 0.890448749f,
+    0.449611336f, 0.893224299f, 0.444122136f, 0.895966232f, 0.438616246f, 0.898674488f, 0.433093816f, 0.901348829f,
+    0.427555084f, 0.903989315f, 0.422000259f, 0.906595707f, 0.416429549f, 0.909168005f, 0.410843164f, 0.91170603f,
+    0.405241311f, 0.914209783f, 0.399624199f, 0.916679084f, 0.393992037f, 0.919113874f, 0.388345033f, 0.921514034f,
+    0.382683426f, 0.923879504f, 0.377007425f, 0.926210225f, 0.371317208f, 0.928506076f, 0.365612984f, 0.93076694f,
+    0.359895051f, 0.932992816f, 0.354163527f, 0.935183525f, 0.348418683f, 0.937339008f, 0.342660725f, 0.939459205f,
+    0.336889863f, 0.941544056f, 0.331106305f, 0.943593442f, 0.32531029f, 0.945607305f, 0.319502026f, 0.947585583f,
+    0.313681751f, 0.949528158f, 0.307849646f, 0.95143503f, 0.302005947f, 0.953306019f, 0.296150893f, 0.955141187f,
+    0.290284663f, 0.956940353f, 0.284407526f, 0.958703458f, 0.27851969f, 0.960430503f, 0.272621363f, 0.962121427f,
+    0.266712755f, 0.963776052f, 0.260794103f, 0.965394437f, 0.254865646f, 0.966976464f, 0.248927608f, 0.968522072f,
+    0.242980182f, 0.970031261f, 0.237023607f, 0.971503913f, 0.231058106f, 0.972939968f, 0.225083917f, 0.974339366f,
+    0.219101235f, 0.975702107f, 0.213110313f, 0.977028131f, 0.207111374f, 0.97831738f, 0.201104641f, 0.979569793f,
+    0.195090324f, 0.980785251f, 0.18906866f, 0.981963873f, 0.183039889f, 0.983105481f, 0.177004218f, 0.984210074f,
+    0.170961887f, 0.985277653f, 0.164913118f, 0.986308098f, 0.15885815f, 0.987301409f, 0.152797192f, 0.988257587f,
+    0.146730468f, 0.989176512f, 0.140658244f, 0.990058184f, 0.134580702f, 0.990902662f, 0.128498107f, 0.991709769f,
+    0.122410677f, 0.992479563f, 0.116318628f, 0.993211925f, 0.110222206f, 0.993906975f, 0.104121633f, 0.994564593f,
+    0.0980171412f, 0.99518472f, 0.0919089541f, 0.995767415f, 0.0857973099f, 0.996312618f, 0.0796824396f, 0.996820271f,
+    0.0735645667f, 0.997290432f, 0.0674439222f, 0.997723043f, 0.061320737f, 0.998118103f, 0.0551952459f, 0.998475552f,
+    0.0490676761f, 0.99879545f, 0.0429382585f, 0.999077737f, 0.0368072242f, 0.999322355f, 0.030674804f, 0.999529421f,
+    0.024541229f, 0.999698818f, 0.0184067301f, 0.999830604f, 0.0122715384f, 0.999924719f, 0.00613588467f, 0.999981165f,
+    6.12323426e-17f, 1.0f, -0.00613588467f, 0.999981165f, -0.0122715384f, 0.999924719f, -0.0184067301f, 0.999830604f,
+    -0.024541229f, 0.999698818f, -0.030674804f, 0.999529421f, -0.0368072242f, 0.999322355f, -0.0429382585f, 0.999077737f,
+    -0.0490676761f, 0.99879545f, -0.0551952459f, 0.998475552f, -0.061320737f, 0.998118103f, -0.0674439222f, 0.997723043f,
+    -0.0735645667f, 0.997290432f, -0.0796824396f, 0.996820271f, -0.0857973099f, 0.996312618f, -0.0919089541f, 0.995767415f,
+    -0.0980171412f, 0.99518472f, -0.104121633f, 0.994564593f, -0.110222206f, 0.993906975f, -0.116318628f, 0.993211925f,
+    -0.122410677f, 0.992479563f, -0.128498107f, 0.991709769f, -0.134580702f, 0.990902662f, -0.140658244f, 0.990058184f,
+    -0.146730468f, 0.989176512f, -0.152797192f, 0.988257587f, -0.15885815f, 0.987301409f, -0.164913118f, 0.986308098f,
+    -0.170961887f, 0.985277653f, -0.177004218f, 0.984210074f, -0.183039889f, 0.983105481f, -0.18906866f, 0.981963873f,
+    -0.195090324f, 0.980785251f, -0.201104641f, 0.979569793f, -0.207111374f, 0.97831738f, -0.213110313f, 0.977028131f,
+    -0.219101235f, 0.975702107f, -0.225083917f, 0.974339366f, -0.231058106f, 0.972939968f, -0.237023607f, 0.971503913f,
+    -0.242980182f, 0.970031261f, -0.248927608f, 0.968522072f, -0.254865646f, 0.966976464f, -0.260794103f, 0.965394437f,
+    -0.266712755f, 0.963776052f, -0.272621363f, 0.962121427f, -0.27851969f, 0.960430503f, -0.284407526f, 0.958703458f,
+    -0.290284663f, 0.956940353f, -0.296150893f, 0.955141187f, -0.302005947f, 0.953306019f, -0.307849646f, 0.95143503f,
+    -0.313681751f, 0.949528158f, -0.319502026f, 0.947585583f, -0.32531029f, 0.945607305f, -0.331106305f, 0.943593442f,
+    -0.336889863f, 0.941544056f, -0.342660725f, 0.939459205f, -0.348418683f, 0.937339008f, -0.354163527f, 0.935183525f,
+    -0.359895051f, 0.932992816f, -0.365612984f, 0.93076694f, -0.371317208f, 0.928506076f, -0.377007425f, 0.926210225f,
+    -0.382683426f, 0.923879504f, -0.388345033f, 0.921514034f, -0.393992037f, 0.919113874f, -0.399624199f, 0.916679084f,
+    -0.405241311f, 0.914209783f, -0.410843164f, 0.91170603f, -0.416429549f, 0.909168005f, -0.422000259f, 0.906595707f,
+    -0.427555084f, 0.903989315f, -0.433093816f, 0.901348829f, -0.438616246f, 0.898674488f, -0.444122136f, 0.895966232f,
+    -0.449611336f, 0.893224299f, -0.455083579f, 0.890448749f, -0.460538715f, 0.887639642f, -0.465976506f, 0.884797096f,
+    -0.471396744f, 0.881921291f, -0.47679922f, 0.879012227f, -0.482183784f, 0.876070082f, -0.487550169f, 0.873094976f,
+    -0.492898196f, 0.870086968f, -0.498227656f, 0.867046237f, -0.50353837f, 0.863972843f, -0.50883013f, 0.860866964f,
+    -0.514102757f, 0.857728601f, -0.519356012f, 0.854557991f, -0.524589658f, 0.851355195f, -0.529803634f, 0.848120332f,
+    -0.534997642f, 0.84485358f, -0.540171444f, 0.841554999f, -0.545324981f, 0.838224709f, -0.550457954f, 0.834862888f,
+    -0.555570245f, 0.831469595f, -0.560661554f, 0.82804507f, -0.565731823f, 0.824589312f, -0.570780754f, 0.8211025f,
+    -0.575808167f, 0.817584813f, -0.580813944f, 0.81403631f, -0.585797846f, 0.81045717f, -0.590759695f, 0.806847572f,
+    -0.59569931f, 0.803207517f, -0.600616455f, 0.799537241f, -0.605511069f, 0.795836926f, -0.610382795f, 0.792106569f,
+    -0.615231574f, 0.78834641f, -0.620057225f, 0.784556568f, -0.624859512f, 0.780737221f, -0.629638255f, 0.77688849f,
+    -0.634393275f, 0.773010433f, -0.639124453f, 0.769103348f, -0.643831551f, 0.765167236f, -0.64851439f, 0.761202395f,
+    -0.653172851f, 0.757208824f, -0.657806695f, 0.753186822f, -0.662415802f, 0.749136388f, -0.666999936f, 0.745057762f,
+    -0.671558976f, 0.740951121f, -0.676092684f, 0.736816585f, -0.680601001f, 0.732654274f, -0.685083687f, 0.728464365f,
+    -0.689540565f, 0.724247098f, -0.693971455f, 0.720002532f, -0.698376238f, 0.715730846f, -0.702754736f, 0.711432219f,
+    -0.707106769f, 0.707106769f, -0.711432219f, 0.702754736f, -0.715730846f, 0.698376238f, -0.720002532f, 0.693971455f,
+    -0.724247098f, 0.689540565f, -0.728464365f, 0.685083687f, -0.732654274f, 0.680601001f, -0.736816585f, 0.676092684f,
+    -0.740951121f, 0.671558976f, -0.745057762f, 0.666999936f, -0.749136388f, 0.662415802f, -0.753186822f, 0.657806695f,
+    -0.757208824f, 0.653172851f, -0.761202395f, 0.64851439f, -0.765167236f, 0.643831551f, -0.769103348f, 0.639124453f,
+    -0.773010433f, 0.634393275f, -0.77688849f, 0.629638255f, -0.780737221f, 0.624859512f, -0.784556568f, 0.620057225f,
+    -0.78834641f, 0.615231574f, -0.792106569f, 0.610382795f, -0.795836926f, 0.605511069f, -0.799537241f, 0.600616455f,
+    -0.803207517f, 0.59569931f, -0.806847572f, 0.590759695f, -0.81045717f, 0.585797846f, -0.81403631f, 0.580813944f,
+    -0.817584813f, 0.575808167f, -0.8211025f, 0.570780754f, -0.824589312f, 0.565731823f, -0.82804507f, 0.560661554f,
+    -0.831469595f, 0.555570245f, -0.834862888f, 0.550457954f, -0.838224709f, 0.545324981f, -0.841554999f, 0.540171444f,
+    -0.84485358f, 0.534997642f, -0.848120332f, 0.529803634f, -0.851355195f, 0.524589658f, -0.854557991f, 0.519356012f,
+    -0.857728601f, 0.514102757f, -0.860866964f, 0.50883013f, -0.863972843f, 0.50353837f, -0.867046237f, 0.498227656f,
+    -0.870086968f, 0.492898196f, -0.873094976f, 0.487550169f, -0.876070082f, 0.482183784f, -0.879012227f, 0.47679922f,
+    -0.881921291f, 0.471396744f, -0.884797096f, 0.465976506f, -0.887639642f, 0.460538715f, -0.890448749f, 0.455083579f,
+    -0.893224299f, 0.449611336f, -0.895966232f, 0.444122136f, -0.898674488f, 0.438616246f, -0.901348829f, 0.433093816f,
+    -0.903989315f, 0.427555084f, -0.906595707f, 0.422000259f, -0.909168005f, 0.416429549f, -0.91170603f, 0.410843164f,
+    -0.914209783f, 0.405241311f, -0.916679084f, 0.399624199f, -0.919113874f, 0.393992037f, -0.921514034f, 0.388345033f,
+    -0.923879504f, 0.382683426f, -0.926210225f, 0.377007425f, -0.928506076f, 0.371317208f, -0.93076694f, 0.365612984f,
+    -0.932992816f, 0.359895051f, -0.935183525f, 0.354163527f, -0.937339008f, 0.348418683f, -0.939459205f, 0.342660725f,
+    -0.941544056f, 0.336889863f, -0.943593442f, 0.331106305f, -0.945607305f, 0.32531029f, -0.947585583f, 0.319502026f,
+    -0.949528158f, 0.313681751f, -0.95143503f, 0.307849646f, -0.953306019f, 0.302005947f, -0.955141187f, 0.296150893f,
+    -0.956940353f, 0.290284663f, -0.958703458f, 0.284407526f, -0.960430503f, 0.27851969f, -0.962121427f, 0.272621363f,
+    -0.963776052f, 0.266712755f, -0.965394437f, 0.260794103f, -0.966976464f, 0.254865646f, -0.968522072f, 0.248927608f,
+    -0.970031261f, 0.242980182f, -0.971503913f, 0.237023607f, -0.972939968f, 0.231058106f, -0.974339366f, 0.225083917f,
+    -0.975702107f, 0.219101235f, -0.977028131f, 0.213110313f, -0.97831738f, 0.207111374f, -0.979569793f, 0.201104641f,
+    -0.980785251f, 0.195090324f, -0.981963873f, 0.18906866f, -0.983105481f, 0.183039889f, -0.984210074f, 0.177004218f,
+    -0.985277653f, 0.170961887f, -0.986308098f, 0.164913118f, -0.987301409f, 0.15885815f, -0.988257587f, 0.152797192f,
+    -0.989176512f, 0.146730468f, -0.990058184f, 0.140658244f, -0.990902662f, 0.134580702f, -0.991709769f, 0.128498107f,
+    -0.992479563f, 0.122410677f, -0.993211925f, 0.116318628f, -0.993906975f, 0.110222206f, -0.994564593f, 0.104121633f,
+    -0.99518472f, 0.0980171412f, -0.995767415f, 0.0919089541f, -0.996312618f, 0.0857973099f, -0.996820271f, 0.0796824396f,
+    -0.997290432f, 0.0735645667f, -0.997723043f, 0.0674439222f, -0.998118103f, 0.061320737f, -0.998475552f, 0.0551952459f,
+    -0.99879545f, 0.0490676761f, -0.999077737f, 0.0429382585f, -0.999322355f, 0.0368072242f, -0.999529421f, 0.030674804f,
+    -0.999698818f, 0.024541229f, -0.999830604f, 0.0184067301f, -0.999924719f, 0.0122715384f, -0.999981165f, 0.00613588467f,
+    -1.0f, 1.22464685e-16f, -0.999981165f, -0.00613588467f, -0.999924719f, -0.0122715384f, -0.999830604f, -0.0184067301f,
+    -0.999698818f, -0.024541229f, -0.999529421f, -0.030674804f, -0.999322355f, -0.0368072242f, -0.999077737f, -0.0429382585f,
+    -0.99879545f, -0.0490676761f, -0.998475552f, -0.0551952459f, -0.998118103f, -0.061320737f, -0.997723043f, -0.0674439222f,
+    -0.997290432f, -0.0735645667f, -0.996820271f, -0.0796824396f, -0.996312618f, -0.0857973099f, -0.995767415f, -0.0919089541f,
+    -0.99518472f, -0.0980171412f, -0.994564593f, -0.104121633f, -0.993906975f, -0.110222206f, -0.993211925f, -0.116318628f,
+    -0.992479563f, -0.122410677f, -0.991709769f, -0.128498107f, -0.990902662f, -0.134580702f, -0.990058184f, -0.140658244f,
+    -0.989176512f, -0.146730468f, -0.988257587f, -0.152797192f, -0.987301409f, -0.15885815f, -0.986308098f, -0.164913118f,
+    -0.985277653f, -0.170961887f, -0.984210074f, -0.177004218f, -0.983105481f, -0.183039889f, -0.981963873f, -0.18906866f,
+    -0.980785251f, -0.195090324f, -0.979569793f, -0.201104641f, -0.97831738f, -0.207111374f, -0.977028131f, -0.213110313f,
+    -0.975702107f, -0.219101235f, -0.974339366f, -0.225083917f, -0.972939968f, -0.231058106f, -0.971503913f, -0.237023607f,
+    -0.970031261f, -0.242980182f, -0.968522072f, -0.248927608f, -0.966976464f, -0.254865646f, -0.965394437f, -0.260794103f,
+    -0.963776052f, -0.266712755f, -0.962121427f, -0.272621363f, -0.960430503f, -0.27851969f, -0.958703458f, -0.284407526f,
+    -0.956940353f, -0.290284663f, -0.955141187f, -0.296150893f, -0.953306019f, -0.302005947f, -0.95143503f, -0.307849646f,
+    -0.949528158f, -0.313681751f, -0.947585583f, -0.319502026f, -0.945607305f, -0.32531029f, -0.943593442f, -0.331106305f,
+    -0.941544056f, -0.336889863f, -0.939459205f, -0.342660725f, -0.937339008f, -0.348418683f, -0.935183525f, -0.354163527f,
+    -0.932992816f, -0.359895051f, -0.93076694f, -0.365612984f, -0.928506076f, -0.371317208f, -0.926210225f, -0.377007425f,
+    -0.923879504f, -0.382683426f, -0.921514034f, -0.388345033f, -0.919113874f, -0.393992037f, -0.916679084f, -0.399624199f,
+    -0.914209783f, -0.405241311f, -0.91170603f, -0.410843164f, -0.909168005f, -0.416429549f, -0.906595707f, -0.422000259f,
+    -0.903989315f, -0.427555084f, -0.901348829f, -0.433093816f, -0.898674488f, -0.438616246f, -0.895966232f, -0.444122136f,
+    -0.893224299f, -0.449611336f, -0.890448749f, -0.455083579f, -0.887639642f, -0.460538715f, -0.884797096f, -0.465976506f,
+    -0.881921291f, -0.471396744f, -0.879012227f, -0.47679922f, -0.876070082f, -0.482183784f, -0.873094976f, -0.487550169f,
+    -0.870086968f, -0.492898196f, -0.867046237f, -0.498227656f, -0.863972843f, -0.50353837f, -0.860866964f, -0.50883013f,
+    -0.857728601f, -0.514102757f, -0.854557991f, -0.519356012f, -0.851355195f, -0.524589658f, -0.848120332f, -0.529803634f,
+    -0.84485358f, -0.534997642f, -0.841554999f, -0.540171444f, -0.838224709f, -0.545324981f, -0.834862888f, -0.550457954f,
+    -0.831469595f, -0.555570245f, -0.82804507f, -0.560661554f, -0.824589312f, -0.565731823f, -0.8211025f, -0.570780754f,
+    -0.817584813f, -0.575808167f, -0.81403631f, -0.580813944f, -0.81045717f, -0.585797846f, -0.806847572f, -0.590759695f,
+    -0.803207517f, -0.59569931f, -0.799537241f, -0.600616455f, -0.795836926f, -0.605511069f, -0.792106569f, -0.610382795f,
+    -0.78834641f, -0.615231574f, -0.784556568f, -0.620057225f, -0.780737221f, -0.624859512f, -0.77688849f, -0.629638255f,
+    -0.773010433f, -0.634393275f, -0.769103348f, -0.639124453f, -0.765167236f, -0.643831551f, -0.761202395f, -0.64851439f,
+    -0.757208824f, -0.653172851f, -0.753186822f, -0.657806695f, -0.749136388f, -0.662415802f, -0.745057762f, -0.666999936f,
+    -0.740951121f, -0.671558976f, -0.736816585f, -0.676092684f, -0.732654274f, -0.680601001f, -0.728464365f, -0.685083687f,
+    -0.724247098f, -0.689540565f, -0.720002532f, -0.693971455f, -0.715730846f, -0.698376238f, -0.711432219f, -0.702754736f,
+    -0.707106769f, -0.707106769f, -0.702754736f, -0.711432219f, -0.698376238f, -0.715730846f, -0.693971455f, -0.720002532f,
+    -0.689540565f, -0.724247098f, -0.685083687f, -0.728464365f, -0.680601001f, -0.732654274f, -0.676092684f, -0.736816585f,
+    -0.671558976f, -0.740951121f, -0.666999936f, -0.745057762f, -0.662415802f, -0.749136388f, -0.657806695f, -0.753186822f,
+    -0.653172851f, -0.757208824f, -0.64851439f, -0.761202395f, -0.643831551f, -0.765167236f, -0.639124453f, -0.769103348f,
+    -0.634393275f, -0.773010433f, -0.629638255f, -0.77688849f, -0.624859512f, -0.780737221f, -0.620057225f, -0.784556568f,
+    -0.615231574f, -0.78834641f, -0.610382795f, -0.792106569f, -0.605511069f, -0.795836926f, -0.600616455f, -0.799537241f,
+    -0.59569931f, -0.803207517f, -0.590759695f, -0.806847572f, -0.585797846f, -0.81045717f, -0.580813944f, -0.81403631f,
+    -0.575808167f, -0.817584813f, -0.570780754f, -0.8211025f, -0.565731823f, -0.824589312f, -0.560661554f, -0.82804507f,
+    -0.555570245f, -0.831469595f, -0.550457954f, -0.834862888f, -0.545324981f, -0.838224709f, -0.540171444f, -0.841554999f,
+    -0.534997642f, -0.84485358f, -0.529803634f, -0.848120332f, -0.524589658f, -0.851355195f, -0.519356012f, -0.854557991f,
+    -0.514102757f, -0.857728601f, -0.50883013f, -0.860866964f, -0.50353837f, -0.863972843f, -0.498227656f, -0.867046237f,
+    -0.492898196f, -0.870086968f, -0.487550169f, -0.873094976f, -0.482183784f, -0.876070082f, -0.47679922f, -0.879012227f,
+    -0.471396744f, -0.881921291f, -0.465976506f, -0.884797096f, -0.460538715f, -0.887639642f, -0.455083579f, -0.890448749f,
+    -0.449611336f, -0.893224299f, -0.444122136f, -0.895966232f, -0.438616246f, -0.898674488f, -0.433093816f, -0.901348829f,
+    -0.427555084f, -0.903989315f, -0.422000259f, -0.906595707f, -0.416429549f, -0.909168005f, -0.410843164f, -0.91170603f,
+    -0.405241311f, -0.914209783f, -0.399624199f, -0.916679084f, -0.393992037f, -0.919113874f, -0.388345033f, -0.921514034f,
+    -0.382683426f, -0.923879504f, -0.377007425f, -0.926210225f, -0.371317208f, -0.928506076f, -0.365612984f, -0.93076694f,
+    -0.359895051f, -0.932992816f, -0.354163527f, -0.935183525f, -0.348418683f, -0.937339008f, -0.342660725f, -0.939459205f,
+    -0.336889863f, -0.941544056f, -0.331106305f, -0.943593442f, -0.32531029f, -0.945607305f, -0.319502026f, -0.947585583f,
+    -0.313681751f, -0.949528158f, -0.307849646f, -0.95143503f, -0.302005947f, -0.953306019f, -0.296150893f, -0.955141187f,
+    -0.290284663f, -0.956940353f, -0.284407526f, -0.958703458f, -0.27851969f, -0.960430503f, -0.272621363f, -0.962121427f,
+    -0.266712755f, -0.963776052f, -0.260794103f, -0.965394437f, -0.254865646f, -0.966976464f, -0.248927608f, -0.968522072f,
+    -0.242980182f, -0.970031261f, -0.237023607f, -0.971503913f, -0.231058106f, -0.972939968f, -0.225083917f, -0.974339366f,
+    -0.219101235f, -0.975702107f, -0.213110313f, -0.977028131f, -0.207111374f, -0.97831738f, -0.201104641f, -0.979569793f,
+    -0.195090324f, -0.980785251f, -0.18906866f, -0.981963873f, -0.183039889f, -0.983105481f, -0.177004218f, -0.984210074f,
+    -0.170961887f, -0.985277653f, -0.164913118f, -0.986308098f, -0.15885815f, -0.987301409f, -0.152797192f, -0.988257587f,
+    -0.146730468f, -0.989176512f, -0.140658244f, -0.990058184f, -0.134580702f, -0.990902662f, -0.128498107f, -0.991709769f,
+    -0.122410677f, -0.992479563f, -0.116318628f, -0.993211925f, -0.110222206f, -0.993906975f, -0.104121633f, -0.994564593f,
+    -0.0980171412f, -0.99518472f, -0.0919089541f, -0.995767415f, -0.0857973099f, -0.996312618f, -0.0796824396f, -0.996820271f,
+    -0.0735645667f, -0.997290432f, -0.0674439222f, -0.997723043f, -0.061320737f, -0.998118103f, -0.0551952459f, -0.998475552f,
+    -0.0490676761f, -0.99879545f, -0.0429382585f, -0.999077737f, -0.0368072242f, -0.999322355f, -0.030674804f, -0.999529421f,
+    -0.024541229f, -0.999698818f, -0.0184067301f, -0.999830604f, -0.0122715384f, -0.999924719f, -0.00613588467f, -0.999981165f,
+    -1.83697015e-16f, -1.0f, 0.00613588467f, -0.999981165f, 0.0122715384f, -0.999924719f, 0.0184067301f, -0.999830604f,
+    0.024541229f, -0.999698818f, 0.030674804f, -0.999529421f, 0.0368072242f, -0.999322355f, 0.0429382585f, -0.999077737f,
+    0.0490676761f, -0.99879545f, 0.0551952459f, -0.998475552f, 0.061320737f, -0.998118103f, 0.0674439222f, -0.997723043f,
+    0.0735645667f, -0.997290432f, 0.0796824396f, -0.996820271f, 0.0857973099f, -0.996312618f, 0.0919089541f, -0.995767415f,
+    0.0980171412f, -0.99518472f, 0.104121633f, -0.994564593f, 0.110222206f, -0.993906975f, 0.116318628f, -0.993211925f,
+    0.122410677f, -0.992479563f, 0.128498107f, -0.991709769f, 0.134580702f, -0.990902662f, 0.140658244f, -0.990058184f,
+    0.146730468f, -0.989176512f, 0.152797192f, -0.988257587f, 0.15885815f, -0.987301409f, 0.164913118f, -0.986308098f,
+    0.170961887f, -0.985277653f, 0.177004218f, -0.984210074f, 0.183039889f, -0.983105481f, 0.18906866f, -0.981963873f,
+    0.195090324f, -0.980785251f, 0.201104641f, -0.979569793f, 0.207111374f, -0.97831738f, 0.213110313f, -0.977028131f,
+    0.219101235f, -0.975702107f, 0.225083917f, -0.974339366f, 0.231058106f, -0.972939968f, 0.237023607f, -0.971503913f,
+    0.242980182f, -0.970031261f, 0.248927608f, -0.968522072f, 0.254865646f, -0.966976464f, 0.260794103f, -0.965394437f,
+    0.266712755f, -0.963776052f, 0.272621363f, -0.962121427f, 0.27851969f, -0.960430503f, 0.284407526f, -0.958703458f,
+    0.290284663f, -0.956940353f, 0.296150893f, -0.955141187f, 0.302005947f, -0.953306019f, 0.307849646f, -0.95143503f,
+    0.313681751f, -0.949528158f, 0.319502026f, -0.947585583f, 0.32531029f, -0.945607305f, 0.331106305f, -0.943593442f,
+    0.336889863f, -0.941544056f, 0.342660725f, -0.939459205f, 0.348418683f, -0.937339008f, 0.354163527f, -0.935183525f,
+    0.359895051f, -0.932992816f, 0.365612984f, -0.93076694f, 0.371317208f, -0.928506076f, 0.377007425f, -0.926210225f,
+    0.382683426f, -0.923879504f, 0.388345033f, -0.921514034f, 0.393992037f, -0.919113874f, 0.399624199f, -0.916679084f,
+    0.405241311f, -0.914209783f, 0.410843164f, -0.91170603f, 0.416429549f, -0.909168005f, 0.422000259f, -0.906595707f,
+    0.427555084f, -0.903989315f, 0.433093816f, -0.901348829f, 0.438616246f, -0.898674488f, 0.444122136f, -0.895966232f,
+    0.449611336f, -0.893224299f, 0.455083579f, -0.890448749f, 0.460538715f, -0.887639642f, 0.465976506f, -0.884797096f,
+    0.471396744f, -0.881921291f, 0.47679922f, -0.879012227f, 0.482183784f, -0.876070082f, 0.487550169f, -0.873094976f,
+    0.492898196f, -0.870086968f, 0.498227656f, -0.867046237f, 0.50353837f, -0.863972843f, 0.50883013f, -0.860866964f,
+    0.514102757f, -0.857728601f, 0.519356012f, -0.854557991f, 0.524589658f, -0.851355195f, 0.529803634f, -0.848120332f,
+    0.534997642f, -0.84485358f, 0.540171444f, -0.841554999f, 0.545324981f, -0.838224709f, 0.550457954f, -0.834862888f,
+    0.555570245f, -0.831469595f, 0.560661554f, -0.82804507f, 0.565731823f, -0.824589312f, 0.570780754f, -0.8211025f,
+    0.575808167f, -0.817584813f, 0.580813944f, -0.81403631f, 0.585797846f, -0.81045717f, 0.590759695f, -0.806847572f,
+    0.59569931f, -0.803207517f, 0.600616455f, -0.799537241f, 0.605511069f, -0.795836926f, 0.610382795f, -0.792106569f,
+    0.615231574f, -0.78834641f, 0.620057225f, -0.784556568f, 0.624859512f, -0.780737221f, 0.629638255f, -0.77688849f,
+    0.634393275f, -0.773010433f, 0.639124453f, -0.769103348f, 0.643831551f, -0.765167236f, 0.64851439f, -0.761202395f,
+    0.653172851f, -0.757208824f, 0.657806695f, -0.753186822f, 0.662415802f, -0.749136388f, 0.666999936f, -0.745057762f,
+    0.671558976f, -0.740951121f, 0.676092684f, -0.736816585f, 0.680601001f, -0.732654274f, 0.685083687f, -0.728464365f,
+    0.689540565f, -0.724247098f, 0.693971455f, -0.720002532f, 0.698376238f, -0.715730846f, 0.702754736f, -0.711432219f,
+    0.707106769f, -0.707106769f, 0.711432219f, -0.702754736f, 0.715730846f, -0.698376238f, 0.720002532f, -0.693971455f,
+    0.724247098f, -0.689540565f, 0.728464365f, -0.685083687f, 0.732654274f, -0.680601001f, 0.736816585f, -0.676092684f,
+    0.740951121f, -0.671558976f, 0.745057762f, -0.666999936f, 0.749136388f, -0.662415802f, 0.753186822f, -0.657806695f,
+    0.757208824f, -0.653172851f, 0.761202395f, -0.64851439f, 0.765167236f, -0.643831551f, 0.769103348f, -0.639124453f,
+    0.773010433f, -0.634393275f, 0.77688849f, -0.629638255f, 0.780737221f, -0.624859512f, 0.784556568f, -0.620057225f,
+    0.78834641f, -0.615231574f, 0.792106569f, -0.610382795f, 0.795836926f, -0.605511069f, 0.799537241f, -0.600616455f,
+    0.803207517f, -0.59569931f, 0.806847572f, -0.590759695f, 0.81045717f, -0.585797846f, 0.81403631f, -0.580813944f,
+    0.817584813f, -0.575808167f, 0.8211025f, -0.570780754f, 0.824589312f, -0.565731823f, 0.82804507f, -0.560661554f,
+    0.831469595f, -0.555570245f, 0.834862888f, -0.550457954f, 0.838224709f, -0.545324981f, 0.841554999f, -0.540171444f,
+    0.84485358f, -0.534997642f, 0.848120332f, -0.529803634f, 0.851355195f, -0.524589658f, 0.854557991f, -0.519356012f,
+    0.857728601f, -0.514102757f, 0.860866964f, -0.50883013f, 0.863972843f, -0.50353837f, 0.867046237f, -0.498227656f,
+    0.870086968f, -0.492898196f, 0.873094976f, -0.487550169f, 0.876070082f, -0.482183784f, 0.879012227f, -0.47679922f,
+    0.881921291f, -0.471396744f, 0.884797096f, -0.465976506f, 0.887639642f, -0.460538715f, 0.890448749f, -0.455083579f,
+    0.893224299f, -0.449611336f, 0.895966232f, -0.444122136f, 0.898674488f, -0.438616246f, 0.901348829f, -0.433093816f,
+    0.903989315f, -0.427555084f, 0.906595707f, -0.422000259f, 0.909168005f, -0.416429549f, 0.91170603f, -0.410843164f,
+    0.914209783f, -0.405241311f, 0.916679084f, -0.399624199f, 0.919113874f, -0.393992037f, 0.921514034f, -0.388345033f,
+    0.923879504f, -0.382683426f, 0.926210225f, -0.377007425f, 0.928506076f, -0.371317208f, 0.93076694f, -0.365612984f,
+    0.932992816f, -0.359895051f, 0.935183525f, -0.354163527f, 0.937339008f, -0.348418683f, 0.939459205f, -0.342660725f,
+    0.941544056f, -0.336889863f, 0.943593442f, -0.331106305f, 0.945607305f, -0.32531029f, 0.947585583f, -0.319502026f,
+    0.949528158f, -0.313681751f, 0.95143503f, -0.307849646f, 0.953306019f, -0.302005947f, 0.955141187f, -0.296150893f,
+    0.956940353f, -0.290284663f, 0.958703458f, -0.284407526f, 0.960430503f, -0.27851969f, 0.962121427f, -0.272621363f,
+    0.963776052f, -0.266712755f, 0.965394437f, -0.260794103f, 0.966976464f, -0.254865646f, 0.968522072f, -0.248927608f,
+    0.970031261f, -0.242980182f, 0.971503913f, -0.237023607f, 0.972939968f, -0.231058106f, 0.974339366f, -0.225083917f,
+    0.975702107f, -0.219101235f, 0.977028131f, -0.213110313f, 0.97831738f, -0.207111374f, 0.979569793f, -0.201104641f,
+    0.980785251f, -0.195090324f, 0.981963873f, -0.18906866f, 0.983105481f, -0.183039889f, 0.984210074f, -0.177004218f,
+    0.985277653f, -0.170961887f, 0.986308098f, -0.164913118f, 0.987301409f, -0.15885815f, 0.988257587f, -0.152797192f,
+    0.989176512f, -0.146730468f, 0.990058184f, -0.140658244f, 0.990902662f, -0.134580702f, 0.991709769f, -0.128498107f,
+    0.992479563f, -0.122410677f, 0.993211925f, -0.116318628f, 0.993906975f, -0.110222206f, 0.994564593f, -0.104121633f,
+    0.99518472f, -0.0980171412f, 0.995767415f, -0.0919089541f, 0.996312618f, -0.0857973099f, 0.996820271f, -0.0796824396f,
+    0.997290432f, -0.0735645667f, 0.997723043f, -0.0674439222f, 0.998118103f, -0.061320737f, 0.998475552f, -0.0551952459f,
+    0.99879545f, -0.0490676761f, 0.999077737f, -0.0429382585f, 0.999322355f, -0.0368072242f, 0.999529421f, -0.030674804f,
+    0.999698818f, -0.024541229f, 0.999830604f, -0.0184067301f, 0.999924719f, -0.0122715384f, 0.999981165f, -0.00613588467f,
+};
+static const int16_t fft_w_table_sc16[1024] __attribute__((aligned(16))) = {
+    32767, 0, 0, 32767, 23169, 23169, -23169, 23169,
+    30272, 12539, -12539, 30272, 12539, 30272, -30272, 12539,
+    32137, 6392, -6392, 32137, 18204, 27244, -27244, 18204,
+    27244, 18204, -18204, 27244, 6392, 32137, -32137, 6392,
+    32609, 3211, -3211, 32609, 20787, 25329, -25329, 20787,
+    28897, 15446, -15446, 28897, 9511, 31356, -31356, 9511,
+    31356, 9511, -9511, 31356, 15446, 28897, -28897, 15446,
+    25329, 20787, -20787, 25329, 3211, 32609, -32609, 3211,
+    32727, 1607, -1607, 32727, 22004, 24278, -24278, 22004,
+    29621, 14009, -14009, 29621, 11038, 30851, -30851, 11038,
+    31785, 7961, -7961, 31785, 16845, 28105, -28105, 16845,
+    26318, 19519, -19519, 26318, 4807, 32412, -32412, 4807,
+    32412, 4807, -4807, 32412, 19519, 26318, -26318, 19519,
+    28105, 16845, -16845, 28105, 7961, 31785, -31785, 7961,
+    30851, 11038, -11038, 30851, 14009, 29621, -29621, 14009,
+    24278, 22004, -22004, 24278, 1607, 32727, -32727, 1607,
+    32757, 804, -804, 32757, 22594, 23731, -23731, 22594,
+    29955, 13278, -13278, 29955, 11792, 30571, -30571, 11792,
+    31970, 7179, -7179, 31970, 17530, 27683, -27683, 17530,
+    26789, 18867, -18867, 26789, 5601, 32284, -32284, 5601,
+    32520, 4011, -4011, 32520, 20159, 25831, -25831, 20159,
+    28510, 16150, -16150, 28510, 8739, 31580, -31580, 8739,
+    31113, 10278, -10278, 31113, 14732, 29268, -29268, 14732,
+    24811, 21402, -21402, 24811, 2410, 32678, -32678, 2410,
+    32678, 2410, -2410, 32678, 21402, 24811, -24811, 21402,
+    29268, 14732, -14732, 29268, 10278, 31113, -31113, 10278,
+    31580, 8739, -8739, 31580, 16150, 28510, -28510, 16150,
+    25831, 20159, -20159, 25831, 4011, 32520, -32520, 4011,
+    32284, 5601, -5601, 32284, 18867, 26789, -26789, 18867,
+    27683, 17530, -17530, 27683, 7179, 31970, -31970, 7179,
+    30571, 11792, -11792, 30571, 13278, 29955, -29955, 13278,
+    23731, 22594, -22594, 23731, 804, 32757, -32757, 804,
+    32764, 402, -402, 32764, 22883, 23452, -23452, 22883,
+    30116, 12909, -12909, 30116, 12166, 30424, -30424, 12166,
+    32056, 6786, -6786, 32056, 17868, 27466, -27466, 17868,
+    27019, 18537, -18537, 27019, 5997, 32213, -32213, 5997,
+    32567, 3611, -3611, 32567, 20474, 25582, -25582, 20474,
+    28706, 15799, -15799, 28706, 9126, 31470, -31470, 9126,
+    31236, 9895, -9895, 31236, 15090, 29085, -29085, 15090,
+    25072, 21096, -21096, 25072, 2811, 32646, -32646, 2811,
+    32705, 2009, -2009, 32705, 21705, 24546, -24546, 21705,
+    29446, 14372, -14372, 29446, 10659, 30984, -30984, 10659,
+    31684, 8351, -8351, 31684, 16499, 28309, -28309, 16499,
+    26077, 19840, -19840, 26077, 4409, 32468, -32468, 4409,
+    32350, 5205, -5205, 32350, 19194, 26556, -26556, 19194,
+    27896, 17189, -17189, 27896, 7571, 31880, -31880, 7571,
+    30713, 11416, -11416, 30713, 13645, 29790, -29790, 13645,
+    24006, 22301, -22301, 24006, 1206, 32744, -32744, 1206,
+    32744, 1206, -1206, 32744, 22301, 24006, -24006, 22301,
+    29790, 13645, -13645, 29790, 11416, 30713, -30713, 11416,
+    31880, 7571, -7571, 31880, 17189, 27896, -27896, 17189,
+    26556, 19194, -19194, 26556, 5205, 32350, -32350, 5205,
+    32468, 4409, -4409, 32468, 19840, 26077, -26077, 19840,
+    28309, 16499, -16499, 28309, 8351, 31684, -31684, 8351,
+    30984, 10659, -10659, 30984, 14372, 29446, -29446, 14372,
+    24546, 21705, -21705, 24546, 2009, 32705, -32705, 2009,
+    32646, 2811, -2811, 32646, 21096, 25072, -25072, 21096,
+    29085, 15090, -15090, 29085, 9895, 31236, -31236, 9895,
+    31470, 9126, -9126, 31470, 15799, 28706, -28706, 15799,
+    25582, 20474, -20474, 25582, 3611, 32567, -32567, 3611,
+    32213, 5997, -5997, 32213, 18537, 27019, -27019, 18537,
+    27466, 17868, -17868, 27466, 6786, 32056, -32056, 6786,
+    30424, 12166, -12166, 30424, 12909, 30116, -30116, 12909,
+    23452, 22883, -22883, 23452, 402, 32764, -32764, 402,
+    32766, 201, -201, 32766, 23027, 23311, -23311, 23027,
+    30195, 12724, -12724, 30195, 12353, 30349, -30349, 12353,
+    32097, 6589, -6589, 32097, 18036, 27355, -27355, 18036,
+    27132, 18371, -18371, 27132, 6195, 32176, -32176, 6195,
+    32588, 3411, -3411, 32588, 20631, 25456, -25456, 20631,
+    28802, 15623, -15623, 28802, 9319, 31413, -31413, 9319,
+    31297, 9703, -9703, 31297, 15268, 28992, -28992, 15268,
+    25201, 20942, -20942, 25201, 3011, 32628, -32628, 3011,
+    32717, 1808, -1808, 32717, 21855, 24413, -24413, 21855,
+    29534, 14191, -14191, 29534, 10849, 30918, -30918, 10849,
+    31735, 8156, -8156, 31735, 16672, 28208, -28208, 16672,
+    26198, 19680, -19680, 26198, 4608, 32441, -32441, 4608,
+    32382, 5006, -5006, 32382, 19357, 26437, -26437, 19357,
+    28001, 17017, -17017, 28001, 7766, 31833, -31833, 7766,
+    30783, 11227, -11227, 30783, 13827, 29706, -29706, 13827,
+    24143, 22153, -22153, 24143, 1406, 32736, -32736, 1406,
+    32751, 1005, -1005, 32751, 22448, 23869, -23869, 22448,
+    29873, 13462, -13462, 29873, 11604, 30643, -30643, 11604,
+    31926, 7375, -7375, 31926, 17360, 27790, -27790, 17360,
+    26673, 19031, -19031, 26673, 5403, 32318, -32318, 5403,
+    32495, 4210, -4210, 32495, 20000, 25954, -25954, 20000,
+    28410, 16325, -16325, 28410, 8545, 31633, -31633, 8545,
+    31049, 10469, -10469, 31049, 14552, 29358, -29358, 14552,
+    24679, 21554, -21554, 24679, 2209, 32692, -32692, 2209,
+    32662, 2610, -2610, 32662, 21249, 24942, -24942, 21249,
+    29177, 14911, -14911, 29177, 10087, 31175, -31175, 10087,
+    31525, 8932, -8932, 31525, 15975, 28608, -28608, 15975,
+    25707, 20317, -20317, 25707, 3811, 32544, -32544, 3811,
+    32249, 5799, -5799, 32249, 18702, 26905, -26905, 18702,
+    27575, 17699, -17699, 27575, 6982, 32014, -32014, 6982,
+    30498, 11980, -11980, 30498, 13094, 30036, -30036, 13094,
+    23592, 22739, -22739, 23592, 603, 32761, -32761, 603,
+    32761, 603, -603, 32761, 22739, 23592, -23592, 22739,
+    30036, 13094, -13094, 30036, 11980, 30498, -30498, 11980,
+    32014, 6982, -6982, 32014, 17699, 27575, -27575, 17699,
+    26905, 18702, -18702, 26905, 5799, 32249, -32249, 5799,
+    32544, 3811, -3811, 32544, 20317, 25707, -25707, 20317,
+    28608, 15975, -15975, 28608, 8932, 31525, -31525, 8932,
+    31175, 10087, -10087, 31175, 14911, 29177, -29177, 14911,
+    24942, 21249, -21249, 24942, 2610, 32662, -32662, 2610,
+    32692, 2209, -2209, 32692, 21554, 24679, -24679, 21554,
+    29358, 14552, -14552, 29358, 10469, 31049, -31049, 10469,
+    31633, 8545, -8545, 31633, 16325, 28410, -28410, 16325,
+    25954, 20000, -20000, 25954, 4210, 32495, -32495, 4210,
+    32318, 5403, -5403, 32318, 19031, 26673, -26673, 19031,
+    27790, 17360, -17360, 27790, 7375, 31926, -31926, 7375,
+    30643, 11604, -11604, 30643, 13462, 29873, -29873, 13462,
+    23869, 22448, -22448, 23869, 1005, 32751, -32751, 1005,
+    32736, 1406, -1406, 32736, 22153, 24143, -24143, 22153,
+    29706, 13827, -13827, 29706, 11227, 30783, -30783, 11227,
+    31833, 7766, -7766, 31833, 17017, 28001, -28001, 17017,
+    26437, 19357, -19357, 26437, 5006, 32382, -32382, 5006,
+    32441, 4608, -4608, 32441, 19680, 26198, -26198, 19680,
+    28208, 16672, -16672, 28208, 8156, 31735, -31735, 8156,
+    30918, 10849, -10849, 30918, 14191, 29534, -29534, 14191,
+    24413, 21855, -21855, 24413, 1808, 32717, -32717, 1808,
+    32628, 3011, -3011, 32628, 20942, 25201, -25201, 20942,
+    28992, 15268, -15268, 28992, 9703, 31297, -31297, 9703,
+    31413, 9319, -9319, 31413, 15623, 28802, -28802, 15623,
+    25456, 20631, -20631, 25456, 3411, 32588, -32588, 3411,
+    32176, 6195, -6195, 32176, 18371, 27132, -27132, 18371,
+    27355, 18036, -18036, 27355, 6589, 32097, -32097, 6589,
+    30349, 12353, -12353, 30349, 12724, 30195, -30195, 12724,
+    23311, 23027, -23027, 23311, 201, 32766, -32766, 201,
+};
+static const int16_t fft_hann_q15[513] = {
+    0, 0, 1, 2, 4, 7, 11, 15,
+    19, 24, 30, 37, 44, 52, 60, 69,
+    78, 89, 99, 111, 123, 135, 149, 162,
+    177, 192, 208, 224, 241, 258, 276, 295,
+    314, 334, 355, 376, 398, 420, 443, 466,
+    490, 515, 541, 566, 593, 620, 648, 676,
+    705, 734, 765, 795, 826, 858, 891, 924,
+    957, 991, 1026, 1061, 1097, 1134, 1171, 1208,
+    1247, 1285, 1325, 1365, 1405, 1446, 1488, 1530,
+    1572, 1616, 1660, 1704, 1749, 1794, 1840, 1887,
+    1934, 1982, 2030, 2079, 2128, 2178, 2228, 2279,
+    2330, 2382, 2435, 2488, 2541, 2595, 2650, 2705,
+    2761, 2817, 2873, 2930, 2988, 3046, 3105, 3164,
+    3224, 3284, 3344, 3406, 3467, 3529, 3592, 3655,
+    3718, 3782, 3847, 3912, 3977, 4043, 4110, 4176,
+    4244, 4311, 4380, 4448, 4517, 4587, 4657, 4727,
+    4798, 4869, 4941, 5013, 5086, 5159, 5232, 5306,
+    5381, 5455, 5530, 5606, 5682, 5758, 5835, 5912,
+    5989, 6067, 6146, 6224, 6303, 6383, 6463, 6543,
+    6623, 6704, 6786, 6867, 6949, 7032, 7114, 7197,
+    7281, 7365, 7449, 7533, 7618, 7703, 7788, 7874,
+    7960, 8047, 8133, 8220, 8308, 8395, 8483, 8571,
+    8660, 8749, 8838, 8927, 9017, 9107, 9197, 9287,
+    9378, 9469, 9560, 9652, 9744, 9836, 9928, 10021,
+    10113, 10206, 10300, 10393, 10487, 10581, 10675, 10769,
+    10864, 10958, 11053, 11148, 11244, 11339, 11435, 11531,
+    11627, 11723, 11820, 11917, 12013, 12110, 12207, 12305,
+    12402, 12500, 12597, 12695, 12793, 12892, 12990, 13088,
+    13187, 13285, 13384, 13483, 13582, 13681, 13780, 13880,
+    13979, 14079, 14178, 14278, 14377, 14477, 14577, 14677,
+    14777, 14877, 14977, 15078, 15178, 15278, 15378, 15479,
+    15579, 15680, 15780, 15880, 15981, 16081, 16182, 16282,
+    16383, 16484, 16584, 16685, 16785, 16886, 16986, 17086,
+    17187, 17287, 17388, 17488, 17588, 17688, 17789, 17889,
+    17989, 18089, 18189, 18289, 18389, 18488, 18588, 18687,
+    18787, 18886, 18986, 19085, 19184, 19283, 19382, 19481,
+    19579, 19678, 19776, 19874, 19973, 20071, 20169, 20266,
+    20364, 20461, 20559, 20656, 20753, 20849, 20946, 21043,
+    21139, 21235, 21331, 21427, 21522, 21618, 21713, 21808,
+    21902, 21997, 22091, 22185, 22279, 22373, 22466, 22560,
+    22653, 22745, 22838, 22930, 23022, 23114, 23206, 23297,
+    23388, 23479, 23569, 23659, 23749, 23839, 23928, 24017,
+    24106, 24195, 24283, 24371, 24458, 24546, 24633, 24719,
+    24806, 24892, 24978, 25063, 25148, 25233, 25317, 25401,
+    25485, 25569, 25652, 25734, 25817, 25899, 25980, 26062,
+    26143, 26223, 26303, 26383, 26463, 26542, 26620, 26699,
+    26777, 26854, 26931, 27008, 27084, 27160, 27236, 27311,
+    27385, 27460, 27534, 27607, 27680, 27753, 27825, 27897,
+    27968, 28039, 28109, 28179, 28249, 28318, 28386, 28455,
+    28522, 28590, 28656, 28723, 28789, 28854, 28919, 28984,
+    29048, 29111, 29174, 29237, 29299, 29360, 29422, 29482,
+    29542, 29602, 29661, 29720, 29778, 29836, 29893, 29949,
+    30005, 30061, 30116, 30171, 30225, 30278, 30331, 30384,
+    30436, 30487, 30538, 30588, 30638, 30687, 30736, 30784,
+    30832, 30879, 30926, 30972, 31017, 31062, 31106, 31150,
+    31194, 31236, 31278, 31320, 31361, 31401, 31441, 31481,
+    31519, 31558, 31595, 31632, 31669, 31705, 31740, 31775,
+    31809, 31842, 31875, 31908, 31940, 31971, 32001, 32032,
+    32061, 32090, 32118, 32146, 32173, 32200, 32225, 32251,
+    32276, 32300, 32323, 32346, 32368, 32390, 32411, 32432,
+    32452, 32471, 32490, 32508, 32525, 32542, 32558, 32574,
+    32589, 32604, 32617, 32631, 32643, 32655, 32667, 32677,
+    32688, 32697, 32706, 32714, 32722, 32729, 32736, 32742,
+    32747, 32751, 32755, 32759, 32762, 32764, 32765, 32766,
+    32767,
+};
+#elif MAX_SIGNAL_LENGHT == 2048
+static const float fft_w_table_r2[2048] __attribute__((aligned(16))) = {
+    1.0f, 0.0f, 6.12323426e-17f, 1.0f, 0.707106769f, 0.707106769f, -0.707106769f, 0.707106769f,
+    0.923879504f, 0.382683426f, -0.382683426f, 0.923879504f, 0.382683426f, 0.923879504f, -0.923879504f, 0.382683426f,
+    0.980785251f, 0.195090324f, -0.195090324f, 0.980785251f, 0.555570245f, 0.831469595f, -0.831469595f, 0.555570245f,
+    0.831469595f, 0.555570245f, -0.555570245f, 0.831469595f, 0.195090324f, 0.980785251f, -0.980785251f, 0.195090324f,
+    0.99518472f, 0.0980171412f, -0.0980171412f, 0.99518472f, 0.634393275f, 0.773010433f, -0.773010433f, 0.634393275f,
+    0.881921291f, 0.471396744f, -0.471396744f, 0.881921291f, 0.290284663f, 0.956940353f, -0.956940353f, 0.290284663f,
+    0.956940353f, 0.290284663f, -0.290284663f, 0.956940353f, 0.471396744f, 0.881921291f, -0.881921291f, 0.471396744f,
+    0.773010433f, 0.634393275f, -0.634393275f, 0.773010433f, 0.0980171412f, 0.99518472f, -0.99518472f, 0.0980171412f,
+    0.99879545f, 0.0490676761f, -0.0490676761f, 0.99879545f, 0.671558976f, 0.740951121f, -0.740951121f, 0.671558976f,
+    0.903989315f, 0.427555084f, -0.427555084f, 0.903989315f, 0.336889863f, 0.941544056f, -0.941544056f, 0.336889863f,
+    0.970031261f, 0.242980182f, -0.242980182f, 0.970031261f, 0.514102757f, 0.857728601f, -0.857728601f, 0.514102757f,
+    0.803207517f, 0.59569931f, -0.59569931f, 0.803207517f, 0.146730468f, 0.989176512f, -0.989176512f, 0.146730468f,
+    0.989176512f, 0.146730468f, -0.146730468f, 0.989176512f, 0.59569931f, 0.803207517f, -0.803207517f, 0.59569931f,
+    0.857728601f, 0.514102757f, -0.514102757f, 0.857728601f, 0.242980182f, 0.970031261f, -0.970031261f, 0.242980182f,
+    0.941544056f, 0.336889863f, -0.336889863f, 0.941544056f, 0.427555084f, 0.903989315f, -0.903989315f, 0.427555084f,
+    0.740951121f, 0.671558976f, -0.671558976f, 0.740951121f, 0.0490676761f, 0.99879545f, -0.99879545f, 0.0490676761f,
+    0.999698818f, 0.024541229f, -0.024541229f, 0.999698818f, 0.689540565f, 0.724247098f, -0.724247098f, 0.689540565f,
+    0.914209783f, 0.405241311f, -0.405241311f, 0.914209783f, 0.359895051f, 0.932992816f, -0.932992816f, 0.359895051f,
+    0.975702107f, 0.219101235f, -0.219101235f, 0.975702107f, 0.534997642f, 0.84485358f, -0.84485358f, 0.534997642f,
+    0.817584813f, 0.575808167f, -0.575808167f, 0.817584813f, 0.170961887f, 0.985277653f, -0.985277653f, 0.170961887f,
+    0.992479563f, 0.122410677f, -0.122410677f, 0.992479563f, 0.615231574f, 0.78834641f, -0.78834641f, 0.615231574f,
+    0.870086968f, 0.492898196f, -0.492898196f, 0.870086968f, 0.266712755f, 0.963776052f, -0.963776052f, 0.266712755f,
+    0.949528158f, 0.313681751f, -0.313681751f, 0.949528158f, 0.449611336f, 0.893224299f, -0.893224299f, 0.449611336f,
+    0.757208824f, 0.653172851f, -0.653172851f, 0.757208824f, 0.0735645667f, 0.997290432f, -0.997290432f, 0.0735645667f,
+    0.997290432f, 0.0735645667f, -0.0735645667f, 0.997290432f, 0.653172851f, 0.757208824f, -0.757208824f, 0.653172851f,
+    0.893224299f, 0.449611336f, -0.449611336f, 0.893224299f, 0.313681751f, 0.949528158f, -0.949528158f, 0.313681751f,
+    0.963776052f, 0.266712755f, -0.266712755f, 0.963776052f, 0.492898196f, 0.870086968f, -0.870086968f, 0.492898196f,
+    0.78834641f, 0.615231574f, -0.615231574f, 0.78834641f, 0.122410677f, 0.992479563f, -0.992479563f, 0.122410677f,
+    0.985277653f, 0.170961887f, -0.170961887f, 0.985277653f, 0.575808167f, 0.817584813f, -0.817584813f, 0.575808167f,
+    0.84485358f, 0.534997642f, -0.534997642f, 0.84485358f, 0.219101235f, 0.975702107f, -0.975702107f, 0.219101235f,
+    0.932992816f, 0.359895051f, -0.359895051f, 0.932992816f, 0.405241311f, 0.914209783f, -0.914209783f, 0.405241311f,
+    0.724247098f, 0.689540565f, -0.689540565f, 0.724247098f, 0.024541229f, 0.999698818f, -0.999698818f, 0.024541229f,
+    0.999924719f, 0.0122715384f, -0.0122715384f, 0.999924719f, 0.698376238f, 0.715730846f, -0.715730846f, 0.698376238f,
+    0.919113874f, 0.393992037f, -0.393992037f, 0.919113874f, 0.371317208f, 0.928506076f, -0.928506076f, 0.371317208f,
+    0.97831738f, 0.207111374f, -0.207111374f, 0.97831738f, 0.545324981f, 0.838224709f, -0.838224709f, 0.545324981f,
+    0.824589312f, 0.565731823f, -0.565731823f, 0.824589312f, 0.183039889f, 0.983105481f, -0.983105481f, 0.183039889f,
+    0.993906975f, 0.110222206f, -0.110222206f, 0.993906975f, 0.624859512f, 0.780737221f, -0.780737221f, 0.624859512f,
+    0.876070082f, 0.482183784f, -0.482183784f, 0.876070082f, 0.27851969f, 0.960430503f, -0.960430503f, 0.27851969f,
+    0.953306019f, 0.302005947f, -0.302005947f, 0.953306019f, 0.460538715f, 0.887639642f, -0.887639642f, 0.460538715f,
+    0.765167236f, 0.643831551f, -0.643831551f, 0.765167236f, 0.0857973099f, 0.996312618f, -0.996312618f, 0.0857973099f,
+    0.998118103f, 0.061320737f, -0.061320737f, 0.998118103f, 0.662415802f, 0.749136388f, -0.749136388f, 0.662415802f,
+    0.898674488f, 0.438616246f, -0.438616246f, 0.898674488f, 0.32531029f, 0.945607305f, -0.945607305f, 0.32531029f,
+    0.966976464f, 0.254865646f, -0.254865646f, 0.966976464f, 0.50353837f, 0.863972843f, -0.863972843f, 0.50353837f,
+    0.795836926f, 0.605511069f, -0.605511069f, 0.795836926f, 0.134580702f, 0.990902662f, -0.990902662f, 0.134580702f,
+    0.987301409f, 0.15885815f, -0.15885815f, 0.987301409f, 0.585797846f, 0.81045717f, -0.81045717f, 0.585797846f,
+    0.851355195f, 0.524589658f, -0.524589658f, 0.851355195f, 0.231058106f, 0.972939968f, -0.972939968f, 0.231058106f,
+    0.937339008f, 0.348418683f, -0.348418683f, 0.937339008f, 0.416429549f, 0.909168005f, -0.909168005f, 0.416429549f,
+    0.732654274f, 0.680601001f, -0.680601001f, 0.732654274f, 0.0368072242f, 0.999322355f, -0.999322355f, 0.0368072242f,
+    0.999322355f, 0.0368072242f, -0.0368072242f, 0.999322355f, 0.680601001f, 0.732654274f, -0.732654274f, 0.680601001f,
+    0.909168005f, 0.416429549f, -0.416429549f, 0.909168005f, 0.348418683f, 0.937339008f, -0.937339008f, 0.348418683f,
+    0.972939968f, 0.231058106f, -0.231058106f, 0.972939968f, 0.524589658f, 0.851355195f, -0.851355195f, 0.524589658f,
+    0.81045717f, 0.585797846f, -0.585797846f, 0.81045717f, 0.15885815f, 0.987301409f, -0.987301409f, 0.15885815f,
+    0.990902662f, 0.134580702f, -0.134580702f, 0.990902662f, 0.605511069f, 0.795836926f, -0.795836926f, 0.605511069f,
+    0.863972843f, 0.50353837f, -0.50353837f, 0.863972843f, 0.254865646f, 0.966976464f, -0.966976464f, 0.254865646f,
+    0.945607305f, 0.32531029f, -0.32531029f, 0.945607305f, 0.438616246f, 0.898674488f, -0.898674488f, 0.438616246f,
+    0.749136388f, 0.662415802f, -0.662415802f, 0.749136388f, 0.061320737f, 0.998118103f, -0.998118103f, 0.061320737f,
+    0.996312618f, 0.0857973099f, -0.0857973099f, 0.996312618f, 0.643831551f, 0.765167236f, -0.765167236f, 0.643831551f,
+    0.887639642f, 0.460538715f, -0.460538715f, 0.887639642f, 0.302005947f, 0.953306019f, -0.953306019f, 0.302005947f,
+    0.960430503f, 0.27851969f, -0.27851969f, 0.960430503f, 0.482183784f, 0.876070082f, -0.876070082f, 0.482183784f,
+    0.780737221f, 0.624859512f, -0.624859512f, 0.780737221f, 0.110222206f, 0.993906975f, -0.993906975f, 0.110222206f,
+    0.983105481f, 0.183039889f, -0.183039889f, 0.983105481f, 0.565731823f, 0.824589312f, -0.824589312f, 0.565731823f,
+    0.838224709f, 0.545324981f, -0.545324981f, 0.838224709f, 0.207111374f, 0.97831738f, -0.97831738f, 0.207111374f,
+    0.928506076f, 0.371317208f, -0.371317208f, 0.928506076f, 0.393992037f, 0.919113874f, -0.919113874f, 0.393992037f,
+    0.715730846f, 0.698376238f, -0.698376238f, 0.715730846f, 0.0122715384f, 0.999924719f, -0.999924719f, 0.0122715384f,
+    0.999981165f, 0.00613588467f, -0.00613588467f, 0.999981165f, 0.702754736f, 0.711432219f, -0.711432219f, 0.702754736f,
+    0.921514034f, 0.388345033f, -0.388345033f, 0.921514034f, 0.377007425f, 0.926210225f, -0.926210225f, 0.377007425f,
+    0.979569793f, 0.201104641f, -0.201104641f, 0.979569793f, 0.550457954f, 0.834862888f, -0.834862888f, 0.550457954f,
+    0.82804507f, 0.560661554f, -0.560661554f, 0.82804507f, 0.18906866f, 0.981963873f, -0.981963873f, 0.18906866f,
+    0.994564593f, 0.104121633f, -0.104121633f, 0.994564593f, 0.629638255f, 0.77688849f, -0.77688849f, 0.629638255f,
+    0.879012227f, 0.47679922f, -0.47679922f, 0.879012227f, 0.284407526f, 0.958703458f, -0.958703458f, 0.284407526f,
+    0.955141187f, 0.296150893f, -0.296150893f, 0.955141187f, 0.465976506f, 0.884797096f, -0.884797096f, 0.465976506f,
+    0.769103348f, 0.639124453f, -0.639124453f, 0.769103348f, 0.0919089541f, 0.995767415f, -0.995767415f, 0.0919089541f,
+    0.998475552f, 0.0551952459f, -0.0551952459f, 0.998475552f, 0.666999936f, 0.745057762f, -0.745057762f, 0.666999936f,
+    0.901348829f, 0.433093816f, -0.433093816f, 0.901348829f, 0.331106305f, 0.943593442f, -0.943593442f, 0.331106305f,
+    0.968522072f, 0.248927608f, -0.248927608f, 0.968522072f, 0.50883013f, 0.860866964f, -0.860866964f, 0.50883013f,
+    0.799537241f, 0.600616455f, -0.600616455f, 0.799537241f, 0.140658244f, 0.990058184f, -0.990058184f, 0.140658244f,
+    0.988257587f, 0.152797192f, -0.152797192f, 0.988257587f, 0.590759695f, 0.806847572f, -0.806847572f, 0.590759695f,
+    0.854557991f, 0.519356012f, -0.519356012f, 0.854557991f, 0.237023607f, 0.971503913f, -0.971503913f, 0.237023607f,
+    0.939459205f, 0.342660725f, -0.342660725f, 0.939459205f, 0.422000259f, 0.906595707f, -0.906595707f, 0.422000259f,
+    0.736816585f, 0.676092684f, -0.676092684f, 0.736816585f, 0.0429382585f, 0.999077737f, -0.999077737f, 0.0429382585f,
+    0.999529421f, 0.030674804f, -0.030674804f, 0.999529421f, 0.685083687f, 0.728464365f, -0.728464365f, 0.685083687f,
+    0.91170603f, 0.410843164f, -0.410843164f, 0.91170603f, 0.354163527f, 0.935183525f, -0.935183525f, 0.354163527f,
+    0.974339366f, 0.225083917f, -0.225083917f, 0.974339366f, 0.529803634f, 0.848120332f, -0.848120332f, 0.529803634f,
+    0.81403631f, 0.580813944f, -0.580813944f, 0.81403631f, 0.164913118f, 0.986308098f, -0.986308098f, 0.164913118f,
+    0.991709769f, 0.128498107f, -0.128498107f, 0.991709769f, 0.610382795f, 0.792106569f, -0.792106569f, 0.610382795f,
+    0.867046237f, 0.498227656f, -0.498227656f, 0.867046237f, 0.260794103f, 0.965394437f, -0.965394437f, 0.260794103f,
+    0.947585583f, 0.319502026f, -0.319502026f, 0.947585583f, 0.444122136f, 0.895966232f, -0.895966232f, 0.444122136f,
+    0.753186822f, 0.657806695f, -0.657806695f, 0.753186822f, 0.0674439222f, 0.997723043f, -0.997723043f, 0.0674439222f,
+    0.996820271f, 0.0796824396f, -0.0796824396f, 0.996820271f, 0.64851439f, 0.761202395f, -0.761202395f, 0.64851439f,
+    0.890448749f, 0.455083579f, -0.455083579f, 0.890448749f, 0.307849646f, 0.95143503f, -0.95143503f, 0.307849646f,
+    0.962121427f, 0.272621363f, -0.272621363f, 0.962121427f, 0.487550169f, 0.873094976f, -0.873094976f, 0.487550169f,
+    0.784556568f, 0.620057225f, -0.620057225f, 0.784556568f, 0.116318628f, 0.993211925f, -0.993211925f, 0.116318628f,
+    0.984210074f, 0.177004218f, -0.177004218f, 0.984210074f, 0.570780754f, 0.8211025f, -0.8211025f, 0.570780754f,
+    0.841554999f, 0.540171444f, -0.540171444f, 0.841554999f, 0.213110313f, 0.977028131f, -0.977028131f, 0.213110313f,
+    0.93076694f, 0.365612984f, -0.365612984f, 0.93076694f, 0.399624199f, 0.916679084f, -0.916679084f, 0.399624199f,
+    0.720002532f, 0.693971455f, -0.693971455f, 0.720002532f, 0.0184067301f, 0.999830604f, -0.999830604f, 0.0184067301f,
+    0.999830604f, 0.0184067301f, -0.0184067301f, 0.999830604f, 0.693971455f, 0.720002532f, -0.720002532f, 0.693971455f,
+    0.916679084f, 0.399624199f, -0.399624199f, 0.916679084f, 0.365612984f, 0.93076694f, -0.93076694f, 0.365612984f,
+    0.977028131f, 0.213110313f, -0.213110313f, 0.977028131f, 0.540171444f, 0.841554999f, -0.841554999f, 0.540171444f,
+    0.8211025f, 0.570780754f, -0.570780754f, 0.8211025f, 0.177004218f, 0.984210074f, -0.984210074f, 0.177004218f,
+    0.993211925f, 0.116318628f, -0.116318628f, 0.993211925f, 0.620057225f, 0.784556568f, -0.784556568f, 0.620057225f,
+    0.873094976f, 0.487550169f, -0.487550169f, 0.873094976f, 0.272621363f, 0.962121427f, -0.962121427f, 0.272621363f,
+    0.95143503f, 0.307849646f, -0.307849646f, 0.95143503f, 0.455083579f, 0.890448749f, -0.890448749f, 0.455083579f,
+    0.761202395f, 0.64851439f, -0.64851439f, 0.761202395f, 0.0796824396f, 0.996820271f, -0.996820271f, 0.0796824396f,
+    0.997723043f, 0.0674439222f, -0.0674439222f, 0.997723043f, 0.657806695f, 0.753186822f, -0.753186822f, 0.657806695f,
+    0.895966232f, 0.444122136f, -0.444122136f, 0.895966232f, 0.319502026f, 0.947585583f, -0.947585583f, 0.319502026f,
+    0.965394437f, 0.260794103f, -0.260794103f, 0.965394437f, 0.498227656f, 0.867046237f, -0.867046237f, 0.498227656f,
+    0.792106569f, 0.610382795f, -0.610382795f, 0.792106569f, 0.128498107f, 0.991709769f, -0.991709769f, 0.128498107f,
+    0.986308098f, 0.164913118f, -0.164913118f, 0.986308098f, 0.580813944f, 0.81403631f, -0.81403631f, 0.580813944f,
+    0.848120332f, 0.529803634f, -0.529803634f, 0.848120332f, 0.225083917f, 0.974339366f, -0.974339366f, 0.225083917f,
+    0.935183525f, 0.354163527f, -0.354163527f, 0.935183525f, 0.410843164f, 0.91170603f, -0.91170603f, 0.410843164f,
+    0.728464365f, 0.685083687f, -0.685083687f, 0.728464365f, 0.030674804f, 0.999529421f, -0.999529421f, 0.030674804f,
+    0.999077737f, 0.0429382585f, -0.0429382585f, 0.999077737f, 0.676092684f, 0.736816585f, -0.736816585f, 0.676092684f,
+    0.906595707f, 0.422000259f, -0.422000259f, 0.906595707f, 0.342660725f, 0.939459205f, -0.939459205f, 0.342660725f,
+    0.971503913f, 0.237023607f, -0.237023607f, 0.971503913f, 0.519356012f, 0.854557991f, -0.854557991f, 0.519356012f,
+    0.806847572f, 0.590759695f, -0.590759695f, 0.806847572f, 0.152797192f, 0.988257587f, -0.988257587f, 0.152797192f,
+    0.990058184f, 0.140658244f, -0.140658244f, 0.990058184f, 0.600616455f, 0.799537241f, -0.799537241f, 0.600616455f,
+    0.860866964f, 0.50883013f, -0.50883013f, 0.860866964f, 0.248927608f, 0.968522072f, -0.968522072f, 0.248927608f,
+    0.943593442f, 0.331106305f, -0.331106305f, 0.943593442f, 0.433093816f, 0.901348829f, -0.901348829f, 0.433093816f,
+    0.745057762f, 0.666999936f, -0.666999936f, 0.745057762f, 0.0551952459f, 0.998475552f, -0.998475552f, 0.0551952459f,
+    0.995767415f, 0.0919089541f, -0.0919089541f, 0.995767415f, 0.639124453f, 0.769103348f, -0.769103348f, 0.639124453f,
+    0.884797096f, 0.465976506f, -0.465976506f, 0.884797096f, 0.296150893f, 0.955141187f, -0.955141187f, 0.296150893f,
+    0.958703458f, 0.284407526f, -0.284407526f, 0.958703458f, 0.47679922f, 0.879012227f, -0.879012227f, 0.47679922f,
+    0.77688849f, 0.629638255f, -0.629638255f, 0.77688849f, 0.104121633f, 0.994564593f, -0.994564593f, 0.104121633f,
+    0.981963873f, 0.18906866f, -0.18906866f, 0.981963873f, 0.560661554f, 0.82804507f, -0.82804507f, 0.560661554f,
+    0.834862888f, 0.550457954f, -0.550457954f, 0.834862888f, 0.201104641f, 0.979569793f, -0.979569793f, 0.201104641f,
+    0.926210225f, 0.377007425f, -0.377007425f, 0.926210225f, 0.388345033f, 0.921514034f, -0.921514034f, 0.388345033f,
+    0.711432219f, 0.702754736f, -0.702754736f, 0.711432219f, 0.00613588467f, 0.999981165f, -0.999981165f, 0.00613588467f,
+    0.999995291f, 0.00306795677f, -0.00306795677f, 0.999995291f, 0.704934061f, 0.709272802f, -0.709272802f, 0.704934061f,
+    0.92270112f, 0.385516047f, -0.385516047f, 0.92270112f, 0.379847199f, 0.925049245f, -0.925049245f, 0.379847199f,
+    0.980182111f, 0.198098406f, -0.198098406f, 0.980182111f, 0.553016722f, 0.833170176f, -0.833170176f, 0.553016722f,
+    0.829761207f, 0.558118522f, -0.558118522f, 0.829761207f, 0.192080393f, 0.981379211f, -0.981379211f, 0.192080393f,
+    0.994879305f, 0.10106986f, -0.10106986f, 0.994879305f, 0.632018745f, 0.774953127f, -0.774953127f, 0.632018745f,
+    0.880470872f, 0.474100202f, -0.474100202f, 0.880470872f, 0.287347466f, 0.957826436f, -0.957826436f, 0.287347466f,
+    0.95604527f, 0.293219149f, -0.293219149f, 0.95604527f, 0.468688816f, 0.883363366f, -0.883363366f, 0.468688816f,
+    0.771060526f, 0.636761844f, -0.636761844f, 0.771060526f, 0.0949634984f, 0.995480776f, -0.995480776f, 0.0949634984f,
+    0.998640239f, 0.052131705f, -0.052131705f, 0.998640239f, 0.669282615f, 0.743007958f, -0.743007958f, 0.669282615f,
+    0.902673304f, 0.430326492f, -0.430326492f, 0.902673304f, 0.333999664f, 0.94257319f, -0.94257319f, 0.333999664f,
+    0.969281256f, 0.24595505f, -0.24595505f, 0.969281256f, 0.511468828f, 0.859301805f, -0.859301805f, 0.511468828f,
+    0.801376164f, 0.598160684f, -0.598160684f, 0.801376164f, 0.143695027f, 0.989621997f, -0.989621997f, 0.143695027f,
+    0.988721669f, 0.149764538f, -0.149764538f, 0.988721669f, 0.593232274f, 0.805031359f, -0.805031359f, 0.593232274f,
+    0.856147349f, 0.516731799f, -0.516731799f, 0.856147349f, 0.24000302f, 0.970772147f, -0.970772147f, 0.24000302f,
+    0.940506041f, 0.339776874f, -0.339776874f, 0.940506041f, 0.424779683f, 0.905296743f, -0.905296743f, 0.424779683f,
+    0.73888731f, 0.673829019f, -0.673829019f, 0.73888731f, 0.0460031815f, 0.998941302f, -0.998941302f, 0.0460031815f,
+    0.999618828f, 0.027608145f, -0.027608145f, 0.999618828f, 0.687315345f, 0.726359129f, -0.726359129f, 0.687315345f,
+    0.912962198f, 0.408044159f, -0.408044159f, 0.912962198f, 0.357030958f, 0.934092522f, -0.934092522f, 0.357030958f,
+    0.975025356f, 0.222093627f, -0.222093627f, 0.975025356f, 0.532403111f, 0.84649092f, -0.84649092f, 0.532403111f,
+    0.815814435f, 0.578313768f, -0.578313768f, 0.815814435f, 0.167938292f, 0.985797524f, -0.985797524f, 0.167938292f,
+    0.992099285f, 0.125454977f, -0.125454977f, 0.992099285f, 0.612810075f, 0.790230215f, -0.790230215f, 0.612810075f,
+    0.868570685f, 0.495565265f, -0.495565265f, 0.868570685f, 0.263754666f, 0.964589775f, -0.964589775f, 0.263754666f,
+    0.94856137f, 0.316593379f, -0.316593379f, 0.94856137f, 0.446868837f, 0.894599497f, -0.894599497f, 0.446868837f,
+    0.755201399f, 0.655492842f, -0.655492842f, 0.755201399f, 0.070504576f, 0.997511446f, -0.997511446f, 0.070504576f,
+    0.997060061f, 0.0766238645f, -0.0766238645f, 0.997060061f, 0.65084666f, 0.759209216f, -0.759209216f, 0.65084666f,
+    0.891840696f, 0.452349573f, -0.452349573f, 0.891840696f, 0.310767144f, 0.950486064f, -0.950486064f, 0.310767144f,
+    0.962953269f, 0.269668311f, -0.269668311f, 0.962953269f, 0.490226477f, 0.871595085f, -0.871595085f, 0.490226477f,
+    0.786455214f, 0.61764729f, -0.61764729f, 0.786455214f, 0.119365215f, 0.992850423f, -0.992850423f, 0.119365215f,
+    0.984748483f, 0.173983872f, -0.173983872f, 0.984748483f, 0.573297143f, 0.819347501f, -0.819347501f, 0.573297143f,
+    0.843208253f, 0.537587047f, -0.537587047f, 0.843208253f, 0.216106802f, 0.976369739f, -0.976369739f, 0.216106802f,
+    0.931884289f, 0.362755716f, -0.362755716f, 0.931884289f, 0.402434647f, 0.915448725f, -0.915448725f, 0.402434647f,
+    0.722128212f, 0.691759229f, -0.691759229f, 0.722128212f, 0.0214740802f, 0.99976939f, -0.99976939f, 0.0214740802f,
+    0.99988234f, 0.015339206f, -0.015339206f, 0.99988234f, 0.696177125f, 0.717870057f, -0.717870057f, 0.696177125f,
+    0.917900801f, 0.396809995f, -0.396809995f, 0.917900801f, 0.368466824f, 0.929640889f, -0.929640889f, 0.368466824f,
+    0.977677345f, 0.210111842f, -0.210111842f, 0.977677345f, 0.542750776f, 0.839893818f, -0.839893818f, 0.542750776f,
+    0.82284981f, 0.568258941f, -0.568258941f, 0.82284981f, 0.180022895f, 0.983662426f, -0.983662426f, 0.180022895f,
+    0.993564129f, 0.113270953f, -0.113270953f, 0.993564129f, 0.622461259f, 0.78265059f, -0.78265059f, 0.622461259f,
+    0.874586642f, 0.484869242f, -0.484869242f, 0.874586642f, 0.275571823f, 0.961280465f, -0.961280465f, 0.275571823f,
+    0.952374995f, 0.304929227f, -0.304929227f, 0.952374995f, 0.457813293f, 0.889048338f, -0.889048338f, 0.457813293f,
+    0.763188422f, 0.64617604f, -0.64617604f, 0.763188422f, 0.0827402622f, 0.996571124f, -0.996571124f, 0.0827402622f,
+    0.997925282f, 0.0643826276f, -0.0643826276f, 0.997925282f, 0.660114348f, 0.751165152f, -0.751165152f, 0.660114348f,
+    0.897324562f, 0.441371262f, -0.441371262f, 0.897324562f, 0.322407693f, 0.946600914f, -0.946600914f, 0.322407693f,
+    0.966189981f, 0.257831097f, -0.257831097f, 0.966189981f, 0.500885367f, 0.865513623f, -0.865513623f, 0.500885367f,
+    0.793975472f, 0.607949793f, -0.607949793f, 0.793975472f, 0.13154003f, 0.991310835f, -0.991310835f, 0.13154003f,
+    0.986809373f, 0.161886394f, -0.161886394f, 0.986809373f, 0.583308637f, 0.812250614f, -0.812250614f, 0.583308637f,
+    0.849741757f, 0.527199149f, -0.527199149f, 0.849741757f, 0.228072077f, 0.973644257f, -0.973644257f, 0.228072077f,
+    0.936265647f, 0.351292759f, -0.351292759f, 0.936265647f, 0.413638324f, 0.910441279f, -0.910441279f, 0.413638324f,
+    0.730562747f, 0.682845533f, -0.682845533f, 0.730562747f, 0.0337411724f, 0.999430597f, -0.999430597f, 0.0337411724f,
+    0.999204755f, 0.0398729257f, -0.0398729257f, 0.999204755f, 0.678350031f, 0.734738886f, -0.734738886f, 0.678350031f,
+    0.907886088f, 0.419216901f, -0.419216901f, 0.907886088f, 0.345541328f, 0.938403547f, -0.938403547f, 0.345541328f,
+    0.972226501f, 0.234041959f, -0.234041959f, 0.972226501f, 0.521975279f, 0.852960587f, -0.852960587f, 0.521975279f,
+    0.808656156f, 0.588281572f, -0.588281572f, 0.808656156f, 0.155828401f, 0.987784147f, -0.987784147f, 0.155828401f,
+    0.990485072f, 0.137620121f, -0.137620121f, 0.990485072f, 0.603066623f, 0.797690868f, -0.797690868f, 0.603066623f,
+    0.862423956f, 0.506186664f, -0.506186664f, 0.862423956f, 0.251897812f, 0.967753828f, -0.967753828f, 0.251897812f,
+    0.944604814f, 0.328209847f, -0.328209847f, 0.944604814f, 0.435857087f, 0.900015891f, -0.900015891f, 0.435857087f,
+    0.747100592f, 0.664710999f, -0.664710999f, 0.747100592f, 0.0582582653f, 0.998301566f, -0.998301566f, 0.0582582653f,
+    0.996044695f, 0.0888535529f, -0.0888535529f, 0.996044695f, 0.641481042f, 0.767138898f, -0.767138898f, 0.641481042f,
+    0.886222541f, 0.463259786f, -0.463259786f, 0.886222541f, 0.299079835f, 0.954228103f, -0.954228103f, 0.299079835f,
+    0.95957154f, 0.281464934f, -0.281464934f, 0.95957154f, 0.479493767f, 0.877545297f, -0.877545297f, 0.479493767f,
+    0.778816521f, 0.627251804f, -0.627251804f, 0.778816521f, 0.107172422f, 0.994240463f, -0.994240463f, 0.107172422f,
+    0.982539296f, 0.186055154f, -0.186055154f, 0.982539296f, 0.563199341f, 0.826321065f, -0.826321065f, 0.563199341f,
+    0.836547732f, 0.547894061f, -0.547894061f, 0.836547732f, 0.204108968f, 0.978948176f, -0.978948176f, 0.204108968f,
+    0.927362502f, 0.374164075f, -0.374164075f, 0.927362502f, 0.391170382f, 0.920318305f, -0.920318305f, 0.391170382f,
+    0.71358484f, 0.700568795f, -0.700568795f, 0.71358484f, 0.00920375437f, 0.999957621f, -0.999957621f, 0.00920375437f,
+    0.999957621f, 0.00920375437f, -0.00920375437f, 0.999957621f, 0.700568795f, 0.71358484f, -0.71358484f, 0.700568795f,
+    0.920318305f, 0.391170382f, -0.391170382f, 0.920318305f, 0.374164075f, 0.927362502f, -0.927362502f, 0.374164075f,
+    0.978948176f, 0.204108968f, -0.204108968f, 0.978948176f, 0.547894061f, 0.836547732f, -0.836547732f, 0.547894061f,
+    0.826321065f, 0.563199341f, -0.563199341f, 0.826321065f, 0.186055154f, 0.982539296f, -0.982539296f, 0.186055154f,
+    0.994240463f, 0.107172422f, -0.107172422f, 0.994240463f, 0.627251804f, 0.778816521f, -0.778816521f, 0.627251804f,
+    0.877545297f, 0.479493767f, -0.479493767f, 0.877545297f, 0.281464934f, 0.95957154f, -0.95957154f, 0.281464934f,
+    0.954228103f, 0.299079835f, -0.299079835f, 0.954228103f, 0.463259786f, 0.886222541f, -0.886222541f, 0.463259786f,
+    0.767138898f, 0.641481042f, -0.641481042f, 0.767138898f, 0.0888535529f, 0.996044695f, -0.996044695f, 0.0888535529f,
+    0.998301566f, 0.0582582653f, -0.0582582653f, 0.998301566f, 0.664710999f, 0.747100592f, -0.747100592f, 0.664710999f,
+    0.900015891f, 0.435857087f, -0.435857087f, 0.900015891f, 0.328209847f, 0.944604814f, -0.944604814f, 0.328209847f,
+    0.967753828f, 0.251897812f, -0.251897812f, 0.967753828f, 0.506186664f, 0.862423956f, -0.862423956f, 0.506186664f,
+    0.797690868f, 0.603066623f, -0.603066623f, 0.797690868f, 0.137620121f, 0.990485072f, -0.990485072f, 0.137620121f,
+    0.987784147f, 0.155828401f, -0.155828401f, 0.987784147f, 0.588281572f, 0.808656156f, -0.808656156f, 0.588281572f,
+    0.852960587f, 0.521975279f, -0.521975279f, 0.852960587f, 0.234041959f, 0.972226501f, -0.972226501f, 0.234041959f,
+    0.938403547f, 0.345541328f, -0.345541328f, 0.938403547f, 0.419216901f, 0.907886088f, -0.907886088f, 0.419216901f,
+    0.734738886f, 0.678350031f, -0.678350031f, 0.734738886f, 0.0398729257f, 0.999204755f, -0.999204755f, 0.0398729257f,
+    0.999430597f, 0.0337411724f, -0.0337411724f, 0.999430597f, 0.682845533f, 0.730562747f, -0.730562747f, 0.682845533f,
+    0.910441279f, 0.413638324f, -0.413638324f, 0.910441279f, 0.351292759f, 0.936265647f, -0.936265647f, 0.351292759f,
+    0.973644257f, 0.228072077f, -0.228072077f, 0.973644257f, 0.527199149f, 0.849741757f, -0.849741757f, 0.527199149f,
+    0.812250614f, 0.583308637f, -0.583308637f, 0.812250614f, 0.161886394f, 0.986809373f, -0.986809373f, 0.161886394f,
+    0.991310835f, 0.13154003f, -0.13154003f, 0.991310835f, 0.607949793f, 0.793975472f, -0.793975472f, 0.607949793f,
+    0.865513623f, 0.500885367f, -0.500885367f, 0.865513623f, 0.257831097f, 0.966189981f, -0.966189981f, 0.257831097f,
+    0.946600914f, 0.322407693f, -0.322407693f, 0.946600914f, 0.441371262f, 0.897324562f, -0.897324562f, 0.441371262f,
+    0.751165152f, 0.660114348f, -0.660114348f, 0.751165152f, 0.0643826276f, 0.997925282f, -0.997925282f, 0.0643826276f,
+    0.996571124f, 0.0827402622f, -0.0827402622f, 0.996571124f, 0.64617604f, 0.763188422f, -0.763188422f, 0.64617604f,
+    0.889048338f, 0.457813293f, -0.457813293f, 0.889048338f, 0.304929227f, 0.952374995f, -0.952374995f, 0.304929227f,
+    0.961280465f, 0.275571823f, -0.275571823f, 0.961280465f, 0.484869242f, 0.874586642f, -0.874586642f, 0.484869242f,
+    0.78265059f, 0.622461259f, -0.622461259f, 0.78265059f, 0.113270953f, 0.993564129f, -0.993564129f, 0.113270953f,
+    0.983662426f, 0.180022895f, -0.180022895f, 0.983662426f, 0.568258941f, 0.82284981f, -0.82284981f, 0.568258941f,
+    0.839893818f, 0.542750776f, -0.542750776f, 0.839893818f, 0.210111842f, 0.977677345f, -0.977677345f, 0.210111842f,
+    0.929640889f, 0.368466824f, -0.368466824f, 0.929640889f, 0.396809995f, 0.917900801f, -0.917900801f, 0.396809995f,
+    0.717870057f, 0.696177125f, -0.696177125f, 0.717870057f, 0.015339206f, 0.99988234f, -0.99988234f, 0.015339206f,
+    0.99976939f, 0.0214740802f, -0.0214740802f, 0.99976939f, 0.691759229f, 0.722128212f, -0.722128212f, 0.691759229f,
+    0.915448725f, 0.402434647f, -0.402434647f, 0.915448725f, 0.362755716f, 0.931884289f, -0.931884289f, 0.362755716f,
+    0.976369739f, 0.216106802f, -0.216106802f, 0.976369739f, 0.537587047f, 0.843208253f, -0.843208253f, 0.537587047f,
+    0.819347501f, 0.573297143f, -0.573297143f, 0.819347501f, 0.173983872f, 0.984748483f, -0.984748483f, 0.173983872f,
+    0.992850423f, 0.119365215f, -0.119365215f, 0.992850423f, 0.61764729f, 0.786455214f, -0.786455214f, 0.61764729f,
+    0.871595085f, 0.490226477f, -0.490226477f, 0.871595085f, 0.269668311f, 0.962953269f, -0.962953269f, 0.269668311f,
+    0.950486064f, 0.310767144f, -0.310767144f, 0.950486064f, 0.452349573f, 0.891840696f, -0.891840696f, 0.452349573f,
+    0.759209216f, 0.65084666f, -0.65084666f, 0.759209216f, 0.0766238645f, 0.997060061f, -0.997060061f, 0.0766238645f,
+    0.997511446f, 0.070504576f, -0.070504576f, 0.997511446f, 0.655492842f, 0.755201399f, -0.755201399f, 0.655492842f,
+    0.894599497f, 0.446868837f, -0.446868837f, 0.894599497f, 0.316593379f, 0.94856137f, -0.94856137f, 0.316593379f,
+    0.964589775f, 0.263754666f, -0.263754666f, 0.964589775f, 0.495565265f, 0.868570685f, -0.868570685f, 0.495565265f,
+    0.790230215f, 0.612810075f, -0.612810075f, 0.790230215f, 0.125454977f, 0.992099285f, -0.992099285f, 0.125454977f,
+    0.985797524f, 0.167938292f, -0.167938292f, 0.985797524f, 0.578313768f, 0.815814435f, -0.815814435f, 0.578313768f,
+    0.84649092f, 0.532403111f, -0.532403111f, 0.84649092f, 0.222093627f, 0.975025356f, -0.975025356f, 0.222093627f,
+    0.934092522f, 0.357030958f, -0.357030958f, 0.934092522f, 0.408044159f, 0.912962198f, -0.912962198f, 0.408044159f,
+    0.726359129f, 0.687315345f, -0.687315345f, 0.726359129f, 0.027608145f, 0.999618828f, -0.999618828f, 0.027608145f,
+    0.998941302f, 0.0460031815f, -0.0460031815f, 0.998941302f, 0.673829019f, 0.73888731f, -0.73888731f, 0.673829019f,
+    0.905296743f, 0.424779683f, -0.424779683f, 0.905296743f, 0.339776874f, 0.940506041f, -0.940506041f, 0.339776874f,
+    0.970772147f, 0.24000302f, -0.24000302f, 0.970772147f, 0.516731799f, 0.856147349f, -0.856147349f, 0.516731799f,
+    0.805031359f, 0.593232274f, -0.593232274f, 0.805031359f, 0.149764538f, 0.988721669f, -0.988721669f, 0.149764538f,
+    0.989621997f, 0.143695027f, -0.143695027f, 0.989621997f, 0.598160684f, 0.801376164f, -0.801376164f, 0.598160684f,
+    0.859301805f, 0.511468828f, -0.511468828f, 0.859301805f, 0.24595505f, 0.969281256f, -0.969281256f, 0.24595505f,
+    0.94257319f, 0.333999664f, -0.333999664f, 0.94257319f, 0.430326492f, 0.902673304f, -0.902673304f, 0.430326492f,
+    0.743007958f, 0.669282615f, -0.669282615f, 0.743007958f, 0.052131705f, 0.998640239f, -0.998640239f, 0.052131705f,
+    0.995480776f, 0.0949634984f, -0.0949634984f, 0.995480776f, 0.636761844f, 0.771060526f, -0.771060526f, 0.636761844f,
+    0.883363366f, 0.468688816f, -0.468688816f, 0.883363366f, 0.293219149f, 0.95604527f, -0.95604527f, 0.293219149f,
+    0.957826436f, 0.287347466f, -0.287347466f, 0.957826436f, 0.474100202f, 0.880470872f, -0.880470872f, 0.474100202f,
+    0.774953127f, 0.632018745f, -0.632018745f, 0.774953127f, 0.10106986f, 0.994879305f, -0.994879305f, 0.10106986f,
+    0.981379211f, 0.192080393f, -0.192080393f, 0.981379211f, 0.558118522f, 0.829761207f, -0.829761207f, 0.558118522f,
+    0.833170176f, 0.553016722f, -0.553016722f, 0.833170176f, 0.198098406f, 0.980182111f, -0.980182111f, 0.198098406f,
+    0.925049245f, 0.379847199f, -0.379847199f, 0.925049245f, 0.385516047f, 0.92270112f, -0.92270112f, 0.385516047f,
+    0.709272802f, 0.704934061f, -0.704934061f, 0.709272802f, 0.00306795677f, 0.999995291f, -0.999995291f, 0.00306795677f,
+};
+static const float fft_w_table_r4[4096] __attribute__((aligned(16))) = {
+    1.0f, 0.0f, 0.999995291f, 0.00306795677f, 0.999981165f, 0.00613588467f, 0.999957621f, 0.00920375437f,
+    0.999924719f, 0.0122715384f, 0.99988234f, 0.015339206f, 0.999830604f, 0.0184067301f, 0.99976939f, 0.0214740802f,
+    0.999698818f, 0.024541229f, 0.999618828f, 0.027608145f, 0.999529421f, 0.030674804f, 0.999430597f, 0.0337411724f,
+    0.999322355f, 0.0368072242f, 0.999204755f, 0.0398729257f, 0.999077737f, 0.0429382585f, 0.998941302f, 0.0460031815f,
+    0.99879545f, 0.0490676761f, 0.998640239f, 0.052131705f, 0.998475552f, 0.0551952459f, 0.998301566f, 0.0582582653f,
+    0.998118103f, 0.061320737f, 0.997925282f, 0.0643826276f, 0.997723043f, 0.0674439222f, 0.997511446f, 0.070504576f,
+    0.997290432f, 0.0735645667f, 0.997060061f, 0.0766238645f, 0.996820271f, 0.0796824396f, 0.996571124f, 0.0827402622f,
+    0.996312618f, 0.0857973099f, 0.996044695f, 0.0888535529f, 0.995767415f, 0.0919089541f, 0.995480776f, 0.0949634984f,
+    0.99518472f, 0.0980171412f, 0.994879305f, 0.10106986f, 0.994564593f, 0.104121633f, 0.994240463f, 0.107172422f,
+    0.993906975f, 0.110222206f, 0.993564129f, 0.113270953f, 0.993211925f, 0.116318628f, 0.992850423f, 0.119365215f,
+    0.992479563f, 0.122410677f, 0.992099285f, 0.125454977f, 0.991709769f, 0.128498107f, 0.991310835f, 0.13154003f,
+    0.990902662f, 0.134580702f, 0.990485072f, 0.137620121f, 0.990058184f, 0.140658244f, 0.989621997f, 0.143695027f,
+    0.989176512f, 0.146730468f, 0.988721669f, 0.149764538f, 0.988257587f, 0.152797192f, 0.987784147f, 0.155828401f,
+    0.987301409f, 0.15885815f, 0.986809373f, 0.161886394f, 0.986308098f, 0.164913118f, 0.985797524f, 0.167938292f,
+    0.985277653f, 0.170961887f, 0.984748483f, 0.173983872f, 0.984210074f, 0.177004218f, 0.983662426f, 0.180022895f,
+    0.983105481f, 0.183039889f, 0.982539296f, 0.186055154f, 0.981963873f, 0.18906866f, 0.981379211f, 0.192080393f,
+    0.980785251f, 0.195090324f, 0.980182111f, 0.198098406f, 0.979569793f, 0.201104641f, 0.978948176f, 0.204108968f,
+    0.97831738f, 0.207111374f, 0.977677345f, 0.210111842f, 0.977028131f, 0.213110313f, 0.976369739f, 0.216106802f,
+    0.975702107f, 0.219101235f, 0.975025356f, 0.222093627f, 0.974339366f, 0.225083917f, 0.973644257f, 0.228072077f,
+    0.972939968f, 0.231058106f, 0.972226501f, 0.234041959f, 0.971503913f, 0.237023607f, 0.970772147f, 0.24000302f,
+    0.970031261f, 0.242980182f, 0.969281256f, 0.24595505f, 0.968522072f, 0.248927608f, 0.967753828f, 0.251897812f,
+    0.966976464f, 0.254865646f, 0.966189981f, 0.257831097f, 0.965394437f, 0.260794103f, 0.964589775f, 0.263754666f,
+    0.963776052f, 0.266712755f, 0.962953269f, 0.269668311f, 0.962121427f, 0.272621363f, 0.961280465f, 0.275571823f,
+    0.960430503f, 0.27851969f, 0.95957154f, 0.281464934f, 0.958703458f, 0.284407526f, 0.957826436f, 0.287347466f,
+    0.956940353f, 0.290284663f, 0.95604527f, 0.293219149f, 0.955141187f, 0.296150893f, 0.954228103f, 0.299079835f,
+    0.953306019f, 0.302005947f, 0.952374995f, 0.304929227f, 0.95143503f, 0.307849646f, 0.950486064f, 0.310767144f,
+    0.949528158f, 0.313681751f, 0.94856137f, 0.316593379f, 0.947585583f, 0.319502026f, 0.946600914f, 0.322407693f,
+    0.945607305f, 0.32531029f, 0.944604814f, 0.328209847f, 0.943593442f, 0.331106305f, 0.94257319f, 0.333999664f,
+    0.941544056f, 0.336889863f, 0.940506041f, 0.339776874f, 0.939459205f, 0.342660725f, 0.938403547f, 0.345541328f,
+    0.937339008f, 0.348418683f, 0.936265647f, 0.351292759f, 0.935183525f, 0.354163527f, 0.934092522f, 0.357030958f,
+    0.932992816f, 0.359895051f, 0.931884289f, 0.362755716f, 0.93076694f, 0.365612984f, 0.929640889f, 0.368466824f,
+    0.928506076f, 0.371317208f, 0.927362502f, 0.374164075f, 0.926210225f, 0.377007425f, 0.925049245f, 0.379847199f,
+    0.923879504f, 0.382683426f, 0.92270112f, 0.385516047f, 0.921514034f, 0.388345033f, 0.920318305f, 0.391170382f,
+    0.919113874f, 0.393992037f, 0.917900801f, 0.396809995f, 0.916679084f, 0.399624199f, 0.915448725f, 0.402434647f,
+    0.914209783f, 0.405241311f, 0.912962198f, 0.408044159f, 0.91170603f, 0.410843164f, 0.910441279f, 0.413638324f,
+    0.909168005f, 0.416429549f, 0.907886088f, 0.419216901f, 0.906595707f, 0.422000259f, 0.905296743f, 0.424779683f,
+    0.903989315f, 0.427555084f, 0.902673304f, 0.430326492f, 0.901348829f, 0.433093816f, 0.900015891f, 0.435857087f,
+    0.898674488f, 0.438616246f, 0.897324562f, 0.441371262f, 0.895966232f, 0.444122136f, 0.894599497f, 0.446868837f,
+    0.893224299f, 0.449611336f, 0.891840696f, 0.452349573f, 0.890448749f, 0.455083579f, 0.889048338f, 0.457813293f,
+    0.887639642f, 0.460538715f, 0.886222541f, 0.463259786f, 0.884797096f, 0.465976506f, 0.883363366f, 0.468688816f,
+    0.881921291f, 0.471396744f, 0.880470872f, 0.474100202f, 0.879012227f, 0.47679922f, 0.877545297f, 0.479493767f,
+    0.876070082f, 0.482183784f, 0.874586642f, 0.484869242f, 0.873094976f, 0.487550169f, 0.871595085f, 0.490226477f,
+    0.870086968f, 0.492898196f, 0.868570685f, 0.495565265f, 0.867046237f, 0.498227656f, 0.865513623f, 0.500885367f,
+    0.863972843f, 0.50353837f, 0.862423956f, 0.506186664f, 0.860866964f, 0.50883013f, 0.859301805f, 0.511468828f,
+    0.857728601f, 0.514102757f, 0.856147349f, 0.516731799f, 0.854557991f, 0.519356012f, 0.852960587f, 0.521975279f,
+    0.851355195f, 0.524589658f, 0.849741757f, 0.527199149f, 0.848120332f, 0.529803634f, 0.84649092f, 0.532403111f,
+    0.84485358f, 0.534997642f, 0.843208253f, 0.537587047f, 0.841554999f, 0.540171444f, 0.839893818f, 0.542750776f,
+    0.838224709f, 0.545324981f, 0.836547732f, 0.547894061f, 0.834862888f, 0.550457954f, 0.833170176f, 0.553016722f,
+    0.831469595f, 0.555570245f, 0.829761207f, 0.558118522f, 0.82804507f, 0.560661554f, 0.826321065f, 0.563199341f,
+    0.824589312f, 0.565731823f, 0.82284981f, 0.568258941f, 0.8211025f, 0.570780754f, 0.819347501f, 0.573297143f,
+    0.817584813f, 0.575808167f, 0.815814435f, 0.578313768f, 0.81403631f, 0.580813944f, 0.812250614f, 0.583308637f,
+    0.81045717f, 0.585797846f, 0.808656156f, 0.588281572f, 0.806847572f, 0.590759695f, 0.805031359f, 0.593232274f,
+    0.803207517f, 0.59569931f, 0.801376164f, 0.598160684f, 0.799537241f, 0.600616455f, 0.797690868f, 0.603066623f,
+    0.795836926f, 0.605511069f, 0.793975472f, 0.607949793f, 0.792106569f, 0.610382795f, 0.790230215f, 0.612810075f,
+    0.78834641f, 0.615231574f, 0.786455214f, 0.61764729f, 0.784556568f, 0.620057225f, 0.78265059f, 0.622461259f,
+    0.780737221f, 0.624859512f, 0.778816521f, 0.627251804f, 0.77688849f, 0.629638255f, 0.774953127f, 0.632018745f,
+    0.773010433f, 0.634393275f, 0.771060526f, 0.636761844f, 0.769103348f, 0.639124453f, 0.767138898f, 0.641481042f,
+    0.765167236f, 0.643831551f, 0.763188422f, 0.64617604f, 0.761202395f, 0.64851439f, 0.759209216f, 0.65084666f,
+    0.757208824f, 0.653172851f, 0.755201399f, 0.655492842f, 0.753186822f, 0.657806695f, 0.751165152f, 0.660114348f,
+    0.749136388f, 0.662415802f, 0.747100592f, 0.664710999f, 0.745057762f, 0.666999936f, 0.743007958f, 0.669282615f,
+    0.740951121f, 0.671558976f, 0.73888731f, 0.673829019f, 0.736816585f, 0.676092684f, 0.734738886f, 0.678350031f,
+    0.732654274f, 0.680601001f, 0.730562747f, 0.682845533f, 0.728464365f, 0.685083687f, 0.726359129f, 0.687315345f,
+    0.724247098f, 0.689540565f, 0.722128212f, 0.691759229f, 0.720002532f, 0.693971455f, 0.717870057f, 0.696177125f,
+    0.715730846f, 0.698376238f, 0.71358484f, 0.700568795f, 0.711432219f, 0.702754736f, 0.709272802f, 0.704934061f,
+    0.707106769f, 0.707106769f, 0.704934061f, 0.709272802f, 0.702754736f, 0.711432219f, 0.700568795f, 0.71358484f,
+    0.698376238f, 0.715730846f, 0.696177125f, 0.717870057f, 0.693971455f, 0.720002532f, 0.691759229f, 0.722128212f,
+    0.689540565f, 0.724247098f, 0.687315345f, 0.726359129f, 0.685083687f, 0.728464365f, 0.682845533f, 0.730562747f,
+    0.680601001f, 0.732654274f, 0.678350031f, 0.734738886f, 0.676092684f, 0.736816585f, 0.673829019f, 0.73888731f,
+    0.671558976f, 0.740951121f, 0.669282615f, 0.743007958f, 0.666999936f, 0.745057762f, 0.664710999f, 0.747100592f,
+    0.662415802f, 0.749136388f, 0.660114348f, 0.751165152f, 0.657806695f, 0.753186822f, 0.655492842f, 0.755201399f,
+    0.653172851f, 0.757208824f, 0.65084666f, 0.759209216f, 0.64851439f, 0.761202395f, 0.64617604f, 0.763188422f,
+    0.643831551f, 0.765167236f, 0.641481042f, 0.767138898f, 0.639124453f, 0.769103348f, 0.636761844f, 0.771060526f,
+    0.634393275f, 0.773010433f, 0.632018745f, 0.774953127f, 0.629638255f, 0.77688849f, 0.627251804f, 0.778816521f,
+    0.624859512f, 0.780737221f, 0.622461259f, 0.78265059f, 0.620057225f, 0.784556568f, 0.61764729f, 0.786455214f,
+    0.615231574f, 0.78834641f, 0.612810075f, 0.790230215f, 0.610382795f, 0.792106569f, 0.607949793f, 0.793975472f,
+    0.605511069f, 0.795836926f, 0.603066623f, 0.797690868f, 0.600616455f, 0.799537241f, 0.598160684f, 0.801376164f,
+    0.59569931f, 0.803207517f, 0.593232274f, 0.805031359f, 0.590759695f, 0.806847572f, 0.588281572f, 0.808656156f,
+    0.585797846f, 0.81045717f, 0.583308637f, 0.812250614f, 0.580813944f, 0.81403631f, 0.578313768f, 0.815814435f,
+    0.575808167f, 0.817584813f, 0.573297143f, 0.819347501f, 0.570780754f, 0.8211025f, 0.568258941f, 0.82284981f,
+    0.565731823f, 0.824589312f, 0.563199341f, 0.826321065f, 0.560661554f, 0.82804507f, 0.558118522f, 0.829761207f,
+    0.555570245f, 0.831469595f, 0.553016722f, 0.833170176f, 0.550457954f, 0.834862888f, 0.547894061f, 0.836547732f,
+    0.545324981f, 0.838224709f, 0.542750776f, 0.839893818f, 0.540171444f, 0.841554999f, 0.537587047f, 0.843208253f,
+    0.534997642f, 0.84485358f, 0.532403111f, 0.84649092f, 0.529803634f, 0.848120332f, 0.527199149f, 0.849741757f,
+    0.524589658f, 0.851355195f, 0.521975279f, 0.852960587f, 0.519356012f, 0.854557991f, 0.516731799f, 0.856147349f,
+    0.514102757f, 0.857728601f, 0.511468828f, 0.859301805f, 0.50883013f, 0.860866964f, 0.506186664f, 0.862423956f,
+    0.50353837f, 0.863972843f, 0.500885367f, 0.865513623f, 0.498227656f, 0.867046237f, 0.495565265f, 0.868570685f,
+    0.492898196f, 0.870086968f, 0.490226477f, 0.871595085f, 0.487550169f, 0.873094976f, 0.484869242f, 0.874586642f,
+    0.482183784f, 0.876070082f, 0.479493767f, 0.877545297f, 0.47679922f, 0.879012227f, 0.474100202f, 0.880470872f,
+    0.471396744f, 0.881921291f, 0.468688816f, 0.883363366f, 0.465976506f, 0.884797096f, 0.463259786f, 0.886222541f,
+    0.460538715f, 0.887639642f, 0.457813293f, 0.889048338f, 0.455083579f, 0.890448749f, 0.452349573f, 0.891840696f,
+    0.449611336f, 0.893224299f, 0.446868837f, 0.894599497f, 0.444122136f, 0.895966232f, 0.441371262f, 0.897324562f,
+    0.438616246f, 0.898674488f, 0.435857087f, 0.900015891f, 0.433093816f, 0.901348829f, 0.430326492f, 0.902673304f,
+    0.427555084f, 0.903989315f, 0.424779683f, 0.905296743f, 0.422000259f, 0.906595707f, 0.419216901f, 0.907886088f,
+    0.416429549f, 0.909168005f, 0.413638324f, 0.910441279f, 0.410843164f, 0.91170603f, 0.408044159f, 0.912962198f,
+    0.405241311f, 0.914209783f, 0.402434647f, 0.915448725f, 0.399624199f, 0.916679084f, 0.396809995f, 0.917900801f,
+    0.393992037f, 0.919113874f, 0.391170382f, 0.920318305f, 0.388345033f, 0.921514034f, 0.385516047f, 0.92270112f,
+    0.382683426f, 0.923879504f, 0.379847199f, 0.925049245f, 0.377007425f, 0.926210225f, 0.374164075f, 0.927362502f,
+    0.371317208f, 0.928506076f, 0.368466824f, 0.929640889f, 0.365612984f, 0.93076694f, 0.362755716f, 0.931884289f,
+    0.359895051f, 0.932992816f, 0.357030958f, 0.934092522f, 0.354163527f, 0.935183525f, 0.351292759f, 0.936265647f,
+    0.348418683f, 0.937339008f, 0.345541328f, 0.938403547f, 0.342660725f, 0.939459205f, 0.339776874f, 0.940506041f,
+    0.336889863f, 0.941544056f, 0.333999664f, 0.94257319f, 0.331106305f, 0.943593442f, 0.328209847f, 0.944604814f,
+    0.32531029f, 0.945607305f, 0.322407693f, 0.946600914f, 0.319502026f, 0.947585583f, 0.316593379f, 0.94856137f,
+    0.313681751f, 0.949528158f, 0.310767144f, 0.950486064f, 0.307849646f, 0.95143503f, 0.304929227f, 0.952374995f,
+    0.302005947f, 0.953306019f, 0.299079835f, 0.954228103f, 0.296150893f, 0.955141187f, 0.293219149f, 0.95604527f,
+    0.290284663f, 0.956940353f, 0.287347466f, 0.957826436f, 0.284407526f, 0.958703458f, 0.281464934f, 0.95957154f,
+    0.27851969f, 0.960430503f, 0.275571823f, 0.961280465f, 0.272621363f, 0.962121427f, 0.269668311f, 0.962953269f,
+    0.266712755f, 0.963776052f, 0.263754666f, 0.964589775f, 0.260794103f, 0.965394437f, 0.257831097f, 0.966189981f,
+    0.254865646f, 0.966976464f, 0.251897812f, 0.967753828f, 0.248927608f, 0.968522072f, 0.24595505f, 0.969281256f,
+    0.242980182f, 0.970031261f, 0.24000302f, 0.970772147f, 0.237023607f, 0.971503913f, 0.234041959f, 0.972226501f,
+    0.231058106f, 0.972939968f, 0.228072077f, 0.973644257f, 0.225083917f, 0.974339366f, 0.222093627f, 0.975025356f,
+    0.219101235f, 0.975702107f, 0.216106802f, 0.976369739f, 0.213110313f, 0.977028131f, 0.210111842f, 0.977677345f,
+    0.207111374f, 0.97831738f, 0.204108968f, 0.978948176f, 0.201104641f, 0.979569793f, 0.198098406f, 0.980182111f,
+    0.195090324f, 0.980785251f, 0.192080393f, 0.981379211f, 0.18906866f, 0.981963873f, 0.186055154f, 0.982539296f,
+    0.183039889f, 0.983105481f, 0.180022895f, 0.983662426f, 0.177004218f, 0.984210074f, 0.173983872f, 0.984748483f,
+    0.170961887f, 0.985277653f, 0.167938292f, 0.985797524f, 0.164913118f, 0.986308098f, 0.161886394f, 0.986809373f,
+    0.15885815f, 0.987301409f, 0.155828401f, 0.987784147f, 0.152797192f, 0.988257587f, 0.149764538f, 0.988721669f,
+    0.146730468f, 0.989176512f, 0.143695027f, 0.989621997f, 0.140658244f, 0.990058184f, 0.137620121f, 0.990485072f,
+    0.134580702f, 0.990902662f, 0.13154003f, 0.991310835f, 0.128498107f, 0.991709769f, 0.125454977f, 0.992099285f,
+    0.122410677f, 0.992479563f, 0.119365215f, 0.992850423f, 0.116318628f, 0.993211925f, 0.113270953f, 0.993564129f,
+    0.110222206f, 0.993906975f, 0.107172422f, 0.994240463f, 0.104121633f, 0.994564593f, 0.10106986f, 0.994879305f,
+    0.0980171412f, 0.99518472f, 0.0949634984f, 0.995480776f, 0.0919089541f, 0.995767415f, 0.0888535529f, 0.996044695f,
+    0.0857973099f, 0.996312618f, 0.0827402622f, 0.996571124f, 0.0796824396f, 0.996820271f, 0.0766238645f, 0.997060061f,
+    0.0735645667f, 0.997290432f, 0.070504576f, 0.997511446f, 0.0674439222f, 0.997723043f, 0.0643826276f, 0.997925282f,
+    0.061320737f, 0.998118103f, 0.0582582653f, 0.998301566f, 0.0551952459f, 0.998475552f, 0.052131705f, 0.998640239f,
+    0.0490676761f, 0.99879545f, 0.0460031815f, 0.998941302f, 0.0429382585f, 0.999077737f, 0.0398729257f, 0.999204755f,
+    0.0368072242f, 0.999322355f, 0.0337411724f, 0.999430597f, 0.030674804f, 0.999529421f, 0.027608145f, 0.999618828f,
+    0.024541229f, 0.999698818f, 0.0214740802f, 0.99976939f, 0.0184067301f, 0.999830604f, 0.015339206f, 0.99988234f,
+    0.0122715384f, 0.999924719f, 0.00920375437f, 0.999957621f, 0.00613588467f, 0.999981165f, 0.00306795677f, 0.999995291f,
+    6.12323426e-17f, 1.0f, -0.00306795677f, 0.999995291f, -0.00613588467f, 0.999981165f, -0.00920375437f, 0.999957621f,
+    -0.0122715384f, 0.999924719f, -0.015339206f, 0.99988234f, -0.0184067301f, 0.999830604f, -0.0214740802f, 0.99976939f,
+    -0.024541229f, 0.999698818f, -0.027608145f, 0.999618828f, -0.030674804f, 0.999529421f, -0.0337411724f, 0.999430597f,
+    -0.0368072242f, 0.999322355f, -0.0398729257f, 0.999204755f, -0.0429382585f, 0.999077737f, -0.0460031815f, 0.998941302f,
+    -0.0490676761f, 0.99879545f, -0.052131705f, 0.998640239f, -0.0551952459f, 0.998475552f, -0.0582582653f, 0.998301566f,
+    -0.061320737f, 0.998118103f, -0.0643826276f, 0.997925282f, -0.0674439222f, 0.997723043f, -0.070504576f, 0.997511446f,
+    -0.0735645667f, 0.997290432f, -0.0766238645f, 0.997060061f, -0.0796824396f, 0.996820271f, -0.0827402622f, 0.996571124f,
+    -0.0857973099f, 0.996312618f, -0.0888535529f, 0.996044695f, -0.0919089541f, 0.995767415f, -0.0949634984f, 0.995480776f,
+    -0.0980171412f, 0.99518472f, -0.10106986f, 0.994879305f, -0.104121633f, 0.994564593f, -0.107172422f, 0.994240463f,
+    -0.110222206f, 0.993906975f, -0.113270953f, 0.993564129f, -0.116318628f, 0.993211925f, -0.119365215f, 0.992850423f,
+    -0.122410677f, 0.992479563f, -0.125454977f, 0.992099285f, -0.128498107f, 0.991709769f, -0.13154003f, 0.991310835f,
+    -0.134580702f, 0.990902662f, -0.137620121f, 0.990485072f, -0.140658244f, 0.990058184f, -0.143695027f, 0.989621997f,
+    -0.146730468f, 0.989176512f, -0.149764538f, 0.988721669f, -0.152797192f, 0.988257587f, -0.155828401f, 0.987784147f,
+    -0.15885815f, 0.987301409f, -0.161886394f, 0.986809373f, -0.164913118f, 0.986308098f, -0.167938292f, 0.985797524f,
+    -0.170961887f, 0.985277653f, -0.173983872f, 0.984748483f, -0.177004218f, 0.984210074f, -0.180022895f, 0.983662426f,
+    -0.183039889f, 0.983105481f, -0.186055154f, 0.982539296f, -0.18906866f, 0.981963873f, -0.192080393f, 0.981379211f,
+    -0.195090324f, 0.980785251f, -0.198098406f, 0.980182111f, -0.201104641f, 0.979569793f, -0.204108968f, 0.978948176f,
+    -0.207111374f, 0.97831738f, -0.210111842f, 0.977677345f, -0.213110313f, 0.977028131f, -0.216106802f, 0.976369739f,
+    -0.219101235f, 0.975702107f, -0.222093627f, 0.975025356f, -0.225083917f, 0.974339366f, -0.228072077f, 0.973644257f,
+    -0.231058106f, 0.972939968f, -0.234041959f, 0.972226501f, -0.237023607f, 0.971503913f, -0.24000302f, 0.970772147f,
+    -0.242980182f, 0.970031261f, -0.24595505f, 0.969281256f, -0.248927608f, 0.968522072f, -0.251897812f, 0.967753828f,
+    -0.254865646f, 0.966976464f, -0.257831097f, 0.966189981f, -0.260794103f, 0.965394437f, -0.263754666f, 0.964589775f,
+    -0.266712755f, 0.963776052f, -0.269668311f, 0.962953269f, -0.272621363f, 0.962121427f, -0.275571823f, 0.961280465f,
+    -0.27851969f, 0.960430503f, -0.281464934f, 0.95957154f, -0.284407526f, 0.958703458f, -0.287347466f, 0.957826436f,
+    -0.290284663f, 0.956940353f, -0.293219149f, 0.95604527f, -0.296150893f, 0.955141187f, -0.299079835f, 0.954228103f,
+    -0.302005947f, 0.953306019f, -0.304929227f, 0.952374995f, -0.307849646f, 0.95143503f, -0.310767144f, 0.950486064f,
+    -0.313681751f, 0.949528158f, -0.316593379f, 0.94856137f, -0.319502026f, 0.947585583f, -0.322407693f, 0.946600914f,
+    -0.32531029f, 0.945607305f, -0.328209847f, 0.944604814f, -0.331106305f, 0.943593442f, -0.333999664f, 0.94257319f,
+    -0.336889863f, 0.941544056f, -0.339776874f, 0.940506041f, -0.342660725f, 0.939459205f, -0.345541328f, 0.938403547f,
+    -0.348418683f, 0.937339008f, -0.351292759f, 0.936265647f, -0.354163527f, 0.935183525f, -0.357030958f, 0.934092522f,
+    -0.359895051f, 0.932992816f, -0.362755716f, 0.931884289f, -0.365612984f, 0.93076694f, -0.368466824f, 0.929640889f,
+    -0.371317208f, 0.928506076f, -0.374164075f, 0.927362502f, -0.377007425f, 0.926210225f, -0.379847199f, 0.925049245f,
+    -0.382683426f, 0.923879504f, -0.385516047f, 0.92270112f, -0.388345033f, 0.921514034f, -0.391170382f, 0.920318305f,
+    -0.393992037f, 0.919113874f, -0.396809995f, 0.917900801f, -0.399624199f, 0.916679084f, -0.402434647f, 0.915448725f,
+    -0.405241311f, 0.914209783f, -0.408044159f, 0.912962198f, -0.410843164f, 0.91170603f, -0.413638324f, 0.910441279f,
+    -0.416429549f, 0.909168005f, -0.419216901f, 0.907886088f, -0.422000259f, 0.906595707f, -0.424779683f, 0.905296743f,
+    -0.427555084f, 0.903989315f, -0.430326492f, 0.902673304f, -0.433093816f, 0.901348829f, -0.435857087f, 0.900015891f,
+    -0.438616246f, 0.898674488f, -0.441371262f, 0.897324562f, -0.444122136f, 0.895966232f, -0.446868837f, 0.894599497f,
+    -0.449611336f, 0.893224299f, -0.452349573f, 0.891840696f, -0.455083579f, 0.890448749f, -0.457813293f, 0.889048338f,
+    -0.460538715f, 0.887639642f, -0.463259786f, 0.886222541f, -0.465976506f, 0.884797096f, -0.468688816f, 0.883363366f,
+    -0.471396744f, 0.881921291f, -0.474100202f, 0.880470872f, -0.47679922f, 0.879012227f, -0.479493767f, 0.877545297f,
+    -0.482183784f, 0.876070082f, -0.484869242f, 0.874586642f, -0.487550169f, 0.873094976f, -0.490226477f, 0.871595085f,
+    -0.492898196f, 0.870086968f, -0.495565265f, 0.868570685f, -0.498227656f, 0.867046237f, -0.500885367f, 0.865513623f,
+    -0.50353837f, 0.863972843f, -0.506186664f, 0.862423956f, -0.50883013f, 0.860866964f, -0.511468828f, 0.859301805f,
+    -0.514102757f, 0.857728601f, -0.516731799f, 0.856147349f, -0.519356012f, 0.854557991f, -0.521975279f, 0.852960587f,
+    -0.524589658f, 0.851355195f, -0.527199149f, 0.849741757f, -0.529803634f, 0.848120332f, -0.532403111f, 0.84649092f,
+    -0.534997642f, 0.84485358f, -0.537587047f, 0.843208253f, -0.540171444f, 0.841554999f, -0.542750776f, 0.839893818f,
+    -0.545324981f, 0.838224709f, -0.547894061f, 0.836547732f, -0.550457954f, 0.834862888f, -0.553016722f, 0.833170176f,
+    -0.555570245f, 0.831469595f, -0.558118522f, 0.829761207f, -0.560661554f, 0.82804507f, -0.563199341f, 0.826321065f,
+    -0.565731823f, 0.824589312f, -0.568258941f, 0.82284981f, -0.570780754f, 0.8211025f, -0.573297143f, 0.819347501f,
+    -0.575808167f, 0.817584813f, -0.578313768f, 0.815814435f, -0.580813944f, 0.81403631f, -0.583308637f, 0.812250614f,
+    -0.585797846f, 0.81045717f, -0.588281572f, 0.808656156f, -0.590759695f, 0.806847572f, -0.593232274f, 0.805031359f,
+    -0.59569931f, 0.803207517f, -0.598160684f, 0.801376164f, -0.600616455f, 0.799537241f, -0.603066623f, 0.797690868f,
+    -0.605511069f, 0.795836926f, -0.607949793f, 0.793975472f, -0.610382795f, 0.792106569f, -0.612810075f, 0.790230215f,
+    -0.615231574f, 0.78834641f, -0.61764729f, 0.786455214f, -0.620057225f, 0.784556568f, -0.622461259f, 0.78265059f,
+    -0.624859512f, 0.780737221f, -0.627251804f, 0.778816521f, -0.629638255f, 0.77688849f, -0.632018745f, 0.774953127f,
+    -0.634393275f, 0.773010433f, -0.636761844f, 0.771060526f, -0.639124453f, 0.769103348f, -0.641481042f, 0.767138898f,
+    -0.643831551f, 0.765167236f, -0.64617604f, 0.763188422f, -0.64851439f, 0.761202395f, -0.65084666f, 0.759209216f,
+    -0.653172851f, 0.757208824f, -0.655492842f, 0.755201399f, -0.657806695f, 0.753186822f, -0.660114348f, 0.751165152f,
+    -0.662415802f, 0.749136388f, -0.664710999f, 0.747100592f, -0.666999936f, 0.745057762f, -0.669282615f, 0.743007958f,
+    -0.671558976f, 0.740951121f, -0.673829019f, 0.73888731f, -0.676092684f, 0.736816585f, -0.678350031f, 0.734738886f,
+    -0.680601001f, 0.732654274f, -0.682845533f, 0.730562747f, -0.685083687f, 0.728464365f, -0.687315345f, 0.726359129f,
+    -0.689540565f, 0.724247098f, -0.691759229f, 0.722128212f, -0.693971455f, 0.720002532f, -0.696177125f, 0.717870057f,
+    -0.698376238f, 0.715730846f, -0.700568795f, 0.71358484f, -0.702754736f, 0.711432219f, -0.704934061f, 0.709272802f,
+    -0.707106769f, 0.707106769f, -0.709272802f, 0.704934061f, -0.711432219f, 0.702754736f, -0.71358484f, 0.700568795f,
+    -0.715730846f, 0.698376238f, -0.717870057f, 0.696177125f, -0.720002532f, 0.693971455f, -0.722128212f, 0.691759229f,
+    -0.724247098f, 0.689540565f, -0.726359129f, 0.687315345f, -0.728464365f, 0.685083687f, -0.730562747f, 0.682845533f,
+    -0.732654274f, 0.680601001f, -0.734738886f, 0.678350031f, -0.736816585f, 0.676092684f, -0.73888731f, 0.673829019f,
+    -0.740951121f, 0.671558976f, -0.743007958f, 0.669282615f, -0.745057762f, 0.666999936f, -0.747100592f, 0.664710999f,
+    -0.749136388f, 0.662415802f, -0.751165152f, 0.660114348f, -0.753186822f, 0.657806695f, -0.755201399f, 0.655492842f,
+    -0.757208824f, 0.653172851f, -0.759209216f, 0.65084666f, -0.761202395f, 0.64851439f, -0.763188422f, 0.64617604f,
+    -0.765167236f, 0.643831551f, -0.767138898f, 0.641481042f, -0.769103348f, 0.639124453f, -0.771060526f, 0.636761844f,
+    -0.773010433f, 0.634393275f, -0.774953127f, 0.632018745f, -0.77688849f, 0.629638255f, -0.778816521f, 0.627251804f,
+    -0.780737221f, 0.624859512f, -0.78265059f, 0.622461259f, -0.784556568f, 0.620057225f, -0.786455214f, 0.61764729f,
+    -0.78834641f, 0.615231574f, -0.790230215f, 0.612810075f, -0.792106569f, 0.610382795f, -0.793975472f, 0.607949793f,
+    -0.795836926f, 0.605511069f, -0.797690868f, 0.603066623f, -0.799537241f, 0.600616455f, -0.801376164f, 0.598160684f,
+    -0.803207517f, 0.59569931f, -0.805031359f, 0.593232274f, -0.806847572f, 0.590759695f, -0.808656156f, 0.588281572f,
+    -0.81045717f, 0.585797846f, -0.812250614f, 0.583308637f, -0.81403631f, 0.580813944f, -0.815814435f, 0.578313768f,
+    -0.817584813f, 0.575808167f, -0.819347501f, 0.573297143f, -0.8211025f, 0.570780754f, -0.82284981f, 0.568258941f,
+    -0.824589312f, 0.565731823f, -0.826321065f, 0.563199341f, -0.82804507f, 0.560661554f, -0.829761207f, 0.558118522f,
+    -0.831469595f, 0.555570245f, -0.833170176f, 0.553016722f, -0.834862888f, 0.550457954f, -0.836547732f, 0.547894061f,
+    -0.838224709f, 0.545324981f, -0.839893818f, 0.542750776f, -0.841554999f, 0.540171444f, -0.843208253f, 0.537587047f,
+    -0.84485358f, 0.534997642f, -0.84649092f, 0.532403111f, -0.848120332f, 0.529803634f, -0.849741757f, 0.527199149f,
+    -0.851355195f, 0.524589658f, -0.852960587f, 0.521975279f, -0.854557991f, 0.519356012f, -0.856147349f, 0.516731799f,
+    -0.857728601f, 0.514102757f, -0.859301805f, 0.511468828f, -0.860866964f, 0.50883013f, -0.862423956f, 0.506186664f,
+    -0.863972843f, 0.50353837f, -0.865513623f, 0.500885367f, -0.867046237f, 0.498227656f, -0.868570685f, 0.495565265f,
+    -0.870086968f, 0.492898196f, -0.871595085f, 0.490226477f, -0.873094976f, 0.487550169f, -0.874586642f, 0.484869242f,
+    -0.876070082f, 0.482183784f, -0.877545297f, 0.479493767f, -0.879012227f, 0.47679922f, -0.880470872f, 0.474100202f,
+    -0.881921291f, 0.471396744f, -0.883363366f, 0.468688816f, -0.884797096f, 0.465976506f, -0.886222541f, 0.463259786f,
+    -0.887639642f, 0.460538715f, -0.889048338f, 0.457813293f, -0.890448749f, 0.455083579f, -0.891840696f, 0.452349573f,
+    -0.893224299f, 0.449611336f, -0.894599497f, 0.446868837f, -0.895966232f, 0.444122136f, -0.897324562f, 0.441371262f,
+    -0.898674488f, 0.438616246f, -0.900015891f, 0.435857087f, -0.901348829f, 0.433093816f, -0.902673304f, 0.430326492f,
+    -0.903989315f, 0.427555084f, -0.905296743f, 0.424779683f, -0.906595707f, 0.422000259f, -0.907886088f, 0.419216901f,
+    -0.909168005f, 0.416429549f, -0.910441279f, 0.413638324f, -0.91170603f, 0.410843164f, -0.912962198f, 0.408044159f,
+    -0.914209783f, 0.405241311f, -0.915448725f, 0.402434647f, -0.916679084f, 0.399624199f, -0.917900801f, 0.396809995f,
+    -0.919113874f, 0.393992037f, -0.920318305f, 0.391170382f, -0.921514034f, 0.388345033f, -0.92270112f, 0.385516047f,
+    -0.923879504f, 0.382683426f, -0.925049245f, 0.379847199f, -0.926210225f, 0.377007425f, -0.927362502f, 0.374164075f,
+    -0.928506076f, 0.371317208f, -0.929640889f, 0.368466824f, -0.93076694f, 0.365612984f, -0.931884289f, 0.362755716f,
+    -0.932992816f, 0.359895051f, -0.934092522f, 0.357030958f, -0.935183525f, 0.354163527f, -0.936265647f, 0.351292759f,
+    -0.937339008f, 0.348418683f, -0.938403547f, 0.345541328f, -0.939459205f, 0.342660725f, -0.940506041f, 0.339776874f,
+    -0.941544056f, 0.336889863f, -0.94257319f, 0.333999664f, -0.943593442f, 0.331106305f, -0.944604814f, 0.328209847f,
+    -0.945607305f, 0.32531029f, -0.946600914f, 0.322407693f, -0.947585583f, 0.319502026f, -0.94856137f, 0.316593379f,
+    -0.949528158f, 0.313681751f, -0.950486064f, 0.310767144f, -0.95143503f, 0.307849646f, -0.952374995f, 0.304929227f,
+    -0.953306019f, 0.302005947f, -0.954228103f, 0.299079835f, -0.955141187f, 0.296150893f, -0.95604527f, 0.293219149f,
+    -0.956940353f, 0.290284663f, -0.957826436f, 0.287347466f, -0.958703458f, 0.284407526f, -0.95957154f, 0.281464934f,
+    -0.960430503f, 0.27851969f, -0.961280465f, 0.275571823f, -0.962121427f, 0.272621363f, -0.962953269f, 0.269668311f,
+    -0.963776052f, 0.266712755f, -0.964589775f, 0.263754666f, -0.965394437f, 0.260794103f, -0.966189981f, 0.257831097f,
+    -0.966976464f, 0.254865646f, -0.967753828f, 0.251897812f, -0.968522072f, 0.248927608f, -0.969281256f, 0.24595505f,
+    -0.970031261f, 0.242980182f, -0.970772147f, 0.24000302f, -0.971503913f, 0.237023607f, -0.972226501f, 0.234041959f,
+    -0.972939968f, 0.231058106f, -0.973644257f, 0.228072077f, -0.974339366f, 0.225083917f, -0.975025356f, 0.222093627f,
+    -0.975702107f, 0.219101235f, -0.976369739f, 0.216106802f, -0.977028131f, 0.213110313f, -0.977677345f, 0.210111842f,
+    -0.97831738f, 0.207111374f, -0.978948176f, 0.204108968f, -0.979569793f, 0.201104641f, -0.980182111f, 0.198098406f,
+    -0.980785251f, 0.195090324f, -0.981379211f, 0.192080393f, -0.981963873f, 0.18906866f, -0.982539296f, 0.186055154f,
+    -0.983105481f, 0.183039889f, -0.983662426f, 0.180022895f, -0.984210074f, 0.177004218f, -0.984748483f, 0.173983872f,
+    -0.985277653f, 0.170961887f, -0.985797524f, 0.167938292f, -0.986308098f, 0.164913118f, -0.986809373f, 0.161886394f,
+    -0.987301409f, 0.15885815f, -0.987784147f, 0.155828401f, -0.988257587f, 0.152797192f, -0.988721669f, 0.149764538f,
+    -0.989176512f, 0.146730468f, -0.989621997f, 0.143695027f, -0.990058184f, 0.140658244f, -0.990485072f, 0.137620121f,
+    -0.990902662f, 0.134580702f, -0.991310835f, 0.13154003f, -0.991709769f, 0.128498107f, -0.992099285f, 0.125454977f,
+    -0.992479563f, 0.122410677f, -0.992850423f, 0.119365215f, -0.993211925f, 0.116318628f, -0.993564129f, 0.113270953f,
+    -0.993906975f, 0.110222206f, -0.994240463f, 0.107172422f, -0.994564593f, 0.104121633f, -0.994879305f, 0.10106986f,
+    -0.99518472f, 0.0980171412f, -0.995480776f, 0.0949634984f, -0.995767415f, 0.0919089541f, -0.996044695f, 0.0888535529f,
+    -0.996312618f, 0.0857973099f, -0.996571124f, 0.0827402622f, -0.996820271f, 0.0796824396f, -0.997060061f, 0.0766238645f,
+    -0.997290432f, 0.0735645667f, -0.997511446f, 0.070504576f, -0.997723043f, 0.0674439222f, -0.997925282f, 0.0643826276f,
+    -0.998118103f, 0.061320737f, -0.998301566f, 0.0582582653f, -0.998475552f, 0.0551952459f, -0.998640239f, 0.052131705f,
+    -0.99879545f, 0.0490676761f, -0.998941302f, 0.0460031815f, -0.999077737f, 0.0429382585f, -0.999204755f, 0.0398729257f,
+    -0.999322355f, 0.0368072242f, -0.999430597f, 0.0337411724f, -0.999529421f, 0.030674804f, -0.999618828f, 0.027608145f,
+    -0.999698818f, 0.024541229f, -0.99976939f, 0.0214740802f, -0.999830604f, 0.0184067301f, -0.99988234f, 0.015339206f,
+    -0.999924719f, 0.0122715384f, -0.999957621f, 0.00920375437f, -0.999981165f, 0.00613588467f, -0.999995291f, 0.00306795677f,
+    -1.0f, 1.22464685e-16f, -0.999995291f, -0.00306795677f, -0.999981165f, -0.00613588467f, -0.999957621f, -0.00920375437f,
+    -0.999924719f, -0.0122715384f, -0.99988234f, -0.015339206f, -0.999830604f, -0.0184067301f, -0.99976939f, -0.0214740802f,
+    -0.999698818f, -0.024541229f, -0.999618828f, -0.027608145f, -0.999529421f, -0.030674804f, -0.999430597f, -0.0337411724f,
+    -0.999322355f, -0.0368072242f, -0.999204755f, -0.0398729257f, -0.999077737f, -0.0429382585f, -0.998941302f, -0.0460031815f,
+    -0.99879545f, -0.0490676761f, -0.998640239f, -0.052131705f, -0.998475552f, -0.0551952459f, -0.998301566f, -0.0582582653f,
+    -0.998118103f, -0.061320737f, -0.997925282f, -0.0643826276f, -0.997723043f, -0.0674439222f, -0.997511446f, -0.070504576f,
+    -0.997290432f, -0.0735645667f, -0.997060061f, -0.0766238645f, -0.996820271f, -0.0796824396f, -0.996571124f, -0.0827402622f,
+    -0.996312618f, -0.0857973099f, -0.996044695f, -0.0888535529f, -0.995767415f, -0.0919089541f, -0.995480776f, -0.0949634984f,
+    -0.99518472f, -0.0980171412f, -0.994879305f, -0.10106986f, -0.994564593f, -0.104121633f, -0.994240463f, -0.107172422f,
+    -0.993906975f, -0.110222206f, -0.993564129f, -0.113270953f, -0.993211925f, -0.116318628f, -0.992850423f, -0.119365215f,
+    -0.992479563f, -0.122410677f, -0.992099285f, -0.125454977f, -0.991709769f, -0.128498107f, -0.991310835f, -0.13154003f,
+    -0.990902662f, -0.134580702f, -0.990485072f, -0.137620121f, -0.990058184f, -0.140658244f, -0.989621997f, -0.143695027f,
+    -0.989176512f, -0.146730468f, -0.988721669f, -0.149764538f, -0.988257587f, -0.152797192f, -0.987784147f, -0.155828401f,
+    -0.987301409f, -0.15885815f, -0.986809373f, -0.161886394f, -0.986308098f, -0.164913118f, -0.985797524f, -0.167938292f,
+    -0.985277653f, -0.170961887f, -0.984748483f, -0.173983872f, -0.984210074f, -0.177004218f, -0.983662426f, -0.180022895f,
+    -0.983105481f, -0.183039889f, -0.982539296f, -0.186055154f, -0.981963873f, -0.18906866f, -0.981379211f, -0.192080393f,
+    -0.980785251f, -0.195090324f, -0.980182111f, -0.198098406f, -0.979569793f, -0.201104641f, -0.978948176f, -0.204108968f,
+    -0.97831738f, -0.207111374f, -0.977677345f, -0.210111842f, -0.977028131f, -0.213110313f, -0.976369739f, -0.216106802f,
+    -0.975702107f, -0.219101235f, -0.975025356f, -0.222093627f, -0.974339366f, -0.225083917f, -0.973644257f, -0.228072077f,
+    -0.972939968f, -0.231058106f, -0.972226501f, -0.234041959f, -0.971503913f, -0.237023607f, -0.970772147f, -0.24000302f,
+    -0.970031261f, -0.242980182f, -0.969281256f, -0.24595505f, -0.968522072f, -0.248927608f, -0.967753828f, -0.251897812f,
+    -0.966976464f, -0.254865646f, -0.966189981f, -0.257831097f, -0.965394437f, -0.260794103f, -0.964589775f, -0.263754666f,
+    -0.963776052f, -0.266712755f, -0.962953269f, -0.269668311f, -0.962121427f, -0.272621363f, -0.961280465f, -0.275571823f,
+    -0.960430503f, -0.27851969f, -0.95957154f, -0.281464934f, -0.958703458f, -0.284407526f, -0.957826436f, -0.287347466f,
+    -0.956940353f, -0.290284663f, -0.95604527f, -0.293219149f, -0.955141187f, -0.296150893f, -0.954228103f, -0.299079835f,
+    -0.953306019f, -0.302005947f, -0.952374995f, -0.304929227f, -0.95143503f, -0.307849646f, -0.950486064f, -0.310767144f,
+    -0.949528158f, -0.313681751f, -0.94856137f, -0.316593379f, -0.947585583f, -0.319502026f, -0.946600914f, -0.322407693f,
+    -0.945607305f, -0.32531029f, -0.944604814f, -0.328209847f, -0.943593442f, -0.331106305f, -0.94257319f, -0.333999664f,
+    -0.941544056f, -0.336889863f, -0.940506041f, -0.339776874f, -0.939459205f, -0.342660725f, -0.938403547f, -0.345541328f,
+    -0.937339008f, -0.348418683f, -0.936265647f, -0.351292759f, -0.935183525f, -0.354163527f, -0.934092522f, -0.357030958f,
+    -0.932992816f, -0.359895051f, -0.931884289f, -0.362755716f, -0.93076694f, -0.365612984f, -0.929640889f, -0.368466824f,
+    -0.928506076f, -0.371317208f, -0.927362502f, -0.374164075f, -0.926210225f, -0.377007425f, -0.925049245f, -0.379847199f,
+    -0.923879504f, -0.382683426f, -0.92270112f, -0.385516047f, -0.921514034f, -0.388345033f, -0.920318305f, -0.391170382f,
+    -0.919113874f, -0.393992037f, -0.917900801f, -0.396809995f, -0.916679084f, -0.399624199f, -0.915448725f, -0.402434647f,
+    -0.914209783f, -0.405241311f, -0.912962198f, -0.408044159f, -0.91170603f, -0.410843164f, -0.910441279f, -0.413638324f,
+    -0.909168005f, -0.416429549f, -0.907886088f, -0.419216901f, -0.906595707f, -0.422000259f, -0.905296743f, -0.424779683f,
+    -0.903989315f, -0.427555084f, -0.902673304f, -0.430326492f, -0.901348829f, -0.433093816f, -0.900015891f, -0.435857087f,
+    -0.898674488f, -0.438616246f, -0.897324562f, -0.441371262f, -0.895966232f, -0.444122136f, -0.894599497f, -0.446868837f,
+    -0.893224299f, -0.449611336f, -0.891840696f, -0.452349573f, -0.890448749f, -0.455083579f, -0.889048338f, -0.457813293f,
+    -0.887639642f, -0.460538715f, -0.886222541f, -0.463259786f, -0.884797096f, -0.465976506f, -0.883363366f, -0.468688816f,
+    -0.881921291f, -0.471396744f, -0.880470872f, -0.474100202f, -0.879012227f, -0.47679922f, -0.877545297f, -0.479493767f,
+    -0.876070082f, -0.482183784f, -0.874586642f, -0.484869242f, -0.873094976f, -0.487550169f, -0.871595085f, -0.490226477f,
+    -0.870086968f, -0.492898196f, -0.868570685f, -0.495565265f, -0.867046237f, -0.498227656f, -0.865513623f, -0.500885367f,
+    -0.863972843f, -0.50353837f, -0.862423956f, -0.506186664f, -0.860866964f, -0.50883013f, -0.859301805f, -0.511468828f,
+    -0.857728601f, -0.514102757f, -0.856147349f, -0.516731799f, -0.854557991f, -0.519356012f, -0.852960587f, -0.521975279f,
+    -0.851355195f, -0.524589658f, -0.849741757f, -0.527199149f, -0.848120332f, -0.529803634f, -0.84649092f, -0.532403111f,
+    -0.84485358f, -0.534997642f, -0.843208253f, -0.537587047f, -0.841554999f, -0.540171444f, -0.839893818f, -0.542750776f,
+    -0.838224709f, -0.545324981f, -0.836547732f, -0.547894061f, -0.834862888f, -0.550457954f, -0.833170176f, -0.553016722f,
+    -0.831469595f, -0.555570245f, -0.829761207f, -0.558118522f, -0.82804507f, -0.560661554f, -0.826321065f, -0.563199341f,
+    -0.824589312f, -0.565731823f, -0.82284981f, -0.568258941f, -0.8211025f, -0.570780754f, -0.819347501f, -0.573297143f,
+    -0.817584813f, -0.575808167f, -0.815814435f, -0.578313768f, -0.81403631f, -0.580813944f, -0.812250614f, -0.583308637f,
+    -0.81045717f, -0.585797846f, -0.808656156f, -0.588281572f, -0.806847572f, -0.590759695f, -0.805031359f, -0.593232274f,
+    -0.803207517f, -0.59569931f, -0.801376164f, -0.598160684f, -0.799537241f, -0.600616455f, -0.797690868f, -0.603066623f,
+    -0.795836926f, -0.605511069f, -0.793975472f, -0.607949793f, -0.792106569f, -0.610382795f, -0.790230215f, -0.612810075f,
+    -0.78834641f, -0.615231574f, -0.786455214f, -0.61764729f, -0.784556568f, -0.620057225f, -0.78265059f, -0.622461259f,
+    -0.780737221f, -0.624859512f, -0.778816521f, -0.627251804f, -0.77688849f, -0.629638255f, -0.774953127f, -0.632018745f,
+    -0.773010433f, -0.634393275f, -0.771060526f, -0.636761844f, -0.769103348f, -0.639124453f, -0.767138898f, -0.641481042f,
+    -0.765167236f, -0.643831551f, -0.763188422f, -0.64617604f, -0.761202395f, -0.64851439f, -0.759209216f, -0.65084666f,
+    -0.757208824f, -0.653172851f, -0.755201399f, -0.655492842f, -0.753186822f, -0.657806695f, -0.751165152f, -0.660114348f,
+    -0.749136388f, -0.662415802f, -0.747100592f, -0.664710999f, -0.745057762f, -0.666999936f, -0.743007958f, -0.669282615f,
+    -0.740951121f, -0.671558976f, -0.73888731f, -0.673829019f, -0.736816585f, -0.676092684f, -0.734738886f, -0.678350031f,
+    -0.732654274f, -0.680601001f, -0.730562747f, -0.682845533f, -0.728464365f, -0.685083687f, -0.726359129f, -0.687315345f,
+    -0.724247098f, -0.689540565f, -0.722128212f, -0.691759229f, -0.720002532f, -0.693971455f, -0.717870057f, -0.696177125f,
+    -0.715730846f, -0.698376238f, -0.71358484f, -0.700568795f, -0.711432219f, -0.702754736f, -0.709272802f, -0.704934061f,
+    -0.707106769f, -0.707106769f, -0.704934061f, -0.709272802f, -0.702754736f, -0.711432219f, -0.700568795f, -0.71358484f,
+    -0.698376238f, -0.715730846f, -0.696177125f, -0.717870057f, -0.693971455f, -0.720002532f, -0.691759229f, -0.722128212f,
+    -0.689540565f, -0.724247098f, -0.687315345f, -0.726359129f, -0.685083687f, -0.728464365f, -0.682845533f, -0.730562747f,
+    -0.680601001f, -0.732654274f, -0.678350031f, -0.734738886f, -0.676092684f, -0.736816585f, -0.673829019f, -0.73888731f,
+    -0.671558976f, -0.740951121f, -0.669282615f, -0.743007958f, -0.666999936f, -0.745057762f, -0.664710999f, -0.747100592f,
+    -0.662415802f, -0.749136388f, -0.660114348f, -0.751165152f, -0.657806695f, -0.753186822f, -0.655492842f, -0.755201399f,
+    -0.653172851f, -0.757208824f, -0.65084666f, -0.759209216f, -0.64851439f, -0.761202395f, -0.64617604f, -0.763188422f,
+    -0.643831551f, -0.765167236f, -0.641481042f, -0.767138898f, -0.639124453f, -0.769103348f, -0.636761844f, -0.771060526f,
+    -0.634393275f, -0.773010433f, -0.632018745f, -0.774953127f, -0.629638255f, -0.77688849f, -0.627251804f, -0.778816521f,
+    -0.624859512f, -0.780737221f, -0.622461259f, -0.78265059f, -0.620057225f, -0.784556568f, -0.61764729f, -0.786455214f,
+    -0.615231574f, -0.78834641f, -0.612810075f, -0.790230215f, -0.610382795f, -0.792106569f, -0.607949793f, -0.793975472f,
+    -0.605511069f, -0.795836926f, -0.603066623f, -0.797690868f, -0.600616455f, -0.799537241f, -0.598160684f, -0.801376164f,
+    -0.59569931f, -0.803207517f, -0.593232274f, -0.805031359f, -0.590759695f, -0.806847572f, -0.588281572f, -0.808656156f,
+    -0.585797846f, -0.81045717f, -0.583308637f, -0.812250614f, -0.580813944f, -0.81403631f, -0.578313768f, -0.815814435f,
+    -0.575808167f, -0.817584813f, -0.573297143f, -0.819347501f, -0.570780754f, -0.8211025f, -0.568258941f, -0.82284981f,
+    -0.565731823f, -0.824589312f, -0.563199341f, -0.826321065f, -0.560661554f, -0.82804507f, -0.558118522f, -0.829761207f,
+    -0.555570245f, -0.831469595f, -0.553016722f, -0.833170176f, -0.550457954f, -0.834862888f, -0.547894061f, -0.836547732f,
+    -0.545324981f, -0.838224709f, -0.542750776f, -0.839893818f, -0.540171444f, -0.841554999f, -0.537587047f, -0.843208253f,
+    -0.534997642f, -0.84485358f, -0.532403111f, -0.84649092f, -0.529803634f, -0.848120332f, -0.527199149f, -0.849741757f,
+    -0.524589658f, -0.851355195f, -0.521975279f, -0.852960587f, -0.519356012f, -0.854557991f, -0.516731799f, -0.856147349f,
+    -0.514102757f, -0.857728601f, -0.511468828f, -0.859301805f, -0.50883013f, -0.860866964f, -0.506186664f, -0.862423956f,
+    -0.50353837f, -0.863972843f, -0.500885367f, -0.865513623f, -0.498227656f, -0.867046237f, -0.495565265f, -0.868570685f,
+    -0.492898196f, -0.870086968f, -0.490226477f, -0.871595085f, -0.487550169f, -0.873094976f, -0.484869242f, -0.874586642f,
+    -0.482183784f, -0.876070082f, -0.479493767f, -0.877545297f, -0.47679922f, -0.879012227f, -0.474100202f, -0.880470872f,
+    -0.471396744f, -0.881921291f, -0.468688816f, -0.883363366f, -0.465976506f, -0.884797096f, -0.463259786f, -0.886222541f,
+    -0.460538715f, -0.887639642f, -0.457813293f, -0.889048338f, -0.455083579f, -0.890448749f, -0.452349573f, -0.891840696f,
+    -0.449611336f, -0.893224299f, -0.446868837f, -0.894599497f, -0.444122136f, -0.895966232f, -0.441371262f, -0.897324562f,
+    -0.438616246f, -0.898674488f, -0.435857087f, -0.900015891f, -0.433093816f, -0.901348829f, -0.430326492f, -0.902673304f,
+    -0.427555084f, -0.903989315f, -0.424779683f, -0.905296743f, -0.422000259f, -0.906595707f, -0.419216901f, -0.907886088f,
+    -0.416429549f, -0.909168005f, -0.413638324f, -0.910441279f, -0.410843164f, -0.91170603f, -0.408044159f, -0.912962198f,
+    -0.405241311f, -0.914209783f, -0.402434647f, -0.915448725f, -0.399624199f, -0.916679084f, -0.396809995f, -0.917900801f,
+    -0.393992037f, -0.919113874f, -0.391170382f, -0.920318305f, -0.388345033f, -0.921514034f, -0.385516047f, -0.92270112f,
+    -0.382683426f, -0.923879504f, -0.379847199f, -0.925049245f, -0.377007425f, -0.926210225f, -0.374164075f, -0.927362502f,
+    -0.371317208f, -0.928506076f, -0.368466824f, -0.929640889f, -0.365612984f, -0.93076694f, -0.362755716f, -0.931884289f,
+    -0.359895051f, -0.932992816f, -0.357030958f, -0.934092522f, -0.354163527f, -0.935183525f, -0.351292759f, -0.936265647f,
+    -0.348418683f, -0.937339008f, -0.345541328f, -0.938403547f, -0.342660725f, -0.939459205f, -0.339776874f, -0.940506041f,
+    -0.336889863f, -0.941544056f, -0.333999664f, -0.94257319f, -0.331106305f, -0.943593442f, -0.328209847f, -0.944604814f,
+    -0.32531029f, -0.945607305f, -0.322407693f, -0.946600914f, -0.319502026f, -0.947585583f, -0.316593379f, -0.94856137f,
+    -0.313681751f, -0.949528158f, -0.310767144f, -0.950486064f, -0.307849646f, -0.95143503f, -0.304929227f, -0.952374995f,
+    -0.302005947f, -0.953306019f, -0.299079835f, -0.954228103f, -0.296150893f, -0.955141187f, -0.293219149f, -0.95604527f,
+    -0.290284663f, -0.956940353f, -0.287347466f, -0.957826436f, -0.284407526f, -0.958703458f, -0.281464934f, -0.95957154f,
+    -0.27851969f, -0.960430503f, -0.275571823f, -0.961280465f, -0.272621363f, -0.962121427f, -0.269668311f, -0.962953269f,
+    -0.266712755f, -0.963776052f, -0.263754666f, -0.964589775f, -0.260794103f, -0.965394437f, -0.257831097f, -0.966189981f,
+    -0.254865646f, -0.966976464f, -0.251897812f, -0.967753828f, -0.248927608f, -0.968522072f, -0.24595505f, -0.969281256f,
+    -0.242980182f, -0.970031261f, -0.24000302f, -0.970772147f, -0.237023607f, -0.971503913f, -0.234041959f, -0.972226501f,
+    -0.231058106f, -0.972939968f, -0.228072077f, -0.973644257f, -0.225083917f, -0.974339366f, -0.222093627f, -0.975025356f,
+    -0.219101235f, -0.975702107f, -0.216106802f, -0.976369739f, -0.213110313f, -0.977028131f, -0.210111842f, -0.977677345f,
+    -0.207111374f, -0.97831738f, -0.204108968f, -0.978948176f, -0.201104641f, -0.979569793f, -0.198098406f, -0.980182111f,
+    -0.195090324f, -0.980785251f, -0.192080393f, -0.981379211f, -0.18906866f, -0.981963873f, -0.186055154f, -0.982539296f,
+    -0.183039889f, -0.983105481f, -0.180022895f, -0.983662426f, -0.177004218f, -0.984210074f, -0.173983872f, -0.984748483f,
+    -0.170961887f, -0.985277653f, -0.167938292f, -0.985797524f, -0.164913118f, -0.986308098f, -0.161886394f, -0.986809373f,
+    -0.15885815f, -0.987301409f, -0.155828401f, -0.987784147f, -0.152797192f, -0.988257587f, -0.149764538f, -0.988721669f,
+    -0.146730468f, -0.989176512f, -0.143695027f, -0.989621997f, -0.140658244f, -0.990058184f, -0.137620121f, -0.990485072f,
+    -0.134580702f, -0.990902662f, -0.13154003f, -0.991310835f, -0.128498107f, -0.991709769f, -0.125454977f, -0.992099285f,
+    -0.122410677f, -0.992479563f, -0.119365215f, -0.992850423f, -0.116318628f, -0.993211925f, -0.113270953f, -0.993564129f,
+    -0.110222206f, -0.993906975f, -0.107172422f, -0.994240463f, -0.104121633f, -0.994564593f, -0.10106986f, -0.994879305f,
+    -0.0980171412f, -0.99518472f, -0.0949634984f, -0.995480776f, -0.0919089541f, -0.995767415f, -0.0888535529f, -0.996044695f,
+    -0.0857973099f, -0.996312618f, -0.0827402622f, -0.996571124f, -0.0796824396f, -0.996820271f, -0.0766238645f, -0.997060061f,
+    -0.0735645667f, -0.997290432f, -0.070504576f, -0.997511446f, -0.0674439222f, -0.997723043f, -0.0643826276f, -0.997925282f,
+    -0.061320737f, -0.998118103f, -0.0582582653f, -0.998301566f, -0.0551952459f, -0.998475552f, -0.052131705f, -0.998640239f,
+    -0.0490676761f, -0.99879545f, -0.0460031815f, -0.998941302f, -0.0429382585f, -0.999077737f, -0.0398729257f, -0.999204755f,
+    -0.0368072242f, -0.999322355f, -0.0337411724f, -0.999430597f, -0.030674804f, -0.999529421f, -0.027608145f, -0.999618828f,
+    -0.024541229f, -0.999698818f, -0.0214740802f, -0.99976939f, -0.0184067301f, -0.999830604f, -0.015339206f, -0.99988234f,
+    -0.0122715384f, -0.999924719f, -0.00920375437f, -0.999957621f, -0.00613588467f, -0.999981165f, -0.00306795677f, -0.999995291f,
+    -1.83697015e-16f, -1.0f, 0.00306795677f, -0.999995291f, 0.00613588467f, -0.999981165f, 0.00920375437f, -0.999957621f,
+    0.0122715384f, -0.999924719f, 0.015339206f, -0.99988234f, 0.0184067301f, -0.999830604f, 0.0214740802f, -0.99976939f,
+    0.024541229f, -0.999698818f, 0.027608145f, -0.999618828f, 0.030674804f, -0.999529421f, 0.0337411724f, -0.999430597f,
+    0.0368072242f, -0.999322355f, 0.0398729257f, -0.999204755f, 0.0429382585f, -0.999077737f, 0.0460031815f, -0.998941302f,
+    0.0490676761f, -0.99879545f, 0.052131705f, -0.998640239f, 0.0551952459f, -0.998475552f, 0.0582582653f, -0.998301566f,
+    0.061320737f, -0.998118103f, 0.0643826276f, -0.997925282f, 0.0674439222f, -0.997723043f, 0.070504576f, -0.997511446f,
+    0.0735645667f, -0.997290432f, 0.0766238645f, -0.997060061f, 0.0796824396f, -0.996820271f, 0.0827402622f, -0.996571124f,
+    0.0857973099f, -0.996312618f, 0.0888535529f, -0.996044695f, 0.0919089541f, -0.995767415f, 0.0949634984f, -0.995480776f,
+    0.0980171412f, -0.99518472f, 0.10106986f, -0.994879305f, 0.104121633f, -0.994564593f, 0.107172422f, -0.994240463f,
+    0.110222206f, -0.993906975f, 0.113270953f, -0.993564129f, 0.116318628f, -0.993211925f, 0.119365215f, -0.992850423f,
+    0.122410677f, -0.992479563f, 0.125454977f, -0.992099285f, 0.128498107f, -0.991709769f, 0.13154003f, -0.991310835f,
+    0.134580702f, -0.990902662f, 0.137620121f, -0.990485072f, 0.140658244f, -0.990058184f, 0.143695027f, -0.989621997f,
+    0.146730468f, -0.989176512f, 0.149764538f, -0.988721669f, 0.152797192f, -0.988257587f, 0.155828401f, -0.987784147f,
+    0.15885815f, -0.987301409f, 0.161886394f, -0.986809373f, 0.164913118f, -0.986308098f, 0.167938292f, -0.985797524f,
+    0.170961887f, -0.985277653f, 0.173983872f, -0.984748483f, 0.177004218f, -0.984210074f, 0.180022895f, -0.983662426f,
+    0.183039889f, -0.983105481f, 0.186055154f, -0.982539296f, 0.18906866f, -0.981963873f, 0.192080393f, -0.981379211f,
+    0.195090324f, -0.980785251f, 0.198098406f, -0.980182111f, 0.201104641f, -0.979569793f, 0.204108968f, -0.978948176f,
+    0.207111374f, -0.97831738f, 0.210111842f, -0.977677345f, 0.213110313f, -0.977028131f, 0.216106802f, -0.976369739f,
+    0.219101235f, -0.975702107f, 0.222093627f, -0.975025356f, 0.225083917f, -0.974339366f, 0.228072077f, -0.973644257f,
+    0.231058106f, -0.972939968f, 0.234041959f, -0.972226501f, 0.237023607f, -0.971503913f, 0.24000302f, -0.970772147f,
+    0.242980182f, -0.970031261f, 0.24595505f, -0.969281256f, 0.248927608f, -0.968522072f, 0.251897812f, -0.967753828f,
+    0.254865646f, -0.966976464f, 0.257831097f, -0.966189981f, 0.260794103f, -0.965394437f, 0.263754666f, -0.964589775f,
+    0.266712755f, -0.963776052f, 0.269668311f, -0.962953269f, 0.272621363f, -0.962121427f, 0.275571823f, -0.961280465f,
+    0.27851969f, -0.960430503f, 0.281464934f, -0.95957154f, 0.284407526f, -0.958703458f, 0.287347466f, -0.957826436f,
+    0.290284663f, -0.956940353f, 0.293219149f, -0.95604527f, 0.296150893f, -0.955141187f, 0.299079835f, -0.954228103f,
+    0.302005947f, -0.953306019f, 0.304929227f, -0.952374995f, 0.307849646f, -0.95143503f, 0.310767144f, -0.950486064f,
+    0.313681751f, -0.949528158f, 0.316593379f, -0.94856137f, 0.319502026f, -0.947585583f, 0.322407693f, -0.946600914f,
+    0.32531029f, -0.945607305f, 0.328209847f, -0.944604814f, 0.331106305f, -0.943593442f, 0.333999664f, -0.94257319f,
+    0.336889863f, -0.941544056f, 0.339776874f, -0.940506041f, 0.342660725f, -0.939459205f, 0.345541328f, -0.938403547f,
+    0.348418683f, -0.937339008f, 0.351292759f, -0.936265647f, 0.354163527f, -0.935183525f, 0.357030958f, -0.934092522f,
+    0.359895051f, -0.932992816f, 0.362755716f, -0.931884289f, 0.365612984f, -0.93076694f, 0.368466824f, -0.929640889f,
+    0.371317208f, -0.928506076f, 0.374164075f, -0.927362502f, 0.377007425f, -0.926210225f, 0.379847199f, -0.925049245f,
+    0.382683426f, -0.923879504f, 0.385516047f, -0.92270112f, 0.388345033f, -0.921514034f, 0.391170382f, -0.920318305f,
+    0.393992037f, -0.919113874f, 0.396809995f, -0.917900801f, 0.399624199f, -0.916679084f, 0.402434647f, -0.915448725f,
+    0.405241311f, -0.914209783f, 0.408044159f, -0.912962198f, 0.410843164f, -0.91170603f, 0.413638324f, -0.910441279f,
+    0.416429549f, -0.909168005f, 0.419216901f, -0.907886088f, 0.422000259f, -0.906595707f, 0.424779683f, -0.905296743f,
+    0.427555084f, -0.903989315f, 0.430326492f, -0.902673304f, 0.433093816f, -0.901348829f, 0.435857087f, -0.900015891f,
+    0.438616246f, -0.898674488f, 0.441371262f, -0.897324562f, 0.444122136f, -0.895966232f, 0.446868837f, -0.894599497f,
+    0.449611336f, -0.893224299f, 0.452349573f, -0.891840696f, 0.455083579f, -0.890448749f, 0.457813293f, -0.889048338f,
+    0.460538715f, -0.887639642f, 0.463259786f, -0.886222541f, 0.465976506f, -0.884797096f, 0.468688816f, -0.883363366f,
+    0.471396744f, -0.881921291f, 0.474100202f, -0.880470872f, 0.47679922f, -0.879012227f, 0.479493767f, -0.877545297f,
+    0.482183784f, -0.876070082f, 0.484869242f, -0.874586642f, 0.487550169f, -0.873094976f, 0.490226477f, -0.871595085f,
+    0.492898196f, -0.870086968f, 0.495565265f, -0.868570685f, 0.498227656f, -0.867046237f, 0.500885367f, -0.865513623f,
+    0.50353837f, -0.863972843f, 0.506186664f, -0.862423956f, 0.50883013f, -0.860866964f, 0.511468828f, -0.859301805f,
+    0.514102757f, -0.857728601f, 0.516731799f, -0.856147349f, 0.519356012f, -0.854557991f, 0.521975279f, -0.852960587f,
+    0.524589658f, -0.851355195f, 0.527199149f, -0.849741757f, 0.529803634f, -0.848120332f, 0.532403111f, -0.84649092f,
+    0.534997642f, -0.84485358f, 0.537587047f, -0.843208253f, 0.540171444f, -0.841554999f, 0.542750776f, -0.839893818f,
+    0.545324981f, -0.838224709f, 0.547894061f, -0.836547732f, 0.550457954f, -0.834862888f, 0.553016722f, -0.833170176f,
+    0.555570245f, -0.831469595f, 0.558118522f, -0.829761207f, 0.560661554f, -0.82804507f, 0.563199341f, -0.826321065f,
+    0.565731823f, -0.824589312f, 0.568258941f, -0.82284981f, 0.570780754f, -0.8211025f, 0.573297143f, -0.819347501f,
+    0.575808167f, -0.817584813f, 0.578313768f, -0.815814435f, 0.580813944f, -0.81403631f, 0.583308637f, -0.812250614f,
+    0.585797846f, -0.81045717f, 0.588281572f, -0.808656156f, 0.590759695f, -0.806847572f, 0.593232274f, -0.805031359f,
+    0.59569931f, -0.803207517f, 0.598160684f, -0.801376164f, 0.600616455f, -0.799537241f, 0.603066623f, -0.797690868f,
+    0.605511069f, -0.795836926f, 0.607949793f, -0.793975472f, 0.610382795f, -0.792106569f, 0.612810075f, -0.790230215f,
+    0.615231574f, -0.78834641f, 0.61764729f, -0.786455214f, 0.620057225f, -0.784556568f, 0.622461259f, -0.78265059f,
+    0.624859512f, -0.780737221f, 0.627251804f, -0.778816521f, 0.629638255f, -0.77688849f, 0.632018745f, -0.774953127f,
+    0.634393275f, -0.773010433f, 0.636761844f, -0.771060526f, 0.639124453f, -0.769103348f, 0.641481042f, -0.767138898f,
+    0.643831551f, -0.765167236f, 0.64617604f, -0.763188422f, 0.64851439f, -0.761202395f, 0.65084666f, -0.759209216f,
+    0.653172851f, -0.757208824f, 0.655492842f, -0.755201399f, 0.657806695f, -0.753186822f, 0.660114348f, -0.751165152f,
+    0.662415802f, -0.749136388f, 0.664710999f, -0.747100592f, 0.666999936f, -0.745057762f, 0.669282615f, -0.743007958f,
+    0.671558976f, -0.740951121f, 0.673829019f, -0.73888731f, 0.676092684f, -0.736816585f, 0.678350031f, -0.734738886f,
+    0.680601001f, -0.732654274f, 0.682845533f, -0.730562747f, 0.685083687f, -0.728464365f, 0.687315345f, -0.726359129f,
+    0.689540565f, -0.724247098f, 0.691759229f, -0.722128212f, 0.693971455f, -0.720002532f, 0.696177125f, -0.717870057f,
+    0.698376238f, -0.715730846f, 0.700568795f, -0.71358484f, 0.702754736f, -0.711432219f, 0.704934061f, -0.709272802f,
+    0.707106769f, -0.707106769f, 0.709272802f, -0.704934061f, 0.711432219f, -0.702754736f, 0.71358484f, -0.700568795f,
+    0.715730846f, -0.698376238f, 0.717870057f, -0.696177125f, 0.720002532f, -0.693971455f, 0.722128212f, -0.691759229f,
+    0.724247098f, -0.689540565f, 0.726359129f, -0.687315345f, 0.728464365f, -0.685083687f, 0.730562747f, -0.682845533f,
+    0.732654274f, -0.680601001f, 0.734738886f, -0.678350031f, 0.736816585f, -0.676092684f, 0.73888731f, -0.673829019f,
+    0.740951121f, -0.671558976f, 0.743007958f, -0.669282615f, 0.745057762f, -0.666999936f, 0.747100592f, -0.664710999f,
+    0.749136388f, -0.662415802f, 0.751165152f, -0.660114348f, 0.753186822f, -0.657806695f, 0.755201399f, -0.655492842f,
+    0.757208824f, -0.653172851f, 0.759209216f, -0.65084666f, 0.761202395f, -0.64851439f, 0.763188422f, -0.64617604f,
+    0.765167236f, -0.643831551f, 0.767138898f, -0.641481042f, 0.769103348f, -0.639124453f, 0.771060526f, -0.636761844f,
+    0.773010433f, -0.634393275f, 0.774953127f, -0.632018745f, 0.77688849f, -0.629638255f, 0.778816521f, -0.627251804f,
+    0.780737221f, -0.624859512f, 0.78265059f, -0.622461259f, 0.784556568f, -0.620057225f, 0.786455214f, -0.61764729f,
+    0.78834641f, -0.615231574f, 0.790230215f, -0.612810075f, 0.792106569f, -0.610382795f, 0.793975472f, -0.607949793f,
+    0.795836926f, -0.605511069f, 0.797690868f, -0.603066623f, 0.799537241f, -0.600616455f, 0.801376164f, -0.598160684f,
+    0.803207517f, -0.59569931f, 0.805031359f, -0.593232274f, 0.806847572f, -0.590759695f, 0.808656156f, -0.588281572f,
+    0.81045717f, -0.585797846f, 0.812250614f, -0.583308637f, 0.81403631f, -0.580813944f, 0.815814435f, -0.578313768f,
+    0.817584813f, -0.575808167f, 0.819347501f, -0.573297143f, 0.8211025f, -0.570780754f, 0.82284981f, -0.568258941f,
+    0.824589312f, -0.565731823f, 0.826321065f, -0.563199341f, 0.82804507f, -0.560661554f, 0.829761207f, -0.558118522f,
+    0.831469595f, -0.555570245f, 0.833170176f, -0.553016722f, 0.834862888f, -0.550457954f, 0.836547732f, -0.547894061f,
+    0.838224709f, -0.545324981f, 0.839893818f, -0.542750776f, 0.841554999f, -0.540171444f, 0.843208253f, -0.537587047f,
+    0.84485358f, -0.534997642f, 0.84649092f, -0.532403111f, 0.848120332f, -0.529803634f, 0.849741757f, -0.527199149f,
+    0.851355195f, -0.524589658f, 0.852960587f, -0.521975279f, 0.854557991f, -0.519356012f, 0.856147349f, -0.516731799f,
+    0.857728601f, -0.514102757f, 0.859301805f, -0.511468828f, 0.860866964f, -0.50883013f, 0.862423956f, -0.506186664f,
+    0.863972843f, -0.50353837f, 0.865513623f, -0.500885367f, 0.867046237f, -0.498227656f, 0.868570685f, -0.495565265f,
+    0.870086968f, -0.492898196f, 0.871595085f, -0.490226477f, 0.873094976f, -0.487550169f, 0.874586642f, -0.484869242f,
+    0.876070082f, -0.482183784f, 0.877545297f, -0.479493767f, 0.879012227f, -0.47679922f, 0.880470872f, -0.474100202f,
+    0.881921291f, -0.471396744f, 0.883363366f, -0.468688816f, 0.884797096f, -0.465976506f, 0.886222541f, -0.463259786f,
+    0.887639642f, -0.460538715f, 0.889048338f, -0.457813293f, 0.890448749f, -0.455083579f, 0.891840696f, -0.452349573f,
+    0.893224299f, -0.449611336f, 0.894599497f, -0.446868837f, 0.895966232f, -0.444122136f, 0.897324562f, -0.441371262f,
+    0.898674488f, -0.438616246f, 0.900015891f, -0.435857087f, 0.901348829f, -0.433093816f, 0.902673304f, -0.430326492f,
+    0.903989315f, -0.427555084f, 0.905296743f, -0.424779683f, 0.906595707f, -0.422000259f, 0.907886088f, -0.419216901f,
+    0.909168005f, -0.416429549f, 0.910441279f, -0.413638324f, 0.91170603f, -0.410843164f, 0.912962198f, -0.408044159f,
+    0.914209783f, -0.405241311f, 0.915448725f, -0.402434647f, 0.916679084f, -0.399624199f, 0.917900801f, -0.396809995f,
+    0.919113874f, -0.393992037f, 0.920318305f, -0.391170382f, 0.921514034f, -0.388345033f, 0.92270112f, -0.385516047f,
+    0.923879504f, -0.382683426f, 0.925049245f, -0.379847199f, 0.926210225f, -0.377007425f, 0.927362502f, -0.374164075f,
+    0.928506076f, -0.371317208f, 0.929640889f, -0.368466824f, 0.93076694f, -0.365612984f, 0.931884289f, -0.362755716f,
+    0.932992816f, -0.359895051f, 0.934092522f, -0.357030958f, 0.935183525f, -0.354163527f, 0.936265647f, -0.351292759f,
+    0.937339008f, -0.348418683f, 0.938403547f, -0.345541328f, 0.939459205f, -0.342660725f, 0.940506041f, -0.339776874f,
+    0.941544056f, -0.336889863f, 0.94257319f, -0.333999664f, 0.943593442f, -0.331106305f, 0.944604814f, -0.328209847f,
+    0.945607305f, -0.32531029f, 0.946600914f, -0.322407693f, 0.947585583f, -0.319502026f, 0.94856137f, -0.316593379f,
+    0.949528158f, -0.313681751f, 0.950486064f, -0.310767144f, 0.95143503f, -0.307849646f, 0.952374995f, -0.304929227f,
+    0.953306019f, -0.302005947f, 0.954228103f, -0.299079835f, 0.955141187f, -0.296150893f, 0.95604527f, -0.293219149f,
+    0.956940353f, -0.290284663f, 0.957826436f, -0.287347466f, 0.958703458f, -0.284407526f, 0.95957154f, -0.281464934f,
+    0.960430503f, -0.27851969f, 0.961280465f, -0.275571823f, 0.962121427f, -0.272621363f, 0.962953269f, -0.269668311f,
+    0.963776052f, -0.266712755f, 0.964589775f, -0.263754666f, 0.965394437f, -0.260794103f, 0.966189981f, -0.257831097f,
+    0.966976464f, -0.254865646f, 0.967753828f, -0.251897812f, 0.968522072f, -0.248927608f, 0.969281256f, -0.24595505f,
+    0.970031261f, -0.242980182f, 0.970772147f, -0.24000302f, 0.971503913f, -0.237023607f, 0.972226501f, -0.234041959f,
+    0.972939968f, -0.231058106f, 0.973644257f, -0.228072077f, 0.974339366f, -0.225083917f, 0.975025356f, -0.222093627f,
+    0.975702107f, -0.219101235f, 0.976369739f, -0.216106802f, 0.977028131f, -0.213110313f, 0.977677345f, -0.210111842f,
+    0.97831738f, -0.207111374f, 0.978948176f, -0.204108968f, 0.979569793f, -0.201104641f, 0.980182111f, -0.198098406f,
+    0.980785251f, -0.195090324f, 0.981379211f, -0.192080393f, 0.981963873f, -0.18906866f, 0.982539296f, -0.186055154f,
+    0.983105481f, -0.183039889f, 0.983662426f, -0.180022895f, 0.984210074f, -0.177004218f, 0.984748483f, -0.173983872f,
+    0.985277653f, -0.170961887f, 0.985797524f, -0.167938292f, 0.986308098f, -0.164913118f, 0.986809373f, -0.161886394f,
+    0.987301409f, -0.15885815f, 0.987784147f, -0.155828401f, 0.988257587f, -0.152797192f, 0.988721669f, -0.149764538f,
+    0.989176512f, -0.146730468f, 0.989621997f, -0.143695027f, 0.990058184f, -0.140658244f, 0.990485072f, -0.137620121f,
+    0.990902662f, -0.134580702f, 0.991310835f, -0.13154003f, 0.991709769f, -0.128498107f, 0.992099285f, -0.125454977f,
+    0.992479563f, -0.122410677f, 0.992850423f, -0.119365215f, 0.993211925f, -0.116318628f, 0.993564129f, -0.113270953f,
+    0.993906975f, -0.110222206f, 0.994240463f, -0.107172422f, 0.994564593f, -0.104121633f, 0.994879305f, -0.10106986f,
+    0.99518472f, -0.0980171412f, 0.995480776f, -0.0949634984f, 0.995767415f, -0.0919089541f, 0.996044695f, -0.0888535529f,
+    0.996312618f, -0.0857973099f, 0.996571124f, -0.0827402622f, 0.996820271f, -0.0796824396f, 0.997060061f, -0.0766238645f,
+    0.997290432f, -0.0735645667f, 0.997511446f, -0.070504576f, 0.997723043f, -0.0674439222f, 0.997925282f, -0.0643826276f,
+    0.998118103f, -0.061320737f, 0.998301566f, -0.0582582653f, 0.998475552f, -0.0551952459f, 0.998640239f, -0.052131705f,
+    0.99879545f, -0.0490676761f, 0.998941302f, -0.0460031815f, 0.999077737f, -0.0429382585f, 0.999204755f, -0.0398729257f,
+    0.999322355f, -0.0368072242f, 0.999430597f, -0.0337411724f, 0.999529421f, -0.030674804f, 0.999618828f, -0.027608145f,
+    0.999698818f, -0.024541229f, 0.99976939f, -0.0214740802f, 0.999830604f, -0.0184067301f, 0.99988234f, -0.015339206f,
+    0.999924719f, -0.0122715384f, 0.999957621f, -0.00920375437f, 0.999981165f, -0.00613588467f, 0.999995291f, -0.00306795677f,
+};
+static const int16_t fft_w_table_sc16[2048] __attribute__((aligned(16))) = {
+    32767, 0, 0, 32767, 23169, 23169, -23169, 23169,
+    30272, 12539, -12539, 30272, 12539, 30272, -30272, 12539,
+    32137, 6392, -6392, 32137, 18204, 27244, -27244, 18204,
+    27244, 18204, -18204, 27244, 6392, 32137, -32137, 6392,
+    32609, 3211, -3211, 32609, 20787, 25329, -25329, 20787,
+    28897, 15446, -15446, 28897, 9511, 31356, -31356, 9511,
+    31356, 9511, -9511, 31356, 15446, 28897, -28897, 15446,
+    25329, 20787, -20787, 25329, 3211, 32609, -32609, 3211,
+    32727, 1607, -1607, 32727, 22004, 24278, -24278, 22004,
+    29621, 14009, -14009, 29621, 11038, 30851, -30851, 11038,
+    31785, 7961, -7961, 31785, 16845, 28105, -28105, 16845,
+    26318, 19519, -19519, 26318, 4807, 32412, -32412, 4807,
+    32412, 4807, -4807, 32412, 19519, 26318, -26318, 19519,
+    28105, 16845, -16845, 28105, 7961, 31785, -31785, 7961,
+    30851, 11038, -11038, 30851, 14009, 29621, -29621, 14009,
+    24278, 22004, -22004, 24278, 1607, 32727, -32727, 1607,
+    32757, 804, -804, 32757, 22594, 23731, -23731, 22594,
+    29955, 13278, -13278, 29955, 11792, 30571, -30571, 11792,
+    31970, 7179, -7179, 31970, 17530, 27683, -27683, 17530,
+    26789, 18867, -18867, 26789, 5601, 32284, -32284, 5601,
+    32520, 4011, -4011, 32520, 20159, 25831, -25831, 20159,
+    28510, 16150, -16150, 28510, 8739, 31580, -31580, 8739,
+    31113, 10278, -10278, 31113, 14732, 29268, -29268, 14732,
+    24811, 21402, -21402, 24811, 2410, 32678, -32678, 2410,
+    32678, 2410, -2410, 32678, 21402, 24811, -24811, 21402,
+    29268, 14732, -14732, 29268, 10278, 31113, -31113, 10278,
+    31580, 8739, -8739, 31580, 16150, 28510, -28510, 16150,
+    25831, 20159, -20159, 25831, 4011, 32520, -32520, 4011,
+    32284, 5601, -5601, 32284, 18867, 26789, -26789, 18867,
+    27683, 17530, -17530, 27683, 7179, 31970, -31970, 7179,
+    30571, 11792, -11792, 30571, 13278, 29955, -29955, 13278,
+    23731, 22594, -22594, 23731, 804, 32757, -32757, 804,
+    32764, 402, -402, 32764, 22883, 23452, -23452, 22883,
+    30116, 12909, -12909, 30116, 12166, 30424, -30424, 12166,
+    32056, 6786, -6786, 32056, 17868, 27466, -27466, 17868,
+    27019, 18537, -18537, 27019, 5997, 32213, -32213, 5997,
+    32567, 3611, -3611, 32567, 20474, 25582, -25582, 20474,
+    28706, 15799, -15799, 28706, 9126, 31470, -31470, 9126,
+    31236, 9895, -9895, 31236, 15090, 29085, -29085, 15090,
+    25072, 21096, -21096, 25072, 2811, 32646, -32646, 2811,
+    32705, 2009, -2009, 32705, 21705, 24546, -24546, 21705,
+    29446, 14372, -14372, 29446, 10659, 30984, -30984, 10659,
+    31684, 8351, -8351, 31684, 16499, 28309, -28309, 16499,
+    26077, 19840, -19840, 26077, 4409, 32468, -32468, 4409,
+    32350, 5205, -5205, 32350, 19194, 26556, -26556, 19194,
+    27896, 17189, -17189, 27896, 7571, 31880, -31880, 7571,
+    30713, 11416, -11416, 30713, 13645, 29790, -29790, 13645,
+    24006, 22301, -22301, 24006, 1206, 32744, -32744, 1206,
+    32744, 1206, -1206, 32744, 22301, 24006, -24006, 22301,
+    29790, 13645, -13645, 29790, 11416, 30713, -30713, 11416,
+    31880, 7571, -7571, 31880, 17189, 27896, -27896, 17189,
+    26556, 19194, -19194, 26556, 5205, 32350, -32350, 5205,
+    32468, 4409, -4409, 32468, 19840, 26077, -26077, 19840,
+    28309, 16499, -16499, 28309, 8351, 31684, -31684, 8351,
+    30984, 10659, -10659, 30984, 14372, 29446, -29446, 14372,
+    24546, 21705, -21705, 24546, 2009, 32705, -32705, 2009,
+    32646, 2811, -2811, 32646, 21096, 25072, -25072, 21096,
+    29085, 15090, -15090, 29085, 9895, 31236, -31236, 9895,
+    31470, 9126, -9126, 31470, 15799, 28706, -28706, 15799,
+    25582, 20474, -20474, 25582, 3611, 32567, -32567, 3611,
+    32213, 5997, -5997, 32213, 18537, 27019, -27019, 18537,
+    27466, 17868, -17868, 27466, 6786, 32056, -32056, 6786,
+    30424, 12166, -12166, 30424, 12909, 30116, -30116, 12909,
+    23452, 22883, -22883, 23452, 402, 32764, -32764, 402,
+    32766, 201, -201, 32766, 23027, 23311, -23311, 23027,
+    30195, 12724, -12724, 30195, 12353, 30349, -30349, 12353,
+    32097, 6589, -6589, 32097, 18036, 27355, -27355, 18036,
+    27132, 18371, -18371, 27132, 6195, 32176, -32176, 6195,
+    32588, 3411, -3411, 32588, 20631, 25456, -25456, 20631,
+    28802, 15623, -15623, 28802, 9319, 31413, -31413, 9319,
+    31297, 9703, -9703, 31297, 15268, 28992, -28992, 15268,
+    25201, 20942, -20942, 25201, 3011, 32628, -32628, 3011,
+    32717, 1808, -1808, 32717, 21855, 24413, -24413, 21855,
+    29534, 14191, -14191, 29534, 10849, 30918, -30918, 10849,
+    31735, 8156, -8156, 31735, 16672, 28208, -28208, 16672,
+    26198, 19680, -19680, 26198, 4608, 32441, -32441, 4608,
+    32382, 5006, -5006, 32382, 19357, 26437, -26437, 19357,
+    28001, 17017, -17017, 28001, 7766, 31833, -31833, 7766,
+    30783, 11227, -11227, 30783, 13827, 29706, -29706, 13827,
+    24143, 22153, -22153, 24143, 1406, 32736, -32736, 1406,
+    32751, 1005, -1005, 32751, 22448, 23869, -23869, 22448,
+    29873, 13462, -13462, 29873, 11604, 30643, -30643, 11604,
+    31926, 7375, -7375, 31926, 17360, 27790, -27790, 17360,
+    26673, 19031, -19031, 26673, 5403, 32318, -32318, 5403,
+    32495, 4210, -4210, 32495, 20000, 25954, -25954, 20000,
+    28410, 16325, -16325, 28410, 8545, 31633, -31633, 8545,
+    31049, 10469, -10469, 31049, 14552, 29358, -29358, 14552,
+    24679, 21554, -21554, 24679, 2209, 32692, -32692, 2209,
+    32662, 2610, -2610, 32662, 21249, 24942, -24942, 21249,
+    29177, 14911, -14911, 29177, 10087, 31175, -31175, 10087,
+    31525, 8932, -8932, 31525, 15975, 28608, -28608, 15975,
+    25707, 20317, -20317, 25707, 3811, 32544, -32544, 3811,
+    32249, 5799, -5799, 32249, 18702, 26905, -26905, 18702,
+    27575, 17699, -17699, 27575, 6982, 32014, -32014, 6982,
+    30498, 11980, -11980, 30498, 13094, 30036, -30036, 13094,
+    23592, 22739, -22739, 23592, 603, 32761, -32761, 603,
+    32761, 603, -603, 32761, 22739, 23592, -23592, 22739,
+    30036, 13094, -13094, 30036, 11980, 30498, -30498, 11980,
+    32014, 6982, -6982, 32014, 17699, 27575, -27575, 17699,
+    26905, 18702, -18702, 26905, 5799, 32249, -32249, 5799,
+    32544, 3811, -3811, 32544, 20317, 25707, -25707, 20317,
+    28608, 15975, -15975, 28608, 8932, 31525, -31525, 8932,
+    31175, 10087, -10087, 31175, 14911, 29177, -29177, 14911,
+    24942, 21249, -21249, 24942, 2610, 32662, -32662, 2610,
+    32692, 2209, -2209, 32692, 21554, 24679, -24679, 21554,
+    29358, 14552, -14552, 29358, 10469, 31049, -31049, 10469,
+    31633, 8545, -8545, 31633, 16325, 28410, -28410, 16325,
+    25954, 20000, -20000, 25954, 4210, 32495, -32495, 4210,
+    32318, 5403, -5403, 32318, 19031, 26673, -26673, 19031,
+    27790, 17360, -17360, 27790, 7375, 31926, -31926, 7375,
+    30643, 11604, -11604, 30643, 13462, 29873, -29873, 13462,
+    23869, 22448, -22448, 23869, 1005, 32751, -32751, 1005,
+    32736, 1406, -1406, 32736, 22153, 24143, -24143, 22153,
+    29706, 13827, -13827, 29706, 11227, 30783, -30783, 11227,
+    31833, 7766, -7766, 31833, 17017, 28001, -28001, 17017,
+    26437, 19357, -19357, 26437, 5006, 32382, -32382, 5006,
+    32441, 4608, -4608, 32441, 19680, 26198, -26198, 19680,
+    28208, 16672, -16672, 28208, 8156, 31735, -31735, 8156,
+    30918, 10849, -10849, 30918, 14191, 29534, -29534, 14191,
+    24413, 21855, -21855, 24413, 1808, 32717, -32717, 1808,
+    32628, 3011, -3011, 32628, 20942, 25201, -25201, 20942,
+    28992, 15268, -15268, 28992, 9703, 31297, -31297, 9703,
+    31413, 9319, -9319, 31413, 15623, 28802, -28802, 15623,
+    25456, 20631, -20631, 25456, 3411, 32588, -32588, 3411,
+    32176, 6195, -6195, 32176, 18371, 27132, -27132, 18371,
+    27355, 18036, -18036, 27355, 6589, 32097, -32097, 6589,
+    30349, 12353, -12353, 30349, 12724, 30195, -30195, 12724,
+    23311, 23027, -23027, 23311, 201, 32766, -32766, 201,
+    32766, 100, -100, 32766, 23098, 23240, -23240, 23098,
+    30234, 12632, -12632, 30234, 12446, 30311, -30311, 12446,
+    32117, 6491, -6491, 32117, 18120, 27300, -27300, 18120,
+    27188, 18287, -18287, 27188, 6293, 32156, -32156, 6293,
+    32599, 3311, -3311, 32599, 20709, 25392, -25392, 20709,
+    28850, 15534, -15534, 28850, 9415, 31385, -31385, 9415,
+    31326, 9607, -9607, 31326, 15357, 28945, -28945, 15357,
+    25265, 20864, -20864, 25265, 3111, 32618, -32618, 3111,
+    32722, 1708, -1708, 32722, 21930, 24346, -24346, 21930,
+    29577, 14100, -14100, 29577, 10944, 30885, -30885, 10944,
+    31760, 8059, -8059, 31760, 16759, 28156, -28156, 16759,
+    26258, 19599, -19599, 26258, 4708, 32426, -32426, 4708,
+    32397, 4907, -4907, 32397, 19438, 26378, -26378, 19438,
+    28053, 16931, -16931, 28053, 7864, 31809, -31809, 7864,
+    30817, 11133, -11133, 30817, 13918, 29663, -29663, 13918,
+    24211, 22079, -22079, 24211, 1507, 32732, -32732, 1507,
+    32754, 904, -904, 32754, 22521, 23800, -23800, 22521,
+    29915, 13370, -13370, 29915, 11698, 30607, -30607, 11698,
+    31948, 7277, -7277, 31948, 17445, 27736, -27736, 17445,
+    26731, 18949, -18949, 26731, 5502, 32301, -32301, 5502,
+    32508, 4110, -4110, 32508, 20079, 25893, -25893, 20079,
+    28460, 16238, -16238, 28460, 8642, 31606, -31606, 8642,
+    31081, 10373, -10373, 31081, 14642, 29313, -29313, 14642,
+    24745, 21478, -21478, 24745, 2310, 32685, -32685, 2310,
+    32670, 2510, -2510, 32670, 21326, 24877, -24877, 21326,
+    29222, 14822, -14822, 29222, 10182, 31144, -31144, 10182,
+    31553, 8836, -8836, 31553, 16063, 28559, -28559, 16063,
+    25769, 20238, -20238, 25769, 3911, 32532, -32532, 3911,
+    32267, 5700, -5700, 32267, 18785, 26847, -26847, 18785,
+    27629, 17615, -17615, 27629, 7081, 31992, -31992, 7081,
+    30535, 11886, -11886, 30535, 13186, 29996, -29996, 13186,
+    23661, 22666, -22666, 23661, 703, 32759, -32759, 703,
+    32763, 502, -502, 32763, 22811, 23522, -23522, 22811,
+    30076, 13002, -13002, 30076, 12073, 30461, -30461, 12073,
+    32035, 6884, -6884, 32035, 17784, 27520, -27520, 17784,
+    26962, 18620, -18620, 26962, 5898, 32231, -32231, 5898,
+    32556, 3711, -3711, 32556, 20396, 25645, -25645, 20396,
+    28657, 15887, -15887, 28657, 9029, 31498, -31498, 9029,
+    31206, 9991, -9991, 31206, 15001, 29131, -29131, 15001,
+    25007, 21173, -21173, 25007, 2711, 32654, -32654, 2711,
+    32699, 2109, -2109, 32699, 21629, 24613, -24613, 21629,
+    29402, 14462, -14462, 29402, 10564, 31017, -31017, 10564,
+    31659, 8448, -8448, 31659, 16412, 28360, -28360, 16412,
+    26016, 19920, -19920, 26016, 4310, 32482, -32482, 4310,
+    32334, 5304, -5304, 32334, 19113, 26615, -26615, 19113,
+    27843, 17274, -17274, 27843, 7473, 31903, -31903, 7473,
+    30678, 11510, -11510, 30678, 13553, 29832, -29832, 13553,
+    23938, 22374, -22374, 23938, 1105, 32748, -32748, 1105,
+    32740, 1306, -1306, 32740, 22227, 24075, -24075, 22227,
+    29748, 13736, -13736, 29748, 11322, 30748, -30748, 11322,
+    31856, 7668, -7668, 31856, 17103, 27948, -27948, 17103,
+    26497, 19276, -19276, 26497, 5106, 32366, -32366, 5106,
+    32455, 4509, -4509, 32455, 19760, 26137, -26137, 19760,
+    28259, 16586, -16586, 28259, 8253, 31710, -31710, 8253,
+    30951, 10754, -10754, 30951, 14281, 29490, -29490, 14281,
+    24480, 21780, -21780, 24480, 1908, 32711, -32711, 1908,
+    32637, 2911, -2911, 32637, 21019, 25136, -25136, 21019,
+    29038, 15179, -15179, 29038, 9799, 31267, -31267, 9799,
+    31442, 9222, -9222, 31442, 15711, 28754, -28754, 15711,
+    25519, 20553, -20553, 25519, 3511, 32578, -32578, 3511,
+    32194, 6096, -6096, 32194, 18454, 27076, -27076, 18454,
+    27411, 17952, -17952, 27411, 6688, 32077, -32077, 6688,
+    30386, 12260, -12260, 30386, 12817, 30156, -30156, 12817,
+    23382, 22955, -22955, 23382, 301, 32765, -32765, 301,
+    32765, 301, -301, 32765, 22955, 23382, -23382, 22955,
+    30156, 12817, -12817, 30156, 12260, 30386, -30386, 12260,
+    32077, 6688, -6688, 32077, 17952, 27411, -27411, 17952,
+    27076, 18454, -18454, 27076, 6096, 32194, -32194, 6096,
+    32578, 3511, -3511, 32578, 20553, 25519, -25519, 20553,
+    28754, 15711, -15711, 28754, 9222, 31442, -31442, 9222,
+    31267, 9799, -9799, 31267, 15179, 29038, -29038, 15179,
+    25136, 21019, -21019, 25136, 2911, 32637, -32637, 2911,
+    32711, 1908, -1908, 32711, 21780, 24480, -24480, 21780,
+    29490, 14281, -14281, 29490, 10754, 30951, -30951, 10754,
+    31710, 8253, -8253, 31710, 16586, 28259, -28259, 16586,
+    26137, 19760, -19760, 26137, 4509, 32455, -32455, 4509,
+    32366, 5106, -5106, 32366, 19276, 26497, -26497, 19276,
+    27948, 17103, -17103, 27948, 7668, 31856, -31856, 7668,
+    30748, 11322, -11322, 30748, 13736, 29748, -29748, 13736,
+    24075, 22227, -22227, 24075, 1306, 32740, -32740, 1306,
+    32748, 1105, -1105, 32748, 22374, 23938, -23938, 22374,
+    29832, 13553, -13553, 29832, 11510, 30678, -30678, 11510,
+    31903, 7473, -7473, 31903, 17274, 27843, -27843, 17274,
+    26615, 19113, -19113, 26615, 5304, 32334, -32334, 5304,
+    32482, 4310, -4310, 32482, 19920, 26016, -26016, 19920,
+    28360, 16412, -16412, 28360, 8448, 31659, -31659, 8448,
+    31017, 10564, -10564, 31017, 14462, 29402, -29402, 14462,
+    24613, 21629, -21629, 24613, 2109, 32699, -32699, 2109,
+    32654, 2711, -2711, 32654, 21173, 25007, -25007, 21173,
+    29131, 15001, -15001, 29131, 9991, 31206, -31206, 9991,
+    31498, 9029, -9029, 31498, 15887, 28657, -28657, 15887,
+    25645, 20396, -20396, 25645, 3711, 32556, -32556, 3711,
+    32231, 5898, -5898, 32231, 18620, 26962, -26962, 18620,
+    27520, 17784, -17784, 27520, 6884, 32035, -32035, 6884,
+    30461, 12073, -12073, 30461, 13002, 30076, -30076, 13002,
+    23522, 22811, -22811, 23522, 502, 32763, -32763, 502,
+    32759, 703, -703, 32759, 22666, 23661, -23661, 22666,
+    29996, 13186, -13186, 29996, 11886, 30535, -30535, 11886,
+    31992, 7081, -7081, 31992, 17615, 27629, -27629, 17615,
+    26847, 18785, -18785, 26847, 5700, 32267, -32267, 5700,
+    32532, 3911, -3911, 32532, 20238, 25769, -25769, 20238,
+    28559, 16063, -16063, 28559, 8836, 31553, -31553, 8836,
+    31144, 10182, -10182, 31144, 14822, 29222, -29222, 14822,
+    24877, 21326, -21326, 24877, 2510, 32670, -32670, 2510,
+    32685, 2310, -2310, 32685, 21478, 24745, -24745, 21478,
+    29313, 14642, -14642, 29313, 10373, 31081, -31081, 10373,
+    31606, 8642, -8642, 31606, 16238, 28460, -28460, 16238,
+    25893, 20079, -20079, 25893, 4110, 32508, -32508, 4110,
+    32301, 5502, -5502, 32301, 18949, 26731, -26731, 18949,
+    27736, 17445, -17445, 27736, 7277, 31948, -31948, 7277,
+    30607, 11698, -11698, 30607, 13370, 29915, -29915, 13370,
+    23800, 22521, -22521, 23800, 904, 32754, -32754, 904,
+    32732, 1507, -1507, 32732, 22079, 24211, -24211, 22079,
+    29663, 13918, -13918, 29663, 11133, 30817, -30817, 11133,
+    31809, 7864, -7864, 31809, 16931, 28053, -28053, 16931,
+    26378, 19438, -19438, 26378, 4907, 32397, -32397, 4907,
+    32426, 4708, -4708, 32426, 19599, 26258, -26258, 19599,
+    28156, 16759, -16759, 28156, 8059, 31760, -31760, 8059,
+    30885, 10944, -10944, 30885, 14100, 29577, -29577, 14100,
+    24346, 21930, -21930, 24346, 1708, 32722, -32722, 1708,
+    32618, 3111, -3111, 32618, 20864, 25265, -25265, 20864,
+    28945, 15357, -15357, 28945, 9607, 31326, -31326, 9607,
+    31385, 9415, -9415, 31385, 15534, 28850, -28850, 15534,
+    25392, 20709, -20709, 25392, 3311, 32599, -32599, 3311,
+    32156, 6293, -6293, 32156, 18287, 27188, -27188, 18287,
+    27300, 18120, -18120, 27300, 6491, 32117, -32117, 6491,
+    30311, 12446, -12446, 30311, 12632, 30234, -30234, 12632,
+    23240, 23098, -23098, 23240, 100, 32766, -32766, 100,
+};
+static const int16_t fft_hann_q15[1025] = {
+    0, 0, 0, 0, 1, 1, 2, 3,
+    4, 6, 7, 9, 11, 13, 15, 17,
+    19, 22, 24, 27, 30, 33, 37, 40,
+    44, 48, 52, 56, 60, 64, 69, 74,
+    78, 83, 89, 94, 99, 105, 111, 117,
+    123, 129, 135, 142, 149, 155, 162, 170,
+    177, 184, 192, 200, 208, 216, 224, 232,
+    241, 249, 258, 267, 276, 286, 295, 305,
+    314, 324, 334, 344, 355, 365, 376, 387,
+    398, 409, 420, 431, 443, 455, 466, 478,
+    490, 503, 515, 528, 541, 553, 566, 580,
+    593, 606, 620, 634, 648, 662, 676, 690,
+    705, 720, 734, 749, 765, 780, 795, 811,
+    826, 842, 858, 874, 891, 907, 924, 940,
+    957, 974, 991, 1009, 1026, 1044, 1061, 1079,
+    1097, 1115, 1134, 1152, 1171, 1190, 1208, 1227,
+    1247, 1266, 1285, 1305, 1325, 1345, 1365, 1385,
+    1405, 1425, 1446, 1467, 1488, 1509, 1530, 1551,
+    1572, 1594, 1616, 1638, 1660, 1682, 1704, 1726,
+    1749, 1772, 1794, 1817, 1840, 1864, 1887, 1910,
+    1934, 1958, 1982, 2006, 2030, 2054, 2079, 2103,
+    2128, 2153, 2178, 2203, 2228, 2253, 2279, 2305,
+    2330, 2356, 2382, 2409, 2435, 2461, 2488, 2515,
+    2541, 2568, 2595, 2623, 2650, 2677, 2705, 2733,
+    2761, 2789, 2817, 2845, 2873, 2902, 2930, 2959,
+    2988, 3017, 3046, 3075, 3105, 3134, 3164, 3194,
+    3224, 3254, 3284, 3314, 3344, 3375, 3406, 3436,
+    3467, 3498, 3529, 3560, 3592, 3623, 3655, 3687,
+    3718, 3750, 3782, 3815, 3847, 3879, 3912, 3944,
+    3977, 4010, 4043, 4076, 4110, 4143, 4176, 4210,
+    4244, 4277, 4311, 4345, 4380, 4414, 4448, 4483,
+    4517, 4552, 4587, 4622, 4657, 4692, 4727, 4763,
+    4798, 4834, 4869, 4905, 4941, 4977, 5013, 5050,
+    5086, 5122, 5159, 5196, 5232, 5269, 5306, 5343,
+    5381, 5418, 5455, 5493, 5530, 5568, 5606, 5644,
+    5682, 5720, 5758, 5796, 5835, 5873, 5912, 5951,
+    5989, 6028, 6067, 6106, 6146, 6185, 6224, 6264,
+    6303, 6343, 6383, 6423, 6463, 6503, 6543, 6583,
+    6623, 6664, 6704, 6745, 6786, 6826, 6867, 6908,
+    6949, 6990, 7032, 7073, 7114, 7156, 7197, 7239,
+    7281, 7323, 7365, 7407, 7449, 7491, 7533, 7575,
+    7618, 7660, 7703, 7746, 7788, 7831, 7874, 7917,
+    7960, 8003, 8047, 8090, 8133, 8177, 8220, 8264,
+    8308, 8351, 8395, 8439, 8483, 8527, 8571, 8616,
+    8660, 8704, 8749, 8793, 8838, 8882, 8927, 8972,
+    9017, 9062, 9107, 9152, 9197, 9242, 9287, 9333,
+    9378, 9424, 9469, 9515, 9560, 9606, 9652, 9698,
+    9744, 9790, 9836, 9882, 9928, 9974, 10021, 10067,
+    10113, 10160, 10206, 10253, 10300, 10346, 10393, 10440,
+    10487, 10534, 10581, 10628, 10675, 10722, 10769, 10816,
+    10864, 10911, 10958, 11006, 11053, 11101, 11148, 11196,
+    11244, 11292, 11339, 11387, 11435, 11483, 11531, 11579,
+    11627, 11675, 11723, 11772, 11820, 11868, 11917, 11965,
+    12013, 12062, 12110, 12159, 12207, 12256, 12305, 12353,
+    12402, 12451, 12500, 12549, 12597, 12646, 12695, 12744,
+    12793, 12842, 12892, 12941, 12990, 13039, 13088, 13137,
+    13187, 13236, 13285, 13335, 13384, 13434, 13483, 13533,
+    13582, 13632, 13681, 13731, 13780, 13830, 13880, 13929,
+    13979, 14029, 14079, 14128, 14178, 14228, 14278, 14328,
+    14377, 14427, 14477, 14527, 14577, 14627, 14677, 14727,
+    14777, 14827, 14877, 14927, 14977, 15027, 15078, 15128,
+    15178, 15228, 15278, 15328, 15378, 15429, 15479, 15529,
+    15579, 15629, 15680, 15730, 15780, 15830, 15880, 15931,
+    15981, 16031, 16081, 16132, 16182, 16232, 16282, 16333,
+    16383, 16433, 16484, 16534, 16584, 16634, 16685, 16735,
+    16785, 16835, 16886, 16936, 16986, 17036, 17086, 17137,
+    17187, 17237, 17287, 17337, 17388, 17438, 17488, 17538,
+    17588, 17638, 17688, 17739, 17789, 17839, 17889, 17939,
+    17989, 18039, 18089, 18139, 18189, 18239, 18289, 18339,
+    18389, 18438, 18488, 18538, 18588, 18638, 18687, 18737,
+    18787, 18837, 18886, 18936, 18986, 19035, 19085, 19134,
+    19184, 19233, 19283, 19332, 19382, 19431, 19481, 19530,
+    19579, 19629, 19678, 19727, 19776, 19825, 19874, 19924,
+    19973, 20022, 20071, 20120, 20169, 20217, 20266, 20315,
+    20364, 20413, 20461, 20510, 20559, 20607, 20656, 20704,
+    20753, 20801, 20849, 20898, 20946, 20994, 21043, 21091,
+    21139, 21187, 21235, 21283, 21331, 21379, 21427, 21474,
+    21522, 21570, 21618, 21665, 21713, 21760, 21808, 21855,
+    21902, 21950, 21997, 22044, 22091, 22138, 22185, 22232,
+    22279, 22326, 22373, 22420, 22466, 22513, 22560, 22606,
+    22653, 22699, 22745, 22792, 22838, 22884, 22930, 22976,
+    23022, 23068, 23114, 23160, 23206, 23251, 23297, 23342,
+    23388, 23433, 23479, 23524, 23569, 23614, 23659, 23704,
+    23749, 23794, 23839, 23884, 23928, 23973, 24017, 24062,
+    24106, 24150, 24195, 24239, 24283, 24327, 24371, 24415,
+    24458, 24502, 24546, 24589, 24633, 24676, 24719, 24763,
+    24806, 24849, 24892, 24935, 24978, 25020, 25063, 25106,
+    25148, 25191, 25233, 25275, 25317, 25359, 25401, 25443,
+    25485, 25527, 25569, 25610, 25652, 25693, 25734, 25776,
+    25817, 25858, 25899, 25940, 25980, 26021, 26062, 26102,
+    26143, 26183, 26223, 26263, 26303, 26343, 26383, 26423,
+    26463, 26502, 26542, 26581, 26620, 26660, 26699, 26738,
+    26777, 26815, 26854, 26893, 26931, 26970, 27008, 27046,
+    27084, 27122, 27160, 27198, 27236, 27273, 27311, 27348,
+    27385, 27423, 27460, 27497, 27534, 27570, 27607, 27644,
+    27680, 27716, 27753, 27789, 27825, 27861, 27897, 27932,
+    27968, 28003, 28039, 28074, 28109, 28144, 28179, 28214,
+    28249, 28283, 28318, 28352, 28386, 28421, 28455, 28489,
+    28522, 28556, 28590, 28623, 28656, 28690, 28723, 28756,
+    28789, 28822, 28854, 28887, 28919, 28951, 28984, 29016,
+    29048, 29079, 29111, 29143, 29174, 29206, 29237, 29268,
+    29299, 29330, 29360, 29391, 29422, 29452, 29482, 29512,
+    29542, 29572, 29602, 29632, 29661, 29691, 29720, 29749,
+    29778, 29807, 29836, 29864, 29893, 29921, 29949, 29977,
+    30005, 30033, 30061, 30089, 30116, 30143, 30171, 30198,
+    30225, 30251, 30278, 30305, 30331, 30357, 30384, 30410,
+    30436, 30461, 30487, 30513, 30538, 30563, 30588, 30613,
+    30638, 30663, 30687, 30712, 30736, 30760, 30784, 30808,
+    30832, 30856, 30879, 30902, 30926, 30949, 30972, 30994,
+    31017, 31040, 31062, 31084, 31106, 31128, 31150, 31172,
+    31194, 31215, 31236, 31257, 31278, 31299, 31320, 31341,
+    31361, 31381, 31401, 31421, 31441, 31461, 31481, 31500,
+    31519, 31539, 31558, 31576, 31595, 31614, 31632, 31651,
+    31669, 31687, 31705, 31722, 31740, 31757, 31775, 31792,
+    31809, 31826, 31842, 31859, 31875, 31892, 31908, 31924,
+    31940, 31955, 31971, 31986, 32001, 32017, 32032, 32046,
+    32061, 32076, 32090, 32104, 32118, 32132, 32146, 32160,
+    32173, 32186, 32200, 32213, 32225, 32238, 32251, 32263,
+    32276, 32288, 32300, 32311, 32323, 32335, 32346, 32357,
+    32368, 32379, 32390, 32401, 32411, 32422, 32432, 32442,
+    32452, 32461, 32471, 32480, 32490, 32499, 32508, 32517,
+    32525, 32534, 32542, 32550, 32558, 32566, 32574, 32582,
+    32589, 32596, 32604, 32611, 32617, 32624, 32631, 32637,
+    32643, 32649, 32655, 32661, 32667, 32672, 32677, 32683,
+    32688, 32692, 32697, 32702, 32706, 32710, 32714, 32718,
+    32722, 32726, 32729, 32733, 32736, 32739, 32742, 32744,
+    32747, 32749, 32751, 32753, 32755, 32757, 32759, 32760,
+    32762, 32763, 32764, 32765, 32765, 32766, 32766, 32766,
+    32767,
+};
+#else
+#error "No FFT tables for MAX_SIGNAL_LENGHT (sizes: 256, 512, 1024, 2048), see fft_table_gen.py"
+#endif
+
+#endif /* FFT_TABLES_H_ */
@@ -0,0 +1,148 @@
+/**
+ * @file goertzel.c
+ * @brief Goertzel filter bank
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "goertzel.h"
+#include <math.h>
+/*==================[macros and definitions]=================================*/
+#define COEFF_Q     30      /*!< Fractional bits of the fixed point coefficients (range [-2, 2)) */
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+static uint32_t isqrt64(uint64_t x);
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Integer square root
+ * 
+ * @param x     Radicand
+ * @return      floor(sqrt(x))
+ */
+static uint32_t isqrt64(uint64_t x){
+    uint64_t res = 0;
+    uint64_t bit = 1ULL << 62;
+    while(bit > x){
+        bit >>= 2;
+    }
+    while(bit != 0){
+        if(x >= res + bit){
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else{
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+/*==================[external functions definition]==========================*/
+bool GoertzelInit(goertzel_t * bank, goertzel_config_t * config){
+    if (config->n_bins == 0 || config->n_bins > GOERTZEL_MAX_BINS || config->lenght == 0){
+        return false;
+    }
+    bank->n_bins = config->n_bins;
+    bank->lenght = config->lenght;
+    for (uint8_t k = 0; k < bank->n_bins; k++){
+        bank->coeff[k] = 2 * cosf(2 * M_PI * config->freqs[k] / config->sample_freq);
+        bank->amplitude[k] = 0;
+    }
+    GoertzelReset(bank);
+    return true;
+}
+
+bool GoertzelPush(goertzel_t * bank, const float * samples, uint16_t n){
+    bool done = false;
+    float s, power;
+    for (uint16_t i = 0; i < n; i++){
+        // s[n] = x[n] + coeff * s[n-1] - s[n-2]
+        for (uint8_t k = 0; k < bank->n_bins; k++){
+            s = samples[i] + bank->coeff[k] * bank->s1[k] - bank->s2[k];
+            bank->s2[k] = bank->s1[k];
+            bank->s1[k] = s;
+        }
+        bank->count++;
+        if (bank->count == bank->lenght){
+            // |X|^2 = s1^2 + s2^2 - coeff * s1 * s2, amplitude = 2 * |X| / N
+            for (uint8_t k = 0; k < bank->n_bins; k++){
+                power = bank->s1[k] * bank->s1[k] + bank->s2[k] * bank->s2[k] - bank->coeff[k] * bank->s1[k] * bank->s2[k];
+                bank->amplitude[k] = 2 * sqrtf(fmaxf(power, 0)) / bank->lenght;
+            }
+            GoertzelReset(bank);
+            done = true;
+        }
+    }
+    return done;
+}
+
+void GoertzelReset(goertzel_t * bank){
+    for (uint8_t k = 0; k < bank->n_bins; k++){
+        bank->s1[k] = 0;
+        bank->s2[k] = 0;
+    }
+    bank->count = 0;
+}
+
+bool GoertzelInitQ30(goertzel_q30_t * bank, goertzel_config_t * config){
+    float coeff;
+    if (config->n_bins == 0 || config->n_bins > GOERTZEL_MAX_BINS || config->lenght == 0){
+        return false;
+    }
+    bank->n_bins = config->n_bins;
+    bank->lenght = config->lenght;
+    bank->offset = config->offset;
+    for (uint8_t k = 0; k < bank->n_bins; k++){
+        coeff = 2 * cosf(2 * M_PI * config->freqs[k] / config->sample_freq);
+        // 2.0 (f = 0) is out of range, saturate to the largest Q30 value
+        bank->coeff[k] = (coeff >= 2) ? INT32_MAX : (int32_t)lroundf(coeff * (1UL << COEFF_Q));
+        bank->amplitude[k] = 0;
+    }
+    GoertzelResetQ30(bank);
+    return true;
+}
+
+bool GoertzelPushQ30(goertzel_q30_t * bank, const uint16_t * samples, uint16_t n){
+    bool done = false;
+    int32_t x, s;
+    int64_t power;
+    for (uint16_t i = 0; i < n; i++){
+        x = (int32_t)samples[i] - bank->offset;
+        // 64 bits product, the state grows up to about N * x / (2 * sin(w))
+        for (uint8_t k = 0; k < bank->n_bins; k++){
+            s = x + (int32_t)(((int64_t)bank->coeff[k] * bank->s1[k]) >> COEFF_Q) - bank->s2[k];
+            bank->s2[k] = bank->s1[k];
+            bank->s1[k] = s;
+        }
+        bank->count++;
+        if (bank->count == bank->lenght){
+            for (uint8_t k = 0; k < bank->n_bins; k++){
+                power = (int64_t)bank->s1[k] * bank->s1[k] + (int64_t)bank->s2[k] * bank->s2[k]
+                      - (((int64_t)bank->coeff[k] * bank->s1[k]) >> COEFF_Q) * bank->s2[k];
+                bank->amplitude[k] = 2 * isqrt64((power > 0) ? power : 0) / bank->lenght;
+            }
+            GoertzelResetQ30(bank);
+            done = true;
+        }
+    }
+    return done;
+}
+
+void GoertzelResetQ30(goertzel_q30_t * bank){
+    for (uint8_t k = 0; k < bank->n_bins; k++){
+        bank->s1[k] = 0;
+        bank->s2[k] = 0;
+    }
+    bank->count = 0;
+}
+
+/*==================[end of file]============================================*/
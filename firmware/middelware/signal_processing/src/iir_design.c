@@ -0,0 +1,355 @@
+/**
+ * @file iir_design.c
+ * @brief IIR filters designer
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "iir_design.h"
+#include <math.h>
+#include <complex.h>
+/*==================[macros and definitions]=================================*/
+#define MAX_PROTO_ORDER     (2 * IIR_MAX_SECTIONS)      /*!< Highest order of the analog prototype */
+#define BESSEL_ITERATIONS   200                         /*!< Iterations of the polynomial roots search */
+#define BISECT_ITERATIONS   60                          /*!< Iterations of the -3 dB frequency search */
+#define SOS_B_LIMIT         1.99                        /*!< Largest numerator coefficient (inside the [-2, 2) range of IirFilterToQ31() and IirFilterToQ15()) */
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+static uint8_t bessel_poles(uint8_t n, double complex * poles);
+static uint8_t prototype_poles(const iir_design_t * design, uint8_t n, double complex * poles, double * gain);
+static double sos_gain(const float * sos, double w);
+static void sos_from_poles(const iir_design_t * design, double complex z1, double complex z2, 
+                           double w_ref, double cos_notch, float * sos);
+static double balance_gain(float sos[][IIR_SOS_COEFF], uint8_t k);
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Bessel analog prototype poles (-3 dB at 1 rad/s)
+ * 
+ * Roots of the reverse Bessel polynomial (Durand-Kerner iteration), scaled so the 
+ * magnitude response is -3 dB at 1 rad/s.
+ * 
+ * @param n         Prototype order
+ * @param poles     Array for the poles in the upper half plane (and the real pole for odd orders)
+ * @return uint8_t  Number of poles returned
+ */
+static uint8_t bessel_poles(uint8_t n, double complex * poles){
+    double a[MAX_PROTO_ORDER + 1];
+    double complex r[MAX_PROTO_ORDER];
+    double complex num, den;
+    double lo = 0, hi = 10, w, mag;
+    uint8_t m = 0;
+    // a[k] = (2n - k)! / (2^(n - k) k! (n - k)!), a[n] = 1 (monic)
+    a[n] = 1;
+    for (int8_t k = n - 1; k >= 0; k--){
+        a[k] = a[k + 1] * (2 * n - k) * (k + 1) / (2.0 * (n - k));
+    }
+    for (uint8_t i = 0; i < n; i++){
+        r[i] = cpow(0.4 + 0.9 * I, i);
+    }
+    for (uint16_t it = 0; it < BESSEL_ITERATIONS; it++){
+        for (uint8_t i = 0; i < n; i++){
+            num = a[n];
+            for (int8_t k = n - 1; k >= 0; k--){
+                num = num * r[i] + a[k];
+            }
+            den = 1;
+            for (uint8_t j = 0; j < n; j++){
+                if (j != i){
+                    den *= r[i] - r[j];
+                }
+            }
+            r[i] -= num / den;
+        }
+    }
+    // Phase normalization, then -3 dB frequency search (|H(jw)|^2 = prod |p|^2 / |jw - p|^2)
+    for (uint8_t i = 0; i < n; i++){
+        r[i] /= pow(a[0], 1.0 / n);
+    }
+    for (uint8_t it = 0; it < BISECT_ITERATIONS; it++){
+        w = (lo + hi) / 2;
+        mag = 1;
+        for (uint8_t i = 0; i < n; i++){
+            mag *= (creal(r[i]) * creal(r[i]) + cimag(r[i]) * cimag(r[i])) / pow(cabs(I * w - r[i]), 2);
+        }
+        if (mag > 0.5){
+            lo = w;
+        } else {
+            hi = w;
+        }
+    }
+    for (uint8_t i = 0; i < n; i++){
+        if (cimag(r[i]) > 1e-9){
+            poles[m++] = r[i] / lo;
+        } else if (fabs(cimag(r[i])) <= 1e-9){
+            poles[m++] = creal(r[i]) / lo;
+        }
+    }
+    return m;
+}
+
+/**
+ * @brief Analog low pass prototype poles (cut-off at 1 rad/s)
+ * 
+ * @param design    Filter design parameters
+ * @param n         Prototype order
+ * @param poles     Array for the poles in the upper half plane (and the real pole for odd orders)
+ * @param gain      Pass band gain at the reference frequency (below 1 for even Chebyshev filters)
+ * @return uint8_t  Number of poles returned
+ */
+static uint8_t prototype_poles(const iir_design_t * design, uint8_t n, double complex * poles, double * gain){
+    double theta, eps, mu;
+    uint8_t m = (n + 1) / 2;
+    *gain = 1;
+    switch(design->design){
+        case IIR_BUTTERWORTH:
+            for (uint8_t k = 0; k < m; k++){
+                theta = M_PI * (2 * k + 1) / (2 * n);
+                poles[k] = -sin(theta) + I * cos(theta);
+            }
+        break;
+        case IIR_CHEBYSHEV:
+            eps = sqrt(pow(10, design->ripple / 10) - 1);
+            mu = asinh(1 / eps) / n;
+            for (uint8_t k = 0; k < m; k++){
+                theta = M_PI * (2 * k + 1) / (2 * n);
+                poles[k] = -sinh(mu) * sin(theta) + I * cosh(mu) * cos(theta);
+            }
+            // Even orders start the ripple from the bottom: DC gain is 1 / sqrt(1 + eps^2)
+            if (n % 2 == 0){
+                *gain = 1 / sqrt(1 + eps * eps);
+            }
+        break;
+        case IIR_BESSEL:
+            m = bessel_poles(n, poles);
+        break;
+        default:
+            m = 0;
+        break;
+    }
+    return m;
+}
+
+/**
+ * @brief Magnitude response of a 2nd order section
+ * 
+ * @param sos   Section coefficients (b0, b1, b2, a1, a2)
+ * @param w     Frequency (rad/sample)
+ * @return      |H(e^jw)|
+ */
+static double sos_gain(const float * sos, double w){
+    double complex zi = cexp(-I * w);
+    return cabs((sos[0] + sos[1] * zi + sos[2] * zi * zi) / (1 + sos[3] * zi + sos[4] * zi * zi));
+}
+
+/**
+ * @brief Build a 2nd order section from its digital poles, normalized to unity gain at w_ref
+ * 
+ * @param design        Filter design parameters
+ * @param z1            First pole
+ * @param z2            Second pole (conjugate of z1, or real)
+ * @param w_ref         Frequency of unity gain (rad/sample)
+ * @param cos_notch     Cosine of the stop band center (band stop and notch)
+ * @param sos           Section coefficients (b0, b1, b2, a1, a2)
+ */
+static void sos_from_poles(const iir_design_t * design, double complex z1, double complex z2, 
+                           double w_ref, double cos_notch, float * sos){
+    double g;
+    // Zeros: z = -1 (low pass), z = 1 (hi pass), both (band pass), stop band center (band stop)
+    switch(design->type){
+        case IIR_LOW_PASS:
+            sos[0] = 1; sos[1] = 2; sos[2] = 1;
+        break;
+        case IIR_HI_PASS:
+            sos[0] = 1; sos[1] = -2; sos[2] = 1;
+        break;
+        case IIR_BAND_PASS:
+            sos[0] = 1; sos[1] = 0; sos[2] = -1;
+        break;
+        default:
+            sos[0] = 1; sos[1] = -2 * cos_notch; sos[2] = 1;
+        break;
+    }
+    sos[3] = -creal(z1 + z2);
+    sos[4] = creal(z1 * z2);
+    g = sos_gain(sos, w_ref);
+    for (uint8_t j = 0; j < 3; j++){
+        sos[j] /= g;
+    }
+}
+
+/**
+ * @brief Limit the numerator coefficients to SOS_B_LIMIT, moving the excess gain to the other sections
+ * 
+ * Sections above the limit are scaled down to it and their excess gain is spread between the 
+ * sections below it, until no section is above the limit. Each pass leaves one more section at the 
+ * limit, so it ends after k passes at most.
+ * 
+ * @param sos       Sections coefficients
+ * @param k         Number of sections
+ * @return double   Gain that did not fit in the sections (1 if none)
+ */
+static double balance_gain(float sos[][IIR_SOS_COEFF], uint8_t k){
+    double b_max[MAX_PROTO_ORDER / 2];
+    double excess, g;
+    uint8_t n_free;
+    for (uint8_t pass = 0; pass <= k; pass++){
+        excess = 1;
+        n_free = 0;
+        for (uint8_t j = 0; j < k; j++){
+            b_max[j] = fmax(fabs(sos[j][0]), fmax(fabs(sos[j][1]), fabs(sos[j][2])));
+            if (b_max[j] > SOS_B_LIMIT){
+                excess *= b_max[j] / SOS_B_LIMIT;
+                for (uint8_t c = 0; c < 3; c++){
+                    sos[j][c] *= SOS_B_LIMIT / b_max[j];
+                }
+                b_max[j] = SOS_B_LIMIT;
+            }
+            if (b_max[j] < SOS_B_LIMIT * (1 - 1e-6)){
+                n_free++;
+            }
+        }
+        if (excess == 1 || n_free == 0){
+            return excess;
+        }
+        g = pow(excess, 1.0 / n_free);
+        for (uint8_t j = 0; j < k; j++){
+            if (b_max[j] < SOS_B_LIMIT * (1 - 1e-6)){
+                for (uint8_t c = 0; c < 3; c++){
+                    sos[j][c] *= g;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+/*==================[external functions definition]==========================*/
+uint8_t IirDesignSos(const iir_design_t * design, float sos[][IIR_SOS_COEFF], uint8_t max_sections){
+    double complex poles[MAX_PROTO_ORDER / 2 + 1];
+    double complex s, t, r, z1, z2;
+    double w1, w2, w0 = 0, bw = 0, w_ref = 0, cos_notch = 0, gain;
+    uint8_t n_sections = design->order / 2;
+    uint8_t n, m, k = 0;
+    double excess;
+    bool band = (design->type == IIR_BAND_PASS || design->type == IIR_BAND_STOP || design->type == IIR_NOTCH);
+
+    if (design->order == 0 || design->order % 2 != 0 || n_sections > max_sections || design->order > MAX_PROTO_ORDER){
+        return 0;
+    }
+    if (design->cut_frec <= 0 || design->cut_frec >= design->sample_frec / 2){
+        return 0;
+    }
+    if (design->design == IIR_CHEBYSHEV && design->ripple <= 0){
+        return 0;
+    }
+    // Prewarped analog frequencies (bilinear transform s = (z - 1) / (z + 1))
+    w1 = tan(M_PI * design->cut_frec / design->sample_frec);
+    switch(design->type){
+        case IIR_LOW_PASS:
+        case IIR_HI_PASS:
+            w_ref = (design->type == IIR_LOW_PASS) ? 0 : M_PI;
+        break;
+        case IIR_BAND_PASS:
+        case IIR_BAND_STOP:
+            if (design->cut_frec_2 <= design->cut_frec || design->cut_frec_2 >= design->sample_frec / 2){
+                return 0;
+            }
+            w2 = tan(M_PI * design->cut_frec_2 / design->sample_frec);
+            w0 = sqrt(w1 * w2);
+            bw = w2 - w1;
+        break;
+        case IIR_NOTCH:
+            if (design->cut_frec_2 <= 0 || design->cut_frec - design->cut_frec_2 / 2 <= 0 
+                || design->cut_frec + design->cut_frec_2 / 2 >= design->sample_frec / 2){
+                return 0;
+            }
+            w0 = w1;
+            bw = tan(M_PI * (design->cut_frec + design->cut_frec_2 / 2) / design->sample_frec) 
+               - tan(M_PI * (design->cut_frec - design->cut_frec_2 / 2) / design->sample_frec);
+        break;
+        default:
+            return 0;
+    }
+    if (design->type == IIR_BAND_PASS){
+        w_ref = 2 * atan(w0);
+    }
+    cos_notch = cos(2 * atan(w0));
+    // Band filters double the prototype order
+    n = band ? design->order / 2 : design->order;
+    m = prototype_poles(design, n, poles, &gain);
+    if (m == 0){
+        return 0;
+    }
+    for (uint8_t i = 0; i < m; i++){
+        if (!band){
+            s = (design->type == IIR_LOW_PASS) ? w1 * poles[i] : w1 / poles[i];
+            z1 = (1 + s) / (1 - s);
+            sos_from_poles(design, z1, conj(z1), w_ref, cos_notch, sos[k++]);
+            continue;
+        }
+        // Each prototype pole maps to the two roots of s^2 - t s + w0^2 = 0
+        t = (design->type == IIR_BAND_PASS) ? poles[i] * bw : bw / poles[i];
+        r = csqrt(t * t / 4 - w0 * w0);
+        z1 = (1 + (t / 2 + r)) / (1 - (t / 2 + r));
+        z2 = (1 + (t / 2 - r)) / (1 - (t / 2 - r));
+        if (fabs(cimag(poles[i])) > 1e-9){
+            // Complex prototype pole: its conjugate gives the conjugates of z1 and z2.
+            // Band pass sections are normalized at their own peak, to keep coefficients small
+            sos_from_poles(design, z1, conj(z1), (design->type == IIR_BAND_PASS) ? fabs(carg(z1)) : w_ref, 
+                           cos_notch, sos[k++]);
+            sos_from_poles(design, z2, conj(z2), (design->type == IIR_BAND_PASS) ? fabs(carg(z2)) : w_ref, 
+                           cos_notch, sos[k++]);
+        } else {
+            sos_from_poles(design, z1, z2, w_ref, cos_notch, sos[k++]);
+        }
+    }
+    // Pass band gain correction, spread evenly between sections (fixed point friendly)
+    for (uint8_t i = 0; i < k; i++){
+        gain /= sos_gain(sos[i], w_ref);
+    }
+    gain = pow(gain, 1.0 / k);
+    for (uint8_t i = 0; i < k; i++){
+        for (uint8_t j = 0; j < 3; j++){
+            sos[i][j] *= gain;
+        }
+    }
+    // Gain the numerators can not hold (e.g. low cut-off hi pass): pure gain sections at the output
+    excess = balance_gain(sos, k);
+    while (excess > 1 + 1e-6){
+        if (k == max_sections){
+            return 0;
+        }
+        sos[k][0] = fmin(excess, SOS_B_LIMIT);
+        sos[k][1] = sos[k][2] = sos[k][3] = sos[k][4] = 0;
+        excess /= sos[k++][0];
+    }
+    return k;
+}
+
+bool IirDesignInit(iir_filter_t * filter, const iir_design_t * design){
+    // Start from an empty filter (y = x), which is kept if the design fails
+    filter->n_sections = 0;
+    IirFilterReset(filter);
+    return IirDesignAppend(filter, design);
+}
+
+bool IirDesignAppend(iir_filter_t * filter, const iir_design_t * design){
+    uint8_t k = IirDesignSos(design, &filter->coeff[filter->n_sections], IIR_MAX_SECTIONS - filter->n_sections);
+    if (k == 0){
+        return false;
+    }
+    filter->n_sections += k;
+    IirFilterReset(filter);
+    return true;
+}
+
+/*==================[end of file]============================================*/
@@ -11,10 +11,10 @@
 
 /*==================[inclusions]=============================================*/
 #include "iir_filter.h"
+#include <math.h>
+#include <string.h>
 #include "esp_dsp.h"
 /*==================[macros and definitions]=================================*/
-#define N_SOS       5
-#define N_DELAY     2
 // 2nd order Butterworth 
 #define ORDER2_Q    (1 / 1.414)
 // 4th order Butterworth 
@@ -29,128 +29,600 @@
 #define ORDER8_Q2   (1 / 1.111)
 #define ORDER8_Q3   (1 / 1.663)
 #define ORDER8_Q4   (1 / 1.962)
+// Raw ADC codes to fixed point samples
+#define ADC_OFFSET      (1 << (IIR_ADC_BITS - 1))
+#define ADC_MAX         ((1 << IIR_ADC_BITS) - 1)
+#define ADC_SHIFT_Q15   (15 - (IIR_ADC_BITS - 1) - IIR_ADC_GUARD_BITS)
+#define ADC_SHIFT_Q31   (31 - (IIR_ADC_BITS - 1) - IIR_ADC_GUARD_BITS)
 /*==================[internal data declaration]==============================*/
-static uint8_t lp_order, hp_order;
-float hp2_delay[N_DELAY] = {0, 0};  // delay
-float hp4_delay[N_DELAY] = {0, 0};  // delay
-float hp6_delay[N_DELAY] = {0, 0};  // delay
-float hp8_delay[N_DELAY] = {0, 0};  // delay
-float lp2_delay[N_DELAY] = {0, 0};  // delay
-float lp4_delay[N_DELAY] = {0, 0};  // delay
-float lp6_delay[N_DELAY] = {0, 0};  // delay
-float lp8_delay[N_DELAY] = {0, 0};  // delay
-float lp2_sos_coeff[N_SOS]; 
-float lp4_sos_coeff[N_SOS]; 
-float lp6_sos_coeff[N_SOS]; 
-float lp8_sos_coeff[N_SOS]; 
-float hp2_sos_coeff[N_SOS]; 
-float hp4_sos_coeff[N_SOS]; 
-float hp6_sos_coeff[N_SOS]; 
-float hp8_sos_coeff[N_SOS]; 
+static iir_filter_t lp_filter;      /*!< Default low pass filter (LowPassInit, LowPassFilter) */
+static iir_filter_t hp_filter;      /*!< Default hi pass filter (HiPassInit, HiPassFilter) */
 /*==================[internal functions declaration]=========================*/
+static inline void iir_cascade_f32(const float (*coeff)[IIR_SOS_COEFF], float (*delay)[IIR_SOS_DELAY], 
+                                   const float * input, float * output, int16_t lenght, const uint8_t n_sections) __attribute__((always_inline));
+static inline void iir_cascade_q31(const int32_t (*coeff)[IIR_SOS_COEFF], int32_t (*delay)[IIR_SOS_DELAY_Q], 
+                                   const void * input, void * output, int16_t lenght, const uint8_t n_sections, const bool adc) __attribute__((always_inline));
+static inline void iir_cascade_q15(iir_filter_q15_t * filter, const void * input, void * output, 
+                                   int16_t lenght, const uint8_t n_sections, const bool adc) __attribute__((always_inline));
+static void iir_dispatch_f32(const float (*coeff)[IIR_SOS_COEFF], float (*delay)[IIR_SOS_DELAY], 
+                             const float * input, float * output, int16_t lenght, uint8_t n_sections);
+static inline void iir_dispatch_q31(const int32_t (*coeff)[IIR_SOS_COEFF], int32_t (*delay)[IIR_SOS_DELAY_Q], 
+                                    const void * input, void * output, int16_t lenght, uint8_t n_sections, const bool adc) __attribute__((always_inline));
+static inline void iir_dispatch_q15(iir_filter_q15_t * filter, const void * input, void * output, 
+                                    int16_t lenght, uint8_t n_sections, const bool adc) __attribute__((always_inline));
+static inline int32_t sat_q31(int64_t x);
+static inline int16_t sat_q15(int64_t x);
+static inline uint16_t sat_adc(int32_t x);
+static int32_t quantize(float x, uint8_t frac, int32_t max);
+static float steady_state(iir_filter_t * filter, float x);
+static void reverse(float * signal, int32_t lenght);
 
 /*==================[internal data definition]===============================*/
-
+/* Q factor of each section, indexed by order / 2 - 1 */
+static const float butterworth_q[IIR_MAX_SECTIONS][IIR_MAX_SECTIONS] = {
+    {ORDER2_Q},
+    {ORDER4_Q1, ORDER4_Q2},
+    {ORDER6_Q1, ORDER6_Q2, ORDER6_Q3},
+    {ORDER8_Q1, ORDER8_Q2, ORDER8_Q3, ORDER8_Q4}
+};
 /*==================[external data definition]===============================*/
 
 /*==================[internal functions definition]==========================*/
+/**
+ * @brief Single pass cascade of direct form II sections (same state as dsps_biquad_f32)
+ * 
+ * @note Always inlined with a constant number of sections, so loops are unrolled and the 
+ * coefficients and state are kept in registers
+ * 
+ * @param coeff         Coefficients of each section
+ * @param delay         State of each section
+ * @param input         Input signal array
+ * @param output        Filtered signal array
+ * @param lenght        Number of samples
+ * @param n_sections    Number of sections
+ */
+static inline void iir_cascade_f32(const float (*coeff)[IIR_SOS_COEFF], float (*delay)[IIR_SOS_DELAY], 
+                                   const float * input, float * output, int16_t lenght, const uint8_t n_sections){
+    float c[IIR_MAX_SECTIONS][IIR_SOS_COEFF];
+    float w[IIR_MAX_SECTIONS][IIR_SOS_DELAY];
+    float x, d0;
+    for (uint8_t s = 0; s < n_sections; s++){
+        for (uint8_t j = 0; j < IIR_SOS_COEFF; j++){
+            c[s][j] = coeff[s][j];
+        }
+        w[s][0] = delay[s][0];
+        w[s][1] = delay[s][1];
+    }
+    for (int16_t i = 0; i < lenght; i++){
+        x = input[i];
+        for (uint8_t s = 0; s < n_sections; s++){
+            d0 = x - c[s][3] * w[s][0] - c[s][4] * w[s][1];
+            x = c[s][0] * d0 + c[s][1] * w[s][0] + c[s][2] * w[s][1];
+            w[s][1] = w[s][0];
+            w[s][0] = d0;
+        }
+        output[i] = x;
+    }
+    for (uint8_t s = 0; s < n_sections; s++){
+        delay[s][0] = w[s][0];
+        delay[s][1] = w[s][1];
+    }
+}
 
-/*==================[external functions definition]==========================*/
+/**
+ * @brief Saturate a value to the int32_t range
+ * 
+ * @param x     Value
+ * @return      Saturated value
+ */
+static inline int32_t sat_q31(int64_t x){
+    if (x > INT32_MAX){
+        return INT32_MAX;
+    }
+    if (x < INT32_MIN){
+        return INT32_MIN;
+    }
+    return (int32_t)x;
+}
 
-void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
-    float f = cut_frec / sample_frec;
-    lp_order = order;
-    switch(lp_order){
-        case ORDER_2:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER2_Q);
-        break;
-        case ORDER_4:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER4_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER4_Q2);
-        break;
-        case ORDER_6:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER6_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER6_Q2);
-            dsps_biquad_gen_lpf_f32(lp6_sos_coeff, f, ORDER6_Q3);
-        break;
-        case ORDER_8:
-            dsps_biquad_gen_lpf_f32(lp2_sos_coeff, f, ORDER8_Q1);
-            dsps_biquad_gen_lpf_f32(lp4_sos_coeff, f, ORDER8_Q2);
-            dsps_biquad_gen_lpf_f32(lp6_sos_coeff, f, ORDER8_Q3);
-            dsps_biquad_gen_lpf_f32(lp8_sos_coeff, f, ORDER8_Q4);
-        break;
+/**
+ * @brief Saturate a value to the int16_t range
+ * 
+ * @param x     Value
+ * @return      Saturated value
+ */
+static inline int16_t sat_q15(int64_t x){
+    if (x > INT16_MAX){
+        return INT16_MAX;
+    }
+    if (x < INT16_MIN){
+        return INT16_MIN;
     }
+    return (int16_t)x;
 }
 
-void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
-    float f = cut_frec / sample_frec;
-    hp_order = order;
-    switch(hp_order){
-        case ORDER_2:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER2_Q);
+/**
+ * @brief Saturate a value to the ADC codes range
+ * 
+ * @param x     Value
+ * @return      Saturated value
+ */
+static inline uint16_t sat_adc(int32_t x){
+    if (x > ADC_MAX){
+        return ADC_MAX;
+    }
+    if (x < 0){
+        return 0;
+    }
+    return (uint16_t)x;
+}
+
+/**
+ * @brief Quantize a coefficient, saturating to the range [-max - 1, max]
+ * 
+ * @param x     Coefficient
+ * @param frac  Fractional bits
+ * @param max   Largest quantized value
+ * @return      Quantized coefficient
+ */
+static int32_t quantize(float x, uint8_t frac, int32_t max){
+    float c = roundf(ldexpf(x, frac));
+    if (c >= (float)max){
+        return max;
+    }
+    if (c <= -(float)max - 1){
+        return -max - 1;
+    }
+    return (int32_t)c;
+}
+
+/**
+ * @brief Single pass cascade of fixed point direct form I sections (Q30 coefficients)
+ * 
+ * @param coeff         Coefficients of each section (in Q30)
+ * @param delay         State of each section
+ * @param input         Input signal array (int32_t samples, or uint16_t ADC codes if adc)
+ * @param output        Filtered signal array (same type as input)
+ * @param lenght        Number of samples
+ * @param n_sections    Number of sections
+ * @param adc           Samples are raw ADC codes
+ */
+static inline void iir_cascade_q31(const int32_t (*coeff)[IIR_SOS_COEFF], int32_t (*delay)[IIR_SOS_DELAY_Q], 
+                                   const void * input, void * output, int16_t lenght, const uint8_t n_sections, const bool adc){
+    int32_t c[IIR_MAX_SECTIONS][IIR_SOS_COEFF];
+    int32_t d[IIR_MAX_SECTIONS][IIR_SOS_DELAY_Q];
+    int32_t x, y;
+    int64_t acc;
+    for (uint8_t s = 0; s < n_sections; s++){
+        for (uint8_t j = 0; j < IIR_SOS_COEFF; j++){
+            c[s][j] = coeff[s][j];
+        }
+        for (uint8_t j = 0; j < IIR_SOS_DELAY_Q; j++){
+            d[s][j] = delay[s][j];
+        }
+    }
+    for (int16_t i = 0; i < lenght; i++){
+        if (adc){
+            x = ((int32_t)((const uint16_t *)input)[i] - ADC_OFFSET) * (1L << ADC_SHIFT_Q31);
+        } else {
+            x = ((const int32_t *)input)[i];
+        }
+        for (uint8_t s = 0; s < n_sections; s++){
+            // y = b0 * x + b1 * x[n-1] + b2 * x[n-2] - a1 * y[n-1] - a2 * y[n-2], rounded
+            acc = (int64_t)1 << (IIR_COEFF_Q31_FRAC - 1);
+            acc += (int64_t)c[s][0] * x + (int64_t)c[s][1] * d[s][0] + (int64_t)c[s][2] * d[s][1];
+            acc -= (int64_t)c[s][3] * d[s][2] + (int64_t)c[s][4] * d[s][3];
+            y = sat_q31(acc >> IIR_COEFF_Q31_FRAC);
+            d[s][1] = d[s][0];
+            d[s][0] = x;
+            d[s][3] = d[s][2];
+            d[s][2] = y;
+            x = y;
+        }
+        if (adc){
+            ((uint16_t *)output)[i] = sat_adc((((x >> (ADC_SHIFT_Q31 - 1)) + 1) >> 1) + ADC_OFFSET);
+        } else {
+            ((int32_t *)output)[i] = x;
+        }
+    }
+    for (uint8_t s = 0; s < n_sections; s++){
+        for (uint8_t j = 0; j < IIR_SOS_DELAY_Q; j++){
+            delay[s][j] = d[s][j];
+        }
+    }
+}
+
+/**
+ * @brief Single pass cascade of fixed point direct form I sections (Q14 coefficients)
+ * 
+ * @param filter        Fixed point filter instance
+ * @param input         Input signal array (int16_t samples, or uint16_t ADC codes if adc)
+ * @param output        Filtered signal array (same type as input)
+ * @param lenght        Number of samples
+ * @param n_sections    Number of sections
+ * @param adc           Samples are raw ADC codes
+ */
+static inline void iir_cascade_q15(iir_filter_q15_t * filter, const void * input, void * output, 
+                                   int16_t lenght, const uint8_t n_sections, const bool adc){
+    int32_t c[IIR_MAX_SECTIONS][IIR_SOS_COEFF];
+    int32_t d[IIR_MAX_SECTIONS][IIR_SOS_DELAY_Q];
+    int32_t x, y;
+    int64_t acc;
+    for (uint8_t s = 0; s < n_sections; s++){
+        for (uint8_t j = 0; j < IIR_SOS_COEFF; j++){
+            c[s][j] = filter->coeff[s][j];
+        }
+        for (uint8_t j = 0; j < IIR_SOS_DELAY_Q; j++){
+            d[s][j] = filter->delay[s][j];
+        }
+    }
+    for (int16_t i = 0; i < lenght; i++){
+        if (adc){
+            x = ((int32_t)((const uint16_t *)input)[i] - ADC_OFFSET) * (1 << ADC_SHIFT_Q15);
+        } else {
+            x = ((const int16_t *)input)[i];
+        }
+        for (uint8_t s = 0; s < n_sections; s++){
+            // 16x16 bits products (30 bits) fit in 32 bits, the 64 bits sum gives the guard bits
+            acc = (int32_t)1 << (IIR_COEFF_Q15_FRAC - 1);
+            acc += (int64_t)(c[s][0] * x) + (c[s][1] * d[s][0]) + (c[s][2] * d[s][1]);
+            acc -= (int64_t)(c[s][3] * d[s][2]) + (c[s][4] * d[s][3]);
+            y = sat_q15(acc >> IIR_COEFF_Q15_FRAC);
+            d[s][1] = d[s][0];
+            d[s][0] = x;
+            d[s][3] = d[s][2];
+            d[s][2] = y;
+            x = y;
+        }
+        if (adc){
+            ((uint16_t *)output)[i] = sat_adc((((x >> (ADC_SHIFT_Q15 - 1)) + 1) >> 1) + ADC_OFFSET);
+        } else {
+            ((int16_t *)output)[i] = x;
+        }
+    }
+    for (uint8_t s = 0; s < n_sections; s++){
+        for (uint8_t j = 0; j < IIR_SOS_DELAY_Q; j++){
+            filter->delay[s][j] = d[s][j];
+        }
+    }
+}
+
+/**
+ * @brief Float cascade, with the number of sections as a constant for orders 2 to 8 
+ * 
+ * Each case is a copy of iir_cascade_f32() with its sections loop fully unrolled.
+ * 
+ * @param coeff         Coefficients of each section
+ * @param delay         State of each section
+ * @param input         Input signal array
+ * @param output        Filtered signal array
+ * @param lenght        Number of samples
+ * @param n_sections    Number of sections
+ */
+static void iir_dispatch_f32(const float (*coeff)[IIR_SOS_COEFF], float (*delay)[IIR_SOS_DELAY], 
+                             const float * input, float * output, int16_t lenght, uint8_t n_sections){
+    switch(n_sections){
+        case 1:
+            iir_cascade_f32(coeff, delay, input, output, lenght, 1);
+        break;
+        case 2:
+            iir_cascade_f32(coeff, delay, input, output, lenght, 2);
         break;
-        case ORDER_4:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER4_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER4_Q2);
+        case 3:
+            iir_cascade_f32(coeff, delay, input, output, lenght, 3);
         break;
-        case ORDER_6:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER6_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER6_Q2);
-            dsps_biquad_gen_hpf_f32(hp6_sos_coeff, f, ORDER6_Q3);
+        case 4:
+            iir_cascade_f32(coeff, delay, input, output, lenght, 4);
         break;
-        case ORDER_8:
-            dsps_biquad_gen_hpf_f32(hp2_sos_coeff, f, ORDER8_Q1);
-            dsps_biquad_gen_hpf_f32(hp4_sos_coeff, f, ORDER8_Q2);
-            dsps_biquad_gen_hpf_f32(hp6_sos_coeff, f, ORDER8_Q3);
-            dsps_biquad_gen_hpf_f32(hp8_sos_coeff, f, ORDER8_Q4);
+        default:
+            iir_cascade_f32(coeff, delay, input, output, lenght, n_sections);
         break;
     }
 }
 
-void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
-    switch(lp_order){
-        case ORDER_2:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
+/**
+ * @brief Fixed point (Q31) cascade, with the number of sections as a constant for orders 2 to 8 
+ * 
+ * Inlined in each caller, so adc is also a constant there.
+ * 
+ * @param coeff         Coefficients of each section (in Q30)
+ * @param delay         State of each section
+ * @param input         Input signal array (int32_t samples, or uint16_t ADC codes if adc)
+ * @param output        Filtered signal array (same type as input)
+ * @param lenght        Number of samples
+ * @param n_sections    Number of sections
+ * @param adc           Samples are raw ADC codes
+ */
+static inline void iir_dispatch_q31(const int32_t (*coeff)[IIR_SOS_COEFF], int32_t (*delay)[IIR_SOS_DELAY_Q], 
+                                    const void * input, void * output, int16_t lenght, uint8_t n_sections, const bool adc){
+    switch(n_sections){
+        case 1:
+            iir_cascade_q31(coeff, delay, input, output, lenght, 1, adc);
+        break;
+        case 2:
+            iir_cascade_q31(coeff, delay, input, output, lenght, 2, adc);
         break;
-        case ORDER_4:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
+        case 3:
+            iir_cascade_q31(coeff, delay, input, output, lenght, 3, adc);
         break;
-        case ORDER_6:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp6_sos_coeff, lp6_delay);
+        case 4:
+            iir_cascade_q31(coeff, delay, input, output, lenght, 4, adc);
         break;
-        case ORDER_8:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, lp2_sos_coeff, lp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp4_sos_coeff, lp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp6_sos_coeff, lp6_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, lp8_sos_coeff, lp8_delay);
+        default:
+            iir_cascade_q31(coeff, delay, input, output, lenght, n_sections, adc);
         break;
     }
 }
 
-void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
-    switch(hp_order){
-        case ORDER_2:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
+/**
+ * @brief Fixed point (Q15) cascade, with the number of sections as a constant for orders 2 to 8 
+ * 
+ * Inlined in each caller, so adc is also a constant there.
+ * 
+ * @param filter        Fixed point filter instance
+ * @param input         Input signal array (int16_t samples, or uint16_t ADC codes if adc)
+ * @param output        Filtered signal array (same type as input)
+ * @param lenght        Number of samples
+ * @param n_sections    Number of sections
+ * @param adc           Samples are raw ADC codes
+ */
+static inline void iir_dispatch_q15(iir_filter_q15_t * filter, const void * input, void * output, 
+                                    int16_t lenght, uint8_t n_sections, const bool adc){
+    switch(n_sections){
+        case 1:
+            iir_cascade_q15(filter, input, output, lenght, 1, adc);
         break;
-        case ORDER_4:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
+        case 2:
+            iir_cascade_q15(filter, input, output, lenght, 2, adc);
         break;
-        case ORDER_6:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp6_sos_coeff, hp6_delay);
+        case 3:
+            iir_cascade_q15(filter, input, output, lenght, 3, adc);
         break;
-        case ORDER_8:
-            dsps_biquad_f32(input_signal, output_signal, signal_lenght, hp2_sos_coeff, hp2_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp4_sos_coeff, hp4_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp6_sos_coeff, hp6_delay);
-            dsps_biquad_f32(output_signal, output_signal, signal_lenght, hp8_sos_coeff, hp8_delay);
+        case 4:
+            iir_cascade_q15(filter, input, output, lenght, 4, adc);
         break;
+        default:
+            iir_cascade_q15(filter, input, output, lenght, n_sections, adc);
+        break;
+    }
+}
+
+/**
+ * @brief Set the state of a filter to its steady state for a constant input
+ * 
+ * @param filter    Filter instance
+ * @param x         Input value
+ * @return float    Steady state output
+ */
+static float steady_state(iir_filter_t * filter, float x){
+    float d;
+    for (uint8_t s = 0; s < filter->n_sections; s++){
+        // Direct form II: d = x - a1 * d - a2 * d, output (b0 + b1 + b2) * d feeds the next section
+        d = x / (1 + filter->coeff[s][3] + filter->coeff[s][4]);
+        filter->delay[s][0] = d;
+        filter->delay[s][1] = d;
+        x = d * (filter->coeff[s][0] + filter->coeff[s][1] + filter->coeff[s][2]);
     }
+    return x;
+}
+
+/**
+ * @brief Reverse a signal array in place
+ * 
+ * @param signal    Signal array
+ * @param lenght    Number of samples
+ */
+static void reverse(float * signal, int32_t lenght){
+    float aux;
+    for (int32_t i = 0; i < lenght / 2; i++){
+        aux = signal[i];
+        signal[i] = signal[lenght - 1 - i];
+        signal[lenght - 1 - i] = aux;
+    }
+}
+
+/*==================[external functions definition]==========================*/
+bool IirFilterInit(iir_filter_t * filter, filter_type_t type, float sample_frec, float cut_frec, filter_order_t order){
+    float f = cut_frec / sample_frec;
+    if (order != ORDER_2 && order != ORDER_4 && order != ORDER_6 && order != ORDER_8){
+        return false;
+    }
+    if (type != IIR_LOW_PASS && type != IIR_HI_PASS){
+        return false;
+    }
+    filter->n_sections = order / 2;
+    for (uint8_t i = 0; i < filter->n_sections; i++){
+        if (type == IIR_LOW_PASS){
+            dsps_biquad_gen_lpf_f32(filter->coeff[i], f, butterworth_q[filter->n_sections - 1][i]);
+        } else {
+            dsps_biquad_gen_hpf_f32(filter->coeff[i], f, butterworth_q[filter->n_sections - 1][i]);
+        }
+    }
+    IirFilterReset(filter);
+    return true;
+}
+
+void IirFilterProcess(iir_filter_t * filter, float * input_signal, float * output_signal, int16_t signal_lenght){
+    iir_dispatch_f32(filter->coeff, filter->delay, input_signal, output_signal, signal_lenght, filter->n_sections);
+}
+
+void IirFilterReset(iir_filter_t * filter){
+    for (uint8_t i = 0; i < IIR_MAX_SECTIONS; i++){
+        filter->delay[i][0] = 0;
+        filter->delay[i][1] = 0;
+    }
+}
+
+bool IirFilterFiltfilt(iir_filter_t * filter, const float * input_signal, float * output_signal, int16_t signal_lenght, float * scratch){
+    float delay[IIR_MAX_SECTIONS][IIR_SOS_DELAY];
+    float offset, gain;
+    int16_t pad = 3 * (2 * filter->n_sections + 1);
+    int32_t lenght;
+    if (signal_lenght < 2){
+        return false;
+    }
+    if (pad >= signal_lenght){
+        pad = signal_lenght - 1;
+    }
+    lenght = signal_lenght + 2 * pad;
+    // The first sample is removed and added back times the squared DC gain (the filter is linear): 
+    // keeps the float states small for low cutoff sections when the signal has a large offset (ADC codes)
+    offset = input_signal[0];
+    // Odd reflection at both ends: 2 * x[0] - x[pad..1] | x | 2 * x[n-1] - x[n-2..n-1-pad]
+    for (int16_t i = 0; i < pad; i++){
+        scratch[i] = offset - input_signal[pad - i];
+        scratch[pad + signal_lenght + i] = 2 * input_signal[signal_lenght - 1] - input_signal[signal_lenght - 2 - i] - offset;
+    }
+    for (int16_t i = 0; i < signal_lenght; i++){
+        scratch[pad + i] = input_signal[i] - offset;
+    }
+    memcpy(delay, filter->delay, sizeof(delay));
+    gain = steady_state(filter, 1);
+    offset *= gain * gain;
+    // Forward pass, then backward pass over the reversed output
+    steady_state(filter, scratch[0]);
+    IirFilterProcess(filter, scratch, scratch, lenght);
+    reverse(scratch, lenght);
+    steady_state(filter, scratch[0]);
+    IirFilterProcess(filter, scratch, scratch, lenght);
+    for (int16_t i = 0; i < signal_lenght; i++){
+        output_signal[i] = scratch[lenght - 1 - pad - i] + offset;
+    }
+    memcpy(filter->delay, delay, sizeof(delay));
+    return true;
+}
+
+void IirFilterToQ31(const iir_filter_t * filter, iir_filter_q31_t * filter_q31){
+    filter_q31->n_sections = filter->n_sections;
+    for (uint8_t i = 0; i < filter->n_sections; i++){
+        for (uint8_t j = 0; j < IIR_SOS_COEFF; j++){
+            filter_q31->coeff[i][j] = quantize(filter->coeff[i][j], IIR_COEFF_Q31_FRAC, INT32_MAX);
+        }
+    }
+    IirFilterResetQ31(filter_q31);
+}
+
+bool IirFilterInitQ31(iir_filter_q31_t * filter, filter_type_t type, float sample_frec, float cut_frec, filter_order_t order){
+    iir_filter_t design;
+    if (!IirFilterInit(&design, type, sample_frec, cut_frec, order)){
+        return false;
+    }
+    IirFilterToQ31(&design, filter);
+    return true;
+}
+
+void IirFilterProcessQ31(iir_filter_q31_t * filter, int32_t * input_signal, int32_t * output_signal, int16_t signal_lenght){
+    iir_dispatch_q31(filter->coeff, filter->delay, input_signal, output_signal, signal_lenght, filter->n_sections, false);
+}
+
+void IirFilterProcessAdcQ31(iir_filter_q31_t * filter, uint16_t * input_signal, uint16_t * output_signal, int16_t signal_lenght){
+    iir_dispatch_q31(filter->coeff, filter->delay, input_signal, output_signal, signal_lenght, filter->n_sections, true);
+}
+
+void IirFilterResetQ31(iir_filter_q31_t * filter){
+    for (uint8_t i = 0; i < IIR_MAX_SECTIONS; i++){
+        for (uint8_t j = 0; j < IIR_SOS_DELAY_Q; j++){
+            filter->delay[i][j] = 0;
+        }
+    }
+}
+
+void IirFilterToQ15(const iir_filter_t * filter, iir_filter_q15_t * filter_q15){
+    filter_q15->n_sections = filter->n_sections;
+    for (uint8_t i = 0; i < filter->n_sections; i++){
+        for (uint8_t j = 0; j < IIR_SOS_COEFF; j++){
+            filter_q15->coeff[i][j] = quantize(filter->coeff[i][j], IIR_COEFF_Q15_FRAC, INT16_MAX);
+        }
+    }
+    IirFilterResetQ15(filter_q15);
+}
+
+bool IirFilterInitQ15(iir_filter_q15_t * filter, filter_type_t type, float sample_frec, float cut_frec, filter_order_t order){
+    iir_filter_t design;
+    if (!IirFilterInit(&design, type, sample_frec, cut_frec, order)){
+        return false;
+    }
+    IirFilterToQ15(&design, filter);
+    return true;
+}
+
+void IirFilterProcessQ15(iir_filter_q15_t * filter, int16_t * input_signal, int16_t * output_signal, int16_t signal_lenght){
+    iir_dispatch_q15(filter, input_signal, output_signal, signal_lenght, filter->n_sections, false);
+}
+
+void IirFilterProcessAdcQ15(iir_filter_q15_t * filter, uint16_t * input_signal, uint16_t * output_signal, int16_t signal_lenght){
+    iir_dispatch_q15(filter, input_signal, output_signal, signal_lenght, filter->n_sections, true);
+}
+
+void IirFilterResetQ15(iir_filter_q15_t * filter){
+    for (uint8_t i = 0; i < IIR_MAX_SECTIONS; i++){
+        for (uint8_t j = 0; j < IIR_SOS_DELAY_Q; j++){
+            filter->delay[i][j] = 0;
+        }
+    }
+}
+
+bool IirFilterInitConst(iir_filter_const_t * filter, const float (*coeff)[IIR_SOS_COEFF], uint8_t n_sections){
+    if (n_sections == 0 || n_sections > IIR_MAX_SECTIONS){
+        return false;
+    }
+    filter->coeff = coeff;
+    filter->n_sections = n_sections;
+    IirFilterResetConst(filter);
+    return true;
+}
+
+void IirFilterProcessConst(iir_filter_const_t * filter, float * input_signal, float * output_signal, int16_t signal_lenght){
+    iir_dispatch_f32(filter->coeff, filter->delay, input_signal, output_signal, signal_lenght, filter->n_sections);
+}
+
+void IirFilterResetConst(iir_filter_const_t * filter){
+    for (uint8_t i = 0; i < IIR_MAX_SECTIONS; i++){
+        filter->delay[i][0] = 0;
+        filter->delay[i][1] = 0;
+    }
+}
+
+bool IirFilterInitConstQ31(iir_filter_const_q31_t * filter, const int32_t (*coeff)[IIR_SOS_COEFF], uint8_t n_sections){
+    if (n_sections == 0 || n_sections > IIR_MAX_SECTIONS){
+        return false;
+    }
+    filter->coeff = coeff;
+    filter->n_sections = n_sections;
+    IirFilterResetConstQ31(filter);
+    return true;
+}
+
+void IirFilterProcessConstQ31(iir_filter_const_q31_t * filter, int32_t * input_signal, int32_t * output_signal, int16_t signal_lenght){
+    iir_dispatch_q31(filter->coeff, filter->delay, input_signal, output_signal, signal_lenght, filter->n_sections, false);
+}
+
+void IirFilterProcessAdcConstQ31(iir_filter_const_q31_t * filter, uint16_t * input_signal, uint16_t * output_signal, int16_t signal_lenght){
+    iir_dispatch_q31(filter->coeff, filter->delay, input_signal, output_signal, signal_lenght, filter->n_sections, true);
+}
+
+void IirFilterResetConstQ31(iir_filter_const_q31_t * filter){
+    for (uint8_t i = 0; i < IIR_MAX_SECTIONS; i++){
+        for (uint8_t j = 0; j < IIR_SOS_DELAY_Q; j++){
+            filter->delay[i][j] = 0;
+        }
+    }
+}
+
+void LowPassInit(float sample_frec, float cut_frec, filter_order_t order){
+    IirFilterInit(&lp_filter, IIR_LOW_PASS, sample_frec, cut_frec, order);
+}
+
+void HiPassInit(float sample_frec, float cut_frec, filter_order_t order){
+    IirFilterInit(&hp_filter, IIR_HI_PASS, sample_frec, cut_frec, order);
+}
+
+void LowPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
+    IirFilterProcess(&lp_filter, input_signal, output_signal, signal_lenght);
+}
+
+void HiPassFilter(float * input_signal, float * output_signal, int16_t signal_lenght){
+    IirFilterProcess(&hp_filter, input_signal, output_signal, signal_lenght);
 }
 
 /*==================[end of file]============================================*/
\ No newline at end of file
@@ -0,0 +1,283 @@
+/**
+ * @file periodicity.c
+ * @brief Autocorrelation based period (rate) estimator
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "periodicity.h"
+#include <string.h>
+#include <math.h>
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+#define DC_CUT_RATIO    4       /*!< min_freq / DC blocker cut-off frequency */
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+static void correlate_direct(periodicity_t * period);
+static void correlate_fft(periodicity_t * period);
+static float refine_peak(float * r, uint16_t k, float * lag);
+static void estimate_period(periodicity_t * period, periodicity_estimate_t * estimate);
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Update the autocorrelation of the window with dsps_corr_f32
+ * 
+ * The window is the last lenght samples of the history. When less than a window has passed
+ * since the last full calculation, only the products of the hop samples entering the window
+ * are added and the ones of the hop samples leaving it are subtracted.
+ * 
+ * @param period    Periodicity estimator instance
+ */
+static void correlate_direct(periodicity_t * period){
+    float * h = period->history;
+    uint16_t n = period->keep + period->hop;
+    uint16_t len = period->lenght;
+    uint16_t hop = period->hop;
+    uint16_t lags = period->lag_hi - period->lag_lo;
+    float energy;
+    // dsps_corr_f32 output i is the lag_hi - i correlation
+    if (period->since_sync >= len || 2 * hop >= len){
+        dsps_corr_f32(&h[n - len - period->lag_hi], len + lags, &h[n - len], len, period->work);
+        for (uint16_t i = 0; i <= lags; i++){
+            period->corr[period->lag_hi - i] = period->work[i];
+        }
+        dsps_dotprod_f32(&h[n - len], &h[n - len], &period->corr0, len);
+        period->since_sync = 0;
+        return;
+    }
+    // Samples entering the window
+    dsps_corr_f32(&h[n - hop - period->lag_hi], hop + lags, &h[n - hop], hop, period->work);
+    for (uint16_t i = 0; i <= lags; i++){
+        period->corr[period->lag_hi - i] += period->work[i];
+    }
+    dsps_dotprod_f32(&h[n - hop], &h[n - hop], &energy, hop);
+    period->corr0 += energy;
+    // Samples leaving the window
+    dsps_corr_f32(&h[n - len - hop - period->lag_hi], hop + lags, &h[n - len - hop], hop, period->work);
+    for (uint16_t i = 0; i <= lags; i++){
+        period->corr[period->lag_hi - i] -= period->work[i];
+    }
+    dsps_dotprod_f32(&h[n - len - hop], &h[n - len - hop], &energy, hop);
+    period->corr0 -= energy;
+    period->since_sync += hop;
+}
+
+/**
+ * @brief Calculate the autocorrelation of the window with the FFT
+ * 
+ * Correlates the last fft_lenght samples (a) with the window (b, the last lenght samples), as a
+ * circular correlation: c[i] = sum(a[i + m] * b[m]) is exact for i <= fft_lenght - lenght, and
+ * c[fft_lenght - lenght - lag] is the autocorrelation at lag. Both real sequences are
+ * transformed with one complex FFT (a as real part, b as imaginary part) and the inverse FFT is
+ * calculated as conj(FFT(conj(C))) / N, keeping only its real part.
+ * 
+ * @param period    Periodicity estimator instance
+ */
+static void correlate_fft(periodicity_t * period){
+    fc32_t * z = (fc32_t *)period->work;
+    uint16_t n = period->fft_lenght;
+    uint16_t len = period->lenght;
+    float * a = &period->history[period->keep + period->hop - n];
+    float * b = &period->history[period->keep + period->hop - len];
+    float scale = 1.0f / (4 * n);
+    fc32_t u, v, c;
+    for (uint16_t i = 0; i < n; i++){
+        z[i].re = a[i];
+        z[i].im = (i < len) ? b[i] : 0;
+    }
+    dsps_fft2r_fc32(period->work, n);
+    dsps_bit_rev_fc32(period->work, n);
+    // A[k] = (Z[k] + Z*[N-k]) / 2, B[k] = (Z[k] - Z*[N-k]) / 2j, C[k] = A[k] * B*[k] = j * u * v / 4
+    // with u = Z[k] + Z*[N-k] and v = (Z[k] - Z*[N-k])*. C is hermitian, conj(C) is stored.
+    for (uint16_t k = 0; k <= n / 2; k++){
+        u.re = z[k].re + z[(n - k) % n].re;
+        u.im = z[k].im - z[(n - k) % n].im;
+        v.re = z[k].re - z[(n - k) % n].re;
+        v.im = -(z[k].im + z[(n - k) % n].im);
+        c.re = -(u.re * v.im + u.im * v.re) * scale;
+        c.im = (u.re * v.re - u.im * v.im) * scale;
+        z[k].re = c.re;
+        z[k].im = -c.im;
+        if (k != 0 && k != n / 2){
+            z[n - k] = c;
+        }
+    }
+    dsps_fft2r_fc32(period->work, n);
+    dsps_bit_rev_fc32(period->work, n);
+    for (uint16_t lag = period->lag_lo; lag <= period->lag_hi; lag++){
+        period->corr[lag] = z[n - len - lag].re;
+    }
+    period->corr0 = z[n - len].re;
+}
+
+/**
+ * @brief Parabolic interpolation of an autocorrelation maximum
+ * 
+ * @param r         Autocorrelation, indexed by lag
+ * @param k         Lag of the local maximum
+ * @param lag       Interpolated lag of the maximum
+ * @return float    Interpolated autocorrelation at the maximum
+ */
+static float refine_peak(float * r, uint16_t k, float * lag){
+    float d = r[k - 1] - 2 * r[k] + r[k + 1];
+    float delta;
+    *lag = k;
+    if (d >= 0){
+        return r[k];
+    }
+    delta = 0.5f * (r[k - 1] - r[k + 1]) / d;
+    *lag += delta;
+    return r[k] - 0.25f * (r[k - 1] - r[k + 1]) * delta;
+}
+
+/**
+ * @brief Find the period in the autocorrelation
+ * 
+ * Local maxima are compared by their interpolated values, as narrow pulses give sharp maxima
+ * that integer lags can miss by a large amount.
+ * 
+ * @param period    Periodicity estimator instance
+ * @param estimate  Period estimate
+ */
+static void estimate_period(periodicity_t * period, periodicity_estimate_t * estimate){
+    float * r = period->corr;
+    float max = 0, value, lag = 0, peak_lag;
+    estimate->period = 0;
+    estimate->freq = 0;
+    estimate->confidence = 0;
+    if (period->corr0 <= 0){
+        return;
+    }
+    // Highest local maximum
+    for (uint16_t k = period->lag_lo + 1; k < period->lag_hi; k++){
+        if (r[k] > r[k - 1] && r[k] >= r[k + 1]){
+            value = refine_peak(r, k, &peak_lag);
+            if (value > max){
+                max = value;
+            }
+        }
+    }
+    if (max <= 0){
+        return;
+    }
+    // First lobe with a local maximum close to the highest one (the next ones are multiples of
+    // the period), at its highest maximum (noise can split a lobe in several maxima)
+    for (uint16_t k = period->lag_lo + 1; k < period->lag_hi; k++){
+        if (r[k] > r[k - 1] && r[k] >= r[k + 1]){
+            value = refine_peak(r, k, &peak_lag);
+            if (value >= PERIODICITY_PEAK_RATIO * max){
+                max = value;
+                lag = peak_lag;
+                for (k++; k < period->lag_hi && r[k] > 0; k++){
+                    if (r[k] > r[k - 1] && r[k] >= r[k + 1]){
+                        value = refine_peak(r, k, &peak_lag);
+                        if (value > max){
+                            max = value;
+                            lag = peak_lag;
+                        }
+                    }
+                }
+                break;
+            }
+        }
+    }
+    estimate->period = lag / period->sample_freq;
+    estimate->freq = period->sample_freq / lag;
+    estimate->confidence = max / period->corr0;
+    if (estimate->confidence > 1){
+        estimate->confidence = 1;
+    }
+}
+
+/*==================[external functions definition]==========================*/
+bool PeriodicityInit(periodicity_t * period, periodicity_config_t * config, float * buffer){
+    uint16_t lag_min, lag_max, n;
+    if (config->sample_freq <= 0 || config->min_freq <= 0 || config->max_freq <= config->min_freq ||
+        config->max_freq > config->sample_freq / 4 || config->lenght == 0 || config->hop == 0){
+        return false;
+    }
+    lag_min = config->sample_freq / config->max_freq;
+    lag_max = ceilf(config->sample_freq / config->min_freq);
+    period->sample_freq = config->sample_freq;
+    period->lenght = config->lenght;
+    period->hop = config->hop;
+    period->fft_lenght = config->fft_lenght;
+    period->lag_lo = lag_min - 1;
+    period->lag_hi = lag_max + 1;
+    period->dc_pole = 1 - 2 * M_PI * config->min_freq / DC_CUT_RATIO / config->sample_freq;
+    if (config->fft_lenght == 0){
+        // buffer layout: history (lenght + lag_hi + hop) | autocorrelation (lag_hi + 1) | dsps_corr_f32 output
+        period->keep = config->lenght + period->lag_hi;
+        period->history = buffer;
+        period->corr = &buffer[period->keep + period->hop];
+        period->work = &period->corr[period->lag_hi + 1];
+    } else {
+        n = config->fft_lenght;
+        if (!dsp_is_power_of_two(n) || n > MAX_SIGNAL_LENGHT || n < config->lenght + period->lag_hi + 1){
+            return false;
+        }
+        // buffer layout: history (fft_lenght + hop) | autocorrelation (lag_hi + 1) | FFT workspace (2 * fft_lenght)
+        period->keep = n;
+        period->history = buffer;
+        period->corr = &buffer[n + period->hop];
+        period->work = &period->corr[period->lag_hi + 1];
+    }
+    PeriodicityReset(period);
+    return true;
+}
+
+bool PeriodicityProcess(periodicity_t * period, const float * input, uint16_t lenght, periodicity_estimate_t * estimate){
+    bool estimated = false;
+    float y;
+    for (uint16_t i = 0; i < lenght; i++){
+        if (period->filled == 0 && period->count == 0){
+            // DC blocker starts at the first sample (no step from zero)
+            period->dc_x = input[i];
+        }
+        // DC blocker: y[n] = x[n] - x[n-1] + pole * y[n-1]
+        y = input[i] - period->dc_x + period->dc_pole * period->dc_y;
+        period->dc_x = input[i];
+        period->dc_y = y;
+        period->history[period->keep + period->count] = y;
+        if (++period->count < period->hop){
+            continue;
+        }
+        period->count = 0;
+        if (period->fft_lenght == 0){
+            correlate_direct(period);
+        }
+        if (period->filled < period->keep){
+            period->filled += period->hop;
+        }
+        if (period->filled >= period->keep){
+            if (period->fft_lenght != 0){
+                correlate_fft(period);
+            }
+            estimate_period(period, estimate);
+            estimated = true;
+        }
+        memmove(period->history, &period->history[period->hop], period->keep * sizeof(float));
+    }
+    return estimated;
+}
+
+void PeriodicityReset(periodicity_t * period){
+    memset(period->history, 0, (period->keep + period->hop) * sizeof(float));
+    memset(period->corr, 0, (period->lag_hi + 1) * sizeof(float));
+    period->corr0 = 0;
+    period->dc_x = 0;
+    period->dc_y = 0;
+    period->count = 0;
+    period->filled = 0;
+    period->since_sync = 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,275 @@
+/**
+ * @file qrs_detector.c
+ * @brief Streaming QRS detector and heart rate (Pan-Tompkins)
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "qrs_detector.h"
+#include <string.h>
+/*==================[macros and definitions]=================================*/
+#define SQUARE_SHIFT    8       /*!< Shift of the squared derivative (keeps the integration in 32 bits) */
+#define DERIV_MAX       65535   /*!< Derivative clip (squared value fits in 32 bits) */
+#define LEARN_TIME      2UL     /*!< Learning phase (s) */
+#define REFRACTORY_MS   200     /*!< Minimum RR interval (ms) */
+#define T_WAVE_MS       360     /*!< RR interval below which a peak can be a T wave (ms) */
+#define RR_LOW          92      /*!< Regular RR interval lower limit (% of the average) */
+#define RR_HIGH         116     /*!< Regular RR interval upper limit (% of the average) */
+#define RR_MISSED       166     /*!< RR interval after which a beat is searched back (% of the average) */
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+static uint32_t rr_average(uint32_t * rr);
+static void report_beat(qrs_detector_t * qrs, uint32_t r_sample, uint32_t slope, qrs_beat_t * beat);
+static uint32_t level_update(uint32_t level, uint32_t peak, uint8_t weight);
+static void threshold_update(qrs_detector_t * qrs);
+static bool classify_peak(qrs_detector_t * qrs, qrs_beat_t * beat);
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Average of QRS_RR_AVG RR intervals
+ * 
+ * @param rr        RR intervals array
+ * @return uint32_t Average RR interval
+ */
+static uint32_t rr_average(uint32_t * rr){
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < QRS_RR_AVG; i++){
+        sum += rr[i];
+    }
+    return sum / QRS_RR_AVG;
+}
+
+/**
+ * @brief Register a QRS: RR averages, heart rate and beat report
+ * 
+ * @param qrs       QRS detector instance
+ * @param r_sample  Sample index of the R peak
+ * @param slope     Maximum slope of the QRS
+ * @param beat      Detected beat
+ */
+static void report_beat(qrs_detector_t * qrs, uint32_t r_sample, uint32_t slope, qrs_beat_t * beat){
+    uint32_t rr = 0;
+    beat->heart_rate = 0;
+    if (qrs->last_r != 0){
+        rr = r_sample - qrs->last_r;
+        qrs->rr[qrs->rr_pos] = rr;
+        qrs->rr_pos = (qrs->rr_pos + 1) % QRS_RR_AVG;
+        qrs->rr_avg = rr_average(qrs->rr);
+        if (rr * 100 >= qrs->rr_regular_avg * RR_LOW && rr * 100 <= qrs->rr_regular_avg * RR_HIGH){
+            qrs->rr_regular[qrs->rr_regular_pos] = rr;
+            qrs->rr_regular_pos = (qrs->rr_regular_pos + 1) % QRS_RR_AVG;
+            qrs->rr_regular_avg = rr_average(qrs->rr_regular);
+        } else {
+            // Irregular rhythm: the regular average follows the recent one
+            memcpy(qrs->rr_regular, qrs->rr, sizeof(qrs->rr));
+            qrs->rr_regular_pos = qrs->rr_pos;
+            qrs->rr_regular_avg = qrs->rr_avg;
+        }
+        beat->heart_rate = (60UL * qrs->sample_freq + rr / 2) / rr;
+    }
+    beat->r_sample = r_sample;
+    beat->rr = rr;
+    qrs->last_r = r_sample;
+    qrs->last_slope = slope;
+    qrs->cand_peak = 0;
+}
+
+/**
+ * @brief Running average of a peaks level (64 bit, integrated peaks reach 7e8 at full scale)
+ * 
+ * @param level     Current level
+ * @param peak      New peak
+ * @param weight    The new peak has 1 / weight of the result
+ * @return uint32_t Updated level
+ */
+static uint32_t level_update(uint32_t level, uint32_t peak, uint8_t weight){
+    return (peak + (uint64_t)(weight - 1) * level) / weight;
+}
+
+/**
+ * @brief Detection threshold from the signal and noise levels (noise can be above signal)
+ * 
+ * @param qrs       QRS detector instance
+ */
+static void threshold_update(qrs_detector_t * qrs){
+    qrs->threshold = qrs->npk + ((int64_t)qrs->spk - qrs->npk) / 4;
+}
+
+/**
+ * @brief Classify the current integrated signal peak as QRS or noise, updating the levels
+ * 
+ * @param qrs       QRS detector instance
+ * @param beat      Detected beat
+ * @return true     The peak is a QRS
+ * @return false    Noise peak, T wave or refractory period
+ */
+static bool classify_peak(qrs_detector_t * qrs, qrs_beat_t * beat){
+    uint32_t peak = qrs->peak;
+    uint32_t start = qrs->peak_n - qrs->mwi_len - 4;
+    uint32_t r = start, slope = 0, max = 0, aux;
+    int32_t v, prev = qrs->ring[start % QRS_RING];
+    bool qrs_found = false;
+    // R peak (largest band-pass value) and maximum slope within the integration window
+    for (uint32_t i = start + 1; i <= qrs->peak_n; i++){
+        v = qrs->ring[i % QRS_RING];
+        aux = (v < 0) ? -v : v;
+        if (aux > max){
+            max = aux;
+            r = i;
+        }
+        aux = (v > prev) ? v - prev : prev - v;
+        if (aux > slope){
+            slope = aux;
+        }
+        prev = v;
+    }
+    r -= qrs->bp_delay;
+    // Refractory period: same QRS or too close to the last one
+    if (qrs->last_r != 0 && (int32_t)(r - qrs->last_r) < REFRACTORY_MS * qrs->sample_freq / 1000){
+        return false;
+    }
+    if (peak > qrs->threshold){
+        if (qrs->last_r != 0 && r - qrs->last_r < T_WAVE_MS * qrs->sample_freq / 1000 && slope < qrs->last_slope / 2){
+            // T wave: close to the last QRS and with less than half its slope
+            qrs->npk = level_update(qrs->npk, peak, 8);
+        } else {
+            qrs->spk = level_update(qrs->spk, peak, 8);
+            report_beat(qrs, r, slope, beat);
+            qrs_found = true;
+        }
+    } else {
+        qrs->npk = level_update(qrs->npk, peak, 8);
+        if (peak > qrs->threshold / 2 && peak > qrs->cand_peak){
+            qrs->cand_peak = peak;
+            qrs->cand_r = r;
+            qrs->cand_slope = slope;
+        }
+    }
+    threshold_update(qrs);
+    return qrs_found;
+}
+
+/*==================[external functions definition]==========================*/
+bool QrsDetectorInit(qrs_detector_t * qrs, uint16_t sample_freq){
+    if (sample_freq < QRS_MIN_FREQ || sample_freq > QRS_MAX_FREQ){
+        return false;
+    }
+    memset(qrs, 0, sizeof(qrs_detector_t));
+    qrs->sample_freq = sample_freq;
+    // Pan-Tompkins filters lenghts (defined at 200 Hz) scaled with the sample frequency
+    qrs->lp_len = (6 * sample_freq + 100) / 200;
+    qrs->hp_len = ((32 * sample_freq + 100) / 200) | 1;
+    qrs->mwi_len = (15 * sample_freq + 50) / 100;
+    // Two moving sums of lp_len (lp_len - 1) and centered high pass ((hp_len - 1) / 2)
+    qrs->bp_delay = (qrs->lp_len - 1) + (qrs->hp_len - 1) / 2;
+    for (uint8_t i = 0; i < QRS_RR_AVG; i++){
+        qrs->rr[i] = sample_freq;
+        qrs->rr_regular[i] = sample_freq;
+    }
+    qrs->rr_avg = sample_freq;
+    qrs->rr_regular_avg = sample_freq;
+    return true;
+}
+
+bool QrsDetectorPush(qrs_detector_t * qrs, int16_t sample, qrs_beat_t * beat){
+    uint32_t n = qrs->n++;
+    int32_t lp, hp, deriv;
+    uint32_t slope, mwi;
+    bool found;
+    // Low pass: (1 - z^-L)^2 / (1 - z^-1)^2, normalized to unity gain
+    qrs->lp_sum1 += sample - qrs->lp_x[qrs->lp_pos];
+    qrs->lp_x[qrs->lp_pos] = sample;
+    qrs->lp_sum2 += qrs->lp_sum1 - qrs->lp_s[qrs->lp_pos];
+    qrs->lp_s[qrs->lp_pos] = qrs->lp_sum1;
+    if (++qrs->lp_pos == qrs->lp_len){
+        qrs->lp_pos = 0;
+    }
+    lp = qrs->lp_sum2 / (qrs->lp_len * qrs->lp_len);
+    // High pass: center sample minus moving average
+    qrs->hp_sum += lp - qrs->hp_x[qrs->hp_pos];
+    qrs->hp_x[qrs->hp_pos] = lp;
+    if (++qrs->hp_pos == qrs->hp_len){
+        qrs->hp_pos = 0;
+    }
+    hp = qrs->hp_x[(qrs->hp_pos + qrs->hp_len / 2) % qrs->hp_len] - qrs->hp_sum / qrs->hp_len;
+    qrs->ring[n % QRS_RING] = hp;
+    // Five point derivative, squaring and moving window integration
+    deriv = 2 * hp + qrs->d_x[0] - qrs->d_x[2] - 2 * qrs->d_x[3];
+    qrs->d_x[3] = qrs->d_x[2];
+    qrs->d_x[2] = qrs->d_x[1];
+    qrs->d_x[1] = qrs->d_x[0];
+    qrs->d_x[0] = hp;
+    slope = (deriv < 0) ? -deriv : deriv;
+    if (slope > DERIV_MAX){
+        slope = DERIV_MAX;
+    }
+    slope = (slope * slope) >> SQUARE_SHIFT;
+    qrs->mwi_sum += slope - qrs->mwi_x[qrs->mwi_pos];
+    qrs->mwi_x[qrs->mwi_pos] = slope;
+    if (++qrs->mwi_pos == qrs->mwi_len){
+        qrs->mwi_pos = 0;
+    }
+    mwi = qrs->mwi_sum;
+    // Learning phase: initial signal and noise levels
+    if (n < LEARN_TIME * qrs->sample_freq){
+        if (mwi > qrs->learn_max){
+            qrs->learn_max = mwi;
+        }
+        qrs->learn_sum += mwi;
+        if (n == LEARN_TIME * qrs->sample_freq - 1){
+            qrs->spk = qrs->learn_max / 3;
+            qrs->npk = qrs->learn_sum / (LEARN_TIME * qrs->sample_freq) / 2;
+            if (qrs->npk > qrs->spk){
+                qrs->npk = qrs->spk;
+            }
+            threshold_update(qrs);
+        }
+        qrs->mwi_last = mwi;
+        return false;
+    }
+    // Peak tracking: a new peak is searched once the signal rises again
+    if (qrs->falling && mwi > qrs->mwi_last){
+        qrs->falling = false;
+    }
+    if (!qrs->falling && mwi > qrs->peak){
+        qrs->peak = mwi;
+        qrs->peak_n = n;
+    }
+    qrs->mwi_last = mwi;
+    // Search back: no QRS for too long, the largest peak above threshold / 2 was a QRS
+    if (qrs->last_r != 0 && qrs->cand_peak != 0 && (n - qrs->bp_delay - qrs->last_r) * 100 > qrs->rr_regular_avg * RR_MISSED){
+        qrs->spk = level_update(qrs->spk, qrs->cand_peak, 4);
+        threshold_update(qrs);
+        report_beat(qrs, qrs->cand_r, qrs->cand_slope, beat);
+        return true;
+    }
+    // Peak confirmed when the signal falls to half its value (or after a whole window)
+    if (qrs->peak != 0 && (mwi < qrs->peak / 2 || n - qrs->peak_n >= qrs->mwi_len)){
+        qrs->falling = true;
+        found = classify_peak(qrs, beat);
+        qrs->peak = 0;
+        return found;
+    }
+    return false;
+}
+
+uint16_t QrsDetectorProcess(qrs_detector_t * qrs, const int16_t * input, uint16_t lenght, qrs_beat_t * beats, uint16_t max_beats){
+    uint16_t n_beats = 0;
+    qrs_beat_t beat;
+    for (uint16_t i = 0; i < lenght; i++){
+        if (QrsDetectorPush(qrs, input[i], &beat) && n_beats < max_beats){
+            beats[n_beats++] = beat;
+        }
+    }
+    return n_beats;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,95 @@
+/**
+ * @file resampler.c
+ * @brief Fractional (Farrow) resampler
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "resampler.h"
+#include <math.h>
+/*==================[macros and definitions]=================================*/
+#define POSITION_ONE    (1LL << 32)     /*!< One input sample in 32.32 fixed point */
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+static float farrow(float * h, float mu);
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+/**
+ * @brief Cubic Lagrange interpolation between h[1] and h[2] (Farrow structure)
+ * 
+ * @param h         Four consecutive samples (oldest first)
+ * @param mu        Fractional position after h[1], in [0, 1)
+ * @return float    Interpolated value
+ */
+static float farrow(float * h, float mu){
+    float c1 = h[2] - h[0] / 3 - h[1] / 2 - h[3] / 6;
+    float c2 = (h[0] + h[2]) / 2 - h[1];
+    float c3 = (h[3] - h[0]) / 6 + (h[1] - h[2]) / 2;
+    return ((c3 * mu + c2) * mu + c1) * mu + h[1];
+}
+
+/*==================[external functions definition]==========================*/
+bool ResamplerInit(resampler_t * resampler, float input_freq, float output_freq){
+    if (!ResamplerSetFreq(resampler, input_freq, output_freq)){
+        return false;
+    }
+    resampler->phase = 0;
+    ResamplerReset(resampler);
+    return true;
+}
+
+bool ResamplerSetFreq(resampler_t * resampler, float input_freq, float output_freq){
+    if (input_freq <= 0 || output_freq <= 0){
+        return false;
+    }
+    resampler->step = llround((double)input_freq / output_freq * POSITION_ONE);
+    return resampler->step > 0;
+}
+
+bool ResamplerSetPhase(resampler_t * resampler, float phase){
+    if (phase < 0 || phase >= INT32_MAX){
+        return false;
+    }
+    resampler->phase = llround((double)phase * POSITION_ONE);
+    ResamplerReset(resampler);
+    return true;
+}
+
+uint16_t ResamplerProcess(resampler_t * resampler, const float * input, float * output, uint16_t lenght){
+    uint16_t n_out = 0;
+    for (uint16_t i = 0; i < lenght; i++){
+        if (!resampler->primed){
+            for (uint8_t k = 0; k < RESAMPLER_TAPS; k++){
+                resampler->history[k] = input[i];
+            }
+            resampler->primed = true;
+        }
+        for (uint8_t k = 0; k < RESAMPLER_TAPS - 1; k++){
+            resampler->history[k] = resampler->history[k + 1];
+        }
+        resampler->history[RESAMPLER_TAPS - 1] = input[i];
+        // Output samples between history[1] and history[2]
+        while (resampler->position < POSITION_ONE){
+            output[n_out++] = farrow(resampler->history, (uint32_t)resampler->position / (float)POSITION_ONE);
+            resampler->position += resampler->step;
+        }
+        resampler->position -= POSITION_ONE;
+    }
+    return n_out;
+}
+
+void ResamplerReset(resampler_t * resampler){
+    // Output time 0 is the first input sample, history[1] is 2 samples behind it when it arrives
+    resampler->position = resampler->phase + 2 * POSITION_ONE;
+    resampler->primed = false;
+}
+
+/*==================[end of file]============================================*/
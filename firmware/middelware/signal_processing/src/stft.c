@@ -0,0 +1,71 @@
+/**
+ * @file stft.c
+ * @brief Streaming Short-Time Fourier Transform
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "stft.h"
+#include "esp_dsp.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool STFTInit(stft_t * stft, stft_config_t * config, float * buffer){
+    uint16_t n = config->lenght;
+    if (config->hop == 0 || config->hop > n){
+        return false;
+    }
+    // buffer layout: ring (2n) | window (n) | workspace (n) | spectrum (n/2)
+    if (!FFTContextInit(&stft->fft, n, config->window, &buffer[2 * n], &buffer[3 * n])){
+        return false;
+    }
+    stft->ring = buffer;
+    stft->spectrum = &buffer[4 * n];
+    stft->hop = config->hop;
+    stft->func_p = config->func_p;
+    stft->param_p = config->param_p;
+    STFTReset(stft);
+    return true;
+}
+
+void STFTPush(stft_t * stft, const float * samples, uint16_t n){
+    uint16_t lenght = stft->fft.lenght;
+    for (uint16_t i = 0; i < n; i++){
+        // Each sample is written at pos and pos + lenght, so ring[pos .. pos + lenght - 1] 
+        // always holds the last lenght samples in order and frames are never copied
+        stft->ring[stft->pos] = samples[i];
+        stft->ring[stft->pos + lenght] = samples[i];
+        stft->pos = (stft->pos + 1) & (lenght - 1);
+        stft->count++;
+        if (stft->filled < lenght){
+            stft->filled++;
+        }
+        if (stft->filled == lenght && stft->count >= stft->hop){
+            stft->count = 0;
+            FFTContextMagnitudeReal(&stft->fft, &stft->ring[stft->pos], stft->spectrum);
+            if (stft->func_p != NULL){
+                stft->func_p(stft->spectrum, lenght / 2, stft->param_p);
+            }
+        }
+    }
+}
+
+void STFTReset(stft_t * stft){
+    stft->pos = 0;
+    stft->filled = 0;
+    stft->count = 0;
+}
+
+/*==================[end of file]============================================*/
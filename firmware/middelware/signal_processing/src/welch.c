@@ -0,0 +1,88 @@
+/**
+ * @file welch.c
+ * @brief Welch power spectral density estimator
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+
+/*==================[inclusions]=============================================*/
+#include "welch.h"
+/*==================[macros and definitions]=================================*/
+
+/*==================[internal data declaration]==============================*/
+
+/*==================[internal functions declaration]=========================*/
+
+/*==================[internal data definition]===============================*/
+
+/*==================[external data definition]===============================*/
+
+/*==================[internal functions definition]==========================*/
+
+/*==================[external functions definition]==========================*/
+bool WelchInit(welch_t * welch, welch_config_t * config, float * buffer){
+    uint16_t n = config->lenght;
+    if (config->hop == 0){
+        return false;
+    }
+    if (config->average == WELCH_EXPONENTIAL && (config->alpha <= 0 || config->alpha > 1)){
+        return false;
+    }
+    // buffer layout: window (n) | workspace (n) | accumulator (n/2)
+    if (!FFTContextInit(&welch->fft, n, config->window, buffer, &buffer[n])){
+        return false;
+    }
+    welch->acc = &buffer[2 * n];
+    welch->hop = config->hop;
+    welch->average = config->average;
+    welch->alpha = config->alpha;
+    welch->wind_power = 0;
+    for (uint16_t i = 0; i < n; i++){
+        welch->wind_power += welch->fft.wind[i] * welch->fft.wind[i];
+    }
+    WelchReset(welch);
+    return true;
+}
+
+uint16_t WelchAdd(welch_t * welch, float * signal, uint16_t lenght){
+    uint16_t n = welch->fft.lenght;
+    uint16_t segments = 0;
+    for (uint32_t i = 0; i + n <= lenght; i += welch->hop){
+        if (welch->count == 0){
+            // First segment overwrites the accumulator, no clearing needed
+            FFTContextPowerAccumulate(&welch->fft, &signal[i], welch->acc, 0, 1);
+        } else if (welch->average == WELCH_EXPONENTIAL){
+            FFTContextPowerAccumulate(&welch->fft, &signal[i], welch->acc, 1 - welch->alpha, welch->alpha);
+        } else {
+            FFTContextPowerAccumulate(&welch->fft, &signal[i], welch->acc, 1, 1);
+        }
+        welch->count++;
+        segments++;
+    }
+    return segments;
+}
+
+uint32_t WelchGetPSD(welch_t * welch, float sample_freq, float * psd){
+    uint16_t n = welch->fft.lenght;
+    float scale;
+    if (welch->count == 0){
+        return 0;
+    }
+    // |X[k]|^2 / (fs * sum(w^2)), doubled for k > 0 (single-sided spectrum)
+    scale = 2 / (sample_freq * welch->wind_power);
+    if (welch->average == WELCH_LINEAR){
+        scale = scale / welch->count;
+    }
+    for (uint16_t k = 0; k < n / 2; k++){
+        psd[k] = welch->acc[k] * scale;
+    }
+    psd[0] = psd[0] / 2;
+    return welch->count;
+}
+
+void WelchReset(welch_t * welch){
+    welch->count = 0;
+}
+
+/*==================[end of file]============================================*/
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""FFT twiddle tables generator.
+
+Writes the C header with the const tables used by FFTInit() and FFTInitQ15()
+(src/fft_tables.h), one set of tables per FFT size, selected at compile time
+with MAX_SIGNAL_LENGHT. The layouts are the ones built at runtime by esp-dsp:
+    fft_w_table_r2      W^i (i < N/2) in bit reversed order (dsps_fft2r_init_fc32)
+    fft_w_table_r4      (cos, sin)(2 * pi * i / N) for i < N (dsps_fft4r_init_fc32(NULL, N/2))
+    fft_w_table_sc16    Q15 W^i (i < N/2) in bit reversed order (dsps_fft2r_init_sc16)
+    fft_hann_q15        First half of a N points periodic Hann window (Q15)
+Values are calculated in double precision and rounded to float once.
+
+Example (the tables shipped with the module):
+    fft_table_gen.py --size 256 --size 512 --size 1024 --size 2048 -o ../src/fft_tables.h
+
+Only the Python standard library is used.
+"""
+import argparse
+import math
+import struct
+import sys
+
+INT16_MAX = 32767
+VALUES_PER_LINE = 8
+
+
+def c_float(x):
+    """C float literal of x rounded to single precision."""
+    x = struct.unpack('f', struct.pack('f', x))[0]
+    text = '%.9g' % x
+    if '.' not in text and 'e' not in text:
+        text += '.0'
+    return text + 'f'
+
+
+def bit_reverse(x, bits):
+    r = 0
+    for _ in range(bits):
+        r = (r << 1) | (x & 1)
+        x >>= 1
+    return r
+
+
+def twiddles_r2(n):
+    """W^i = (cos, sin)(2 * pi * i / n), i < n/2, in bit reversed order."""
+    bits = int(math.log2(n // 2))
+    w = []
+    for i in range(n // 2):
+        a = 2 * math.pi * bit_reverse(i, bits) / n
+        w.append((math.cos(a), math.sin(a)))
+    return w
+
+
+def twiddles_r4(n):
+    """(cos, sin)(2 * pi * i / n), i < n, in natural order."""
+    return [(math.cos(2 * math.pi * i / n), math.sin(2 * math.pi * i / n)) for i in range(n)]
+
+
+def hann_q15(n):
+    """First half (n/2 + 1 points) of a n points periodic Hann window."""
+    return [int(INT16_MAX * 0.5 * (1 - math.cos(2 * math.pi * i / n))) for i in range(n // 2 + 1)]
+
+
+def c_array(decl, values):
+    lines = [decl + ' = {']
+    for i in range(0, len(values), VALUES_PER_LINE):
+        lines.append('    ' + ', '.join(values[i:i + VALUES_PER_LINE]) + ',')
+    lines.append('};')
+    return lines
+
+
+def main():
+    parser = argparse.ArgumentParser(description='FFT const twiddle tables generator')
+    parser.add_argument('--size', required=True, type=int, action='append',
+                        help='FFT size (power of two, one table set each)')
+    parser.add_argument('-o', '--output', help='output header (default stdout)')
+    args = parser.parse_args()
+
+    sizes = sorted(set(args.size))
+    for n in sizes:
+        if n < 16 or n & (n - 1):
+            parser.error('size %d is not a power of two of at least 16' % n)
+    lines = [
+        '/* Generated by fft_table_gen.py, do not edit */',
+        '/* ' + ' '.join('--size %d' % n for n in sizes) + ' */',
+        '#ifndef FFT_TABLES_H_',
+        '#define FFT_TABLES_H_',
+        '',
+        '#include <stdint.h>',
+        '',
+    ]
+    for k, n in enumerate(sizes):
+        lines.append('%s MAX_SIGNAL_LENGHT == %d' % ('#if' if k == 0 else '#elif', n))
+        w = [c for p in twiddles_r2(n) for c in p]
+        lines += c_array('static const float fft_w_table_r2[%d] __attribute__((aligned(16)))' % len(w), [c_float(c) for c in w])
+        w = [c for p in twiddles_r4(n) for c in p]
+        lines += c_array('static const float fft_w_table_r4[%d] __attribute__((aligned(16)))' % len(w), [c_float(c) for c in w])
+        w = [int(INT16_MAX * c) for p in twiddles_r2(n) for c in p]
+        lines += c_array('static const int16_t fft_w_table_sc16[%d] __attribute__((aligned(16)))' % len(w), ['%d' % c for c in w])
+        h = hann_q15(n)
+        lines += c_array('static const int16_t fft_hann_q15[%d]' % len(h), ['%d' % c for c in h])
+    lines += ['#else',
+              '#error "No FFT tables for MAX_SIGNAL_LENGHT (sizes: %s), see fft_table_gen.py"'
+              % ', '.join('%d' % n for n in sizes),
+              '#endif', '', '#endif /* FFT_TABLES_H_ */', '']
+    text = '\n'.join(lines)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,35 @@
+# Build time generation of const IIR coefficient tables (see iir_coeff_gen.py)
+#
+# Usage, in a component CMakeLists.txt after idf_component_register():
+#   include(<path to middelware>/signal_processing/tools/iir_coeff_gen.cmake)
+#   iir_coeff_table(${COMPONENT_LIB} ecg_filter FS 250
+#                   STAGES "type=notch,order=2,f1=50,f2=2" "type=band_pass,order=4,f1=0.5,f2=40")
+# and then #include "ecg_filter.h" in the component sources.
+
+set(IIR_COEFF_GEN_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+function(iir_coeff_table target name)
+    cmake_parse_arguments(ARG "" "FS" "STAGES" ${ARGN})
+    set(output ${CMAKE_CURRENT_BINARY_DIR}/${name}.h)
+    set(stage_args)
+    foreach(stage ${ARG_STAGES})
+        list(APPEND stage_args --stage ${stage})
+    endforeach()
+    # ESP-IDF python, or the one found by CMake outside the IDF build
+    if(COMMAND idf_build_get_property)
+        idf_build_get_property(python PYTHON)
+    endif()
+    if(NOT python)
+        find_package(Python3 REQUIRED COMPONENTS Interpreter)
+        set(python ${Python3_EXECUTABLE})
+    endif()
+    add_custom_command(OUTPUT ${output}
+                       COMMAND ${python} ${IIR_COEFF_GEN_DIR}/iir_coeff_gen.py
+                               --name ${name} --fs ${ARG_FS} ${stage_args} -o ${output}
+                       DEPENDS ${IIR_COEFF_GEN_DIR}/iir_coeff_gen.py
+                       COMMENT "Generating IIR coefficients ${name}.h"
+                       VERBATIM)
+    add_custom_target(${name}_coeff DEPENDS ${output})
+    add_dependencies(${target} ${name}_coeff)
+    target_include_directories(${target} PRIVATE ${CMAKE_CURRENT_BINARY_DIR})
+endfunction()
@@ -0,0 +1,272 @@
+#!/usr/bin/env python3
+"""IIR coefficient tables generator.
+
+Designs a cascade of 2nd order sections with the same method as iir_design.c
+(analog prototype, frequency transformation and prewarped bilinear transform)
+and writes a C header with const tables, to be used with IirFilterInitConst()
+and IirFilterInitConstQ31(). Tables are stored in flash and no coefficients
+are calculated at startup. Numerators are kept below 1.99 (pure gain sections
+are added when needed) and the generator fails if any coefficient does not fit
+in the Q30 range [-2, 2).
+
+Each --stage is a comma separated list of key=value:
+    type    low_pass | hi_pass | band_pass | band_stop | notch
+    design  butterworth | chebyshev | bessel (default butterworth)
+    order   filter order (even)
+    f1      cut-off / lower edge / notch center (Hz)
+    f2      upper edge / notch bandwidth (Hz)
+    ripple  pass band ripple (dB, chebyshev only)
+
+Example (50 Hz notch and 0.5-40 Hz band pass for ECG at 250 Hz):
+    iir_coeff_gen.py --name ecg_filter --fs 250 \\
+        --stage type=notch,order=2,f1=50,f2=2 \\
+        --stage type=band_pass,order=4,f1=0.5,f2=40 -o ecg_filter.h
+
+Only the Python standard library is used.
+"""
+import argparse
+import cmath
+import math
+import sys
+
+COEFF_Q31_FRAC = 30     # Same as IIR_COEFF_Q31_FRAC
+SOS_B_LIMIT = 1.99      # Same as iir_design.c
+
+
+def bessel_poles(n):
+    """Bessel prototype poles (upper half plane and real), -3 dB at 1 rad/s."""
+    a = [0.0] * (n + 1)
+    a[n] = 1.0
+    for k in range(n - 1, -1, -1):
+        a[k] = a[k + 1] * (2 * n - k) * (k + 1) / (2.0 * (n - k))
+    r = [(0.4 + 0.9j) ** i for i in range(n)]
+    for _ in range(200):
+        for i in range(n):
+            num = a[n]
+            for k in range(n - 1, -1, -1):
+                num = num * r[i] + a[k]
+            den = 1
+            for j in range(n):
+                if j != i:
+                    den *= r[i] - r[j]
+            r[i] -= num / den
+    r = [p / a[0] ** (1.0 / n) for p in r]
+    lo, hi = 0.0, 10.0
+    for _ in range(60):
+        w = (lo + hi) / 2
+        mag = 1.0
+        for p in r:
+            mag *= abs(p) ** 2 / abs(1j * w - p) ** 2
+        if mag > 0.5:
+            lo = w
+        else:
+            hi = w
+    return [p / lo if p.imag > 1e-9 else complex(p.real / lo, 0)
+            for p in r if p.imag > 1e-9 or abs(p.imag) <= 1e-9]
+
+
+def prototype_poles(design, n, ripple):
+    """Low pass prototype poles and pass band reference gain."""
+    m = (n + 1) // 2
+    gain = 1.0
+    if design == 'butterworth':
+        th = [math.pi * (2 * k + 1) / (2 * n) for k in range(m)]
+        poles = [complex(-math.sin(t), math.cos(t)) for t in th]
+    elif design == 'chebyshev':
+        if ripple <= 0:
+            raise ValueError('chebyshev needs ripple > 0')
+        eps = math.sqrt(10 ** (ripple / 10) - 1)
+        mu = math.asinh(1 / eps) / n
+        th = [math.pi * (2 * k + 1) / (2 * n) for k in range(m)]
+        poles = [complex(-math.sinh(mu) * math.sin(t), math.cosh(mu) * math.cos(t)) for t in th]
+        if n % 2 == 0:
+            gain = 1 / math.sqrt(1 + eps * eps)
+    elif design == 'bessel':
+        poles = bessel_poles(n)
+    else:
+        raise ValueError('unknown design ' + design)
+    return poles, gain
+
+
+def sos_gain(sos, w):
+    """Magnitude response of a 2nd order section at w (rad/sample)."""
+    zi = cmath.exp(-1j * w)
+    return abs((sos[0] + sos[1] * zi + sos[2] * zi * zi) / (1 + sos[3] * zi + sos[4] * zi * zi))
+
+
+def section(ftype, z1, z2, w_ref, cos_notch):
+    """2nd order section (b0, b1, b2, a1, a2) with unity gain at w_ref."""
+    b = {'low_pass': [1, 2, 1], 'hi_pass': [1, -2, 1], 'band_pass': [1, 0, -1]}.get(
+        ftype, [1, -2 * cos_notch, 1])
+    sos = b + [-(z1 + z2).real, (z1 * z2).real]
+    g = sos_gain(sos, w_ref)
+    return [c / g for c in sos[:3]] + sos[3:]
+
+
+def balance_gain(sos):
+    """Limit the numerators to SOS_B_LIMIT, moving the excess gain to the other sections.
+
+    Same passes as iir_design.c: sections above the limit are scaled down to it and
+    the excess gain is spread between the sections below it. Returns the gain that
+    did not fit in the sections (1 if none).
+    """
+    for _ in range(len(sos) + 1):
+        excess = 1.0
+        free = []
+        for s in sos:
+            b_max = max(abs(c) for c in s[:3])
+            if b_max > SOS_B_LIMIT:
+                excess *= b_max / SOS_B_LIMIT
+                s[:3] = [c * SOS_B_LIMIT / b_max for c in s[:3]]
+                b_max = SOS_B_LIMIT
+            if b_max < SOS_B_LIMIT * (1 - 1e-6):
+                free.append(s)
+        if excess == 1 or not free:
+            return excess
+        g = excess ** (1.0 / len(free))
+        for s in free:
+            s[:3] = [c * g for c in s[:3]]
+    return 1.0
+
+
+def design_sos(fs, ftype, design='butterworth', order=2, f1=0.0, f2=0.0, ripple=0.0):
+    """Sections of one stage, same results as IirDesignSos()."""
+    if order <= 0 or order % 2:
+        raise ValueError('order must be even')
+    if not 0 < f1 < fs / 2:
+        raise ValueError('f1 out of range')
+    w1 = math.tan(math.pi * f1 / fs)
+    w0 = bw = 0.0
+    w_ref = 0.0
+    if ftype in ('low_pass', 'hi_pass'):
+        w_ref = 0.0 if ftype == 'low_pass' else math.pi
+    elif ftype in ('band_pass', 'band_stop'):
+        if not f1 < f2 < fs / 2:
+            raise ValueError('f2 out of range')
+        w2 = math.tan(math.pi * f2 / fs)
+        w0 = math.sqrt(w1 * w2)
+        bw = w2 - w1
+    elif ftype == 'notch':
+        if f2 <= 0 or f1 - f2 / 2 <= 0 or f1 + f2 / 2 >= fs / 2:
+            raise ValueError('notch bandwidth out of range')
+        w0 = w1
+        bw = math.tan(math.pi * (f1 + f2 / 2) / fs) - math.tan(math.pi * (f1 - f2 / 2) / fs)
+    else:
+        raise ValueError('unknown type ' + ftype)
+    if ftype == 'band_pass':
+        w_ref = 2 * math.atan(w0)
+    cos_notch = math.cos(2 * math.atan(w0))
+    band = ftype in ('band_pass', 'band_stop', 'notch')
+    poles, gain = prototype_poles(design, order // 2 if band else order, ripple)
+    sos = []
+    for p in poles:
+        if not band:
+            s = w1 * p if ftype == 'low_pass' else w1 / p
+            z = (1 + s) / (1 - s)
+            sos.append(section(ftype, z, z.conjugate(), w_ref, cos_notch))
+            continue
+        t = p * bw if ftype == 'band_pass' else bw / p
+        r = cmath.sqrt(t * t / 4 - w0 * w0)
+        z1 = (1 + (t / 2 + r)) / (1 - (t / 2 + r))
+        z2 = (1 + (t / 2 - r)) / (1 - (t / 2 - r))
+        if abs(p.imag) > 1e-9:
+            # Band pass sections are normalized at their own peak, to keep coefficients small
+            for z in (z1, z2):
+                w_sec = abs(cmath.phase(z)) if ftype == 'band_pass' else w_ref
+                sos.append(section(ftype, z, z.conjugate(), w_sec, cos_notch))
+        else:
+            sos.append(section(ftype, z1, z2, w_ref, cos_notch))
+    # Pass band gain correction, spread evenly between sections
+    for s in sos:
+        gain /= sos_gain(s, w_ref)
+    gain = gain ** (1.0 / len(sos))
+    sos = [[c * gain for c in s[:3]] + s[3:] for s in sos]
+    # Gain the numerators can not hold (e.g. low cut-off hi pass): pure gain sections at the output
+    excess = balance_gain(sos)
+    while excess > 1 + 1e-6:
+        g = min(excess, SOS_B_LIMIT)
+        sos.append([g, 0.0, 0.0, 0.0, 0.0])
+        excess /= g
+    return sos
+
+
+def c_float(x):
+    """C float literal."""
+    text = '%.9g' % x
+    if '.' not in text and 'e' not in text:
+        text += '.0'
+    return text + 'f'
+
+
+def quantize(x):
+    """Q30 coefficient, an error if out of the [-2, 2) range (IirFilterToQ31() would saturate it)."""
+    c = round(x * (1 << COEFF_Q31_FRAC))
+    if not -(1 << 31) <= c < (1 << 31):
+        raise ValueError('coefficient %.9g out of the Q30 range [-2, 2)' % x)
+    return c
+
+
+def parse_stage(text):
+    stage = {}
+    for item in text.split(','):
+        key, _, value = item.partition('=')
+        key = key.strip()
+        if key in ('type', 'design'):
+            stage[key] = value.strip()
+        elif key == 'order':
+            stage[key] = int(value)
+        elif key in ('f1', 'f2', 'ripple'):
+            stage[key] = float(value)
+        else:
+            raise ValueError('unknown stage key ' + key)
+    if 'type' not in stage:
+        raise ValueError('stage without type')
+    stage['ftype'] = stage.pop('type')
+    return stage
+
+
+def main():
+    parser = argparse.ArgumentParser(description='IIR const coefficient tables generator')
+    parser.add_argument('--name', required=True, help='C identifier of the tables')
+    parser.add_argument('--fs', required=True, type=float, help='sample frequency (Hz)')
+    parser.add_argument('--stage', required=True, action='append', help='filter stage (see module doc)')
+    parser.add_argument('-o', '--output', help='output header (default stdout)')
+    args = parser.parse_args()
+
+    sos = []
+    try:
+        for text in args.stage:
+            sos += design_sos(args.fs, **parse_stage(text))
+        sos_q31 = [[quantize(c) for c in s] for s in sos]
+    except ValueError as e:
+        parser.error(str(e))
+    name = args.name
+    upper = name.upper()
+    lines = [
+        '/* Generated by iir_coeff_gen.py, do not edit */',
+        '/* ' + ' '.join(['--fs', '%g' % args.fs] + ['--stage ' + s for s in args.stage]) + ' */',
+        '#ifndef %s_H_' % upper,
+        '#define %s_H_' % upper,
+        '',
+        '#include <stdint.h>',
+        '#include "iir_filter.h"',
+        '',
+        '#define %s_SECTIONS    %d' % (upper, len(sos)),
+        '',
+        'static const float %s_sos[%s_SECTIONS][IIR_SOS_COEFF] = {' % (name, upper),
+    ]
+    lines += ['    {' + ', '.join(c_float(c) for c in s) + '},' for s in sos]
+    lines += ['};', '',
+              'static const int32_t %s_sos_q31[%s_SECTIONS][IIR_SOS_COEFF] = {' % (name, upper)]
+    lines += ['    {' + ', '.join('%d' % c for c in s) + '},' for s in sos_q31]
+    lines += ['};', '', '#endif /* %s_H_ */' % upper, '']
+    text = '\n'.join(lines)
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == '__main__':
+    main()
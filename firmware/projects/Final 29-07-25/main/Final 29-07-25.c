@@ -170,7 +170,7 @@ static void tareaPresion(void *pvParameters)
 	while (true)
 	{
 		uint16_t presion_mV = 0;
-		AnalogInputReadSingle(CH0, &presion_mV);
+		AnalogInputReadSingleMv(CH0, &presion_mV);
 		uint16_t presion = (presion_mV / SENSIBILIDAD_PRESION) / 1000; // Convierto Bar a mBar dvidiendo por 1000
 		if (presion < UMBRAL_PRESION && controlAguaLimpia)
 		{
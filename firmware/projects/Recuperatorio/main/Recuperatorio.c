@@ -103,7 +103,7 @@ static void TareaComida(void *pvParameters)
 		if (on_off_comida)
 		{
 			uint16_t comida_mV = 0;
-			AnalogInputReadSingle(CH0, &comida_mV);
+			AnalogInputReadSingleMv(CH0, &comida_mV);
 
 			comida = (comida_mV * 500) / 3300 - 500;
 
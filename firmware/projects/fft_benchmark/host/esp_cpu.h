@@ -0,0 +1 @@
+/* Host build shim: included by esp-dsp dsp_common.h, nothing is used (see README.md) */
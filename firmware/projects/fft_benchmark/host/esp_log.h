@@ -0,0 +1,10 @@
+/* Host build shim: ESP_LOGx to stderr, errors and warnings only (see README.md) */
+#ifndef ESP_LOG_H_
+#define ESP_LOG_H_
+#include <stdio.h>
+#define ESP_LOGE(tag, format, ...)	fprintf(stderr, "E %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...)	fprintf(stderr, "W %s: " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...)
+#define ESP_LOGD(tag, format, ...)
+#define ESP_LOGV(tag, format, ...)
+#endif /* ESP_LOG_H_ */
@@ -0,0 +1,220 @@
+/*! @mainpage FFT Benchmark
+ *
+ * @section genDesc General Description
+ *
+ * Measures the execution time of the floating point (FFTMagnitude) and fixed point
+ * (FFTMagnitudeQ15) spectrum calculation on the ESP32-C6, for every power of two
+ * signal lenght up to MAX_SIGNAL_LENGHT. The test signal is a synthetic 12 bit ADC
+ * record (offset plus two tones). It also compares the radix-2 and radix-4 (mixed
+ * radix-2/4 for lenghts that are not a power of four) transforms of a FFT context, for
+ * the complex (FFTContextMagnitude) and real input (FFTContextMagnitudeReal) paths, and
+ * measures the throughput of a streaming STFT with 75% overlap. Results are printed
+ * through the monitor serial port. The real input path is checked against the complex one
+ * (every bin, DC included), failing an assert on a mismatch.
+ *
+ * @section hardConn Hardware Connection
+ *
+ * |    Peripheral  |   ESP32   	|
+ * |:--------------:|:--------------|
+ * | 	-		 	| 	-			|
+ *
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ * | 17/10/2026 | Radix-2 vs radix-4 comparison                  |
+ * | 17/10/2026 | Real vs complex path check (DC bin)            |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "esp_timer.h"
+#include "fft.h"
+#include "stft.h"
+/*==================[macros and definitions]=================================*/
+#define MIN_SIGNAL_LENGHT	256		/*!< Shortest signal tested */
+#define N_RUNS				20		/*!< Executions averaged for each measurement */
+#define ADC_OFFSET			2048	/*!< Test signal offset (in ADC codes) */
+#define STFT_LENGHT			256		/*!< STFT window lenght */
+#define STFT_HOP			64		/*!< STFT hop (75% overlap) */
+#define STFT_CHUNK			32		/*!< Samples pushed on each STFTPush() call */
+#define PATH_TOLERANCE		1e-4f	/*!< Maximum real vs complex path difference (relative to the DC bin) */
+/*==================[internal data definition]===============================*/
+static uint16_t signal_adc[MAX_SIGNAL_LENGHT];
+static float signal_float[MAX_SIGNAL_LENGHT];
+static uint16_t fft_q15[MAX_SIGNAL_LENGHT / 2];
+static float fft_float[MAX_SIGNAL_LENGHT / 2];
+static float fft_radix[MAX_SIGNAL_LENGHT / 2];
+static float ctx_wind[MAX_SIGNAL_LENGHT];
+static float ctx_work[FFT_WORK_SIZE(MAX_SIGNAL_LENGHT)];
+static float stft_buffer[STFT_BUFFER_SIZE(STFT_LENGHT)];
+static uint32_t stft_frames;
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Fill the test signal arrays with an offset plus two tones
+ *
+ * @param signal_lenght Lenght of the test signal
+ */
+static void GenerateSignal(uint16_t signal_lenght){
+	for(uint16_t i=0; i<signal_lenght; i++){
+		signal_adc[i] = ADC_OFFSET + 1000 * sinf(2 * M_PI * 10 * i / signal_lenght)
+					  + 200 * sinf(2 * M_PI * (signal_lenght / 8) * i / signal_lenght);
+		signal_float[i] = signal_adc[i];
+	}
+}
+
+/**
+ * @brief Measure the average execution time of a FFT context transform
+ *
+ * @param ctx		FFT context
+ * @param real		Use the real input path (FFTContextMagnitudeReal) instead of the complex one
+ * @param fft		Array to store FFT magnitude values
+ * @return uint32_t	Execution time (us)
+ */
+static uint32_t TimeContext(fft_context_t * ctx, bool real, float * fft){
+	int64_t t_start = esp_timer_get_time();
+	for(uint8_t i=0; i<N_RUNS; i++){
+		if(real){
+			FFTContextMagnitudeReal(ctx, signal_float, fft);
+		} else{
+			FFTContextMagnitude(ctx, signal_float, fft);
+		}
+	}
+	return (esp_timer_get_time() - t_start) / N_RUNS;
+}
+
+/**
+ * @brief Compare the radix-2 and radix-4 transforms of a FFT context for every lenght
+ */
+static void RadixBenchmark(void){
+	fft_context_t ctx;
+	uint32_t t_radix2, t_radix4;
+	float error, max_error;
+
+	printf("N	path	radix-2 (us)	radix-4 (us)	speedup	max difference\n");
+	for(uint16_t n=MIN_SIGNAL_LENGHT; n<=MAX_SIGNAL_LENGHT; n*=2){
+		GenerateSignal(n);
+		FFTContextInit(&ctx, n, FFT_WINDOW_HANN, ctx_wind, ctx_work);
+		for(uint8_t real=0; real<2; real++){
+			FFTContextSetRadix(&ctx, FFT_RADIX_2);
+			t_radix2 = TimeContext(&ctx, real, fft_float);
+			FFTContextSetRadix(&ctx, FFT_RADIX_4);
+			t_radix4 = TimeContext(&ctx, real, fft_radix);
+			max_error = 0;
+			for(uint16_t k=0; k<n/2; k++){
+				error = fabsf(fft_float[k] - fft_radix[k]);
+				if(error > max_error){
+					max_error = error;
+				}
+			}
+			printf("%u\t%s\t%lu\t\t%lu\t\t%.2f\t%.2e\n", n, real ? "real" : "complex", t_radix2, t_radix4,
+				   (float)t_radix2 / t_radix4, max_error);
+		}
+	}
+}
+
+/**
+ * @brief Check that the real input path gives the same spectrum as the complex one
+ * (both radixes, every lenght), the DC bin included
+ */
+static void RealPathCheck(void){
+	fft_context_t ctx;
+	float error, max_error;
+
+	for(uint16_t n=MIN_SIGNAL_LENGHT; n<=MAX_SIGNAL_LENGHT; n*=2){
+		GenerateSignal(n);
+		FFTContextInit(&ctx, n, FFT_WINDOW_HANN, ctx_wind, ctx_work);
+		for(uint8_t radix=0; radix<2; radix++){
+			FFTContextSetRadix(&ctx, radix ? FFT_RADIX_4 : FFT_RADIX_2);
+			FFTContextMagnitude(&ctx, signal_float, fft_float);
+			FFTContextMagnitudeReal(&ctx, signal_float, fft_radix);
+			max_error = 0;
+			for(uint16_t k=0; k<n/2; k++){
+				error = fabsf(fft_float[k] - fft_radix[k]);
+				if(error > max_error){
+					max_error = error;
+				}
+			}
+			printf("N %u radix-%u: real vs complex DC %.1f / %.1f, max difference %.2e\n", n, radix ? 4 : 2,
+				   fft_radix[0], fft_float[0], max_error);
+			assert(max_error <= PATH_TOLERANCE * fft_float[0]);
+		}
+	}
+}
+
+/**
+ * @brief STFT frame callback, only counts frames
+ */
+static void StftFrame(float * spectrum, uint16_t bins, void * param){
+	stft_frames++;
+}
+
+/**
+ * @brief Measure the STFT throughput pushing the test signal in small chunks
+ */
+static void StftBenchmark(void){
+	stft_t stft;
+	stft_config_t stft_config = {
+		.lenght = STFT_LENGHT,
+		.hop = STFT_HOP,
+		.window = FFT_WINDOW_HANN,
+		.func_p = StftFrame,
+		.param_p = NULL
+	};
+	int64_t t_start;
+	uint32_t t_stft;
+
+	STFTInit(&stft, &stft_config, stft_buffer);
+	GenerateSignal(MAX_SIGNAL_LENGHT);
+	stft_frames = 0;
+	t_start = esp_timer_get_time();
+	for(uint16_t i=0; i<MAX_SIGNAL_LENGHT; i+=STFT_CHUNK){
+		STFTPush(&stft, &signal_float[i], STFT_CHUNK);
+	}
+	t_stft = esp_timer_get_time() - t_start;
+	printf("STFT %u/%u: %lu frames in %lu us (%.0f samples/s)\n", STFT_LENGHT, STFT_HOP, stft_frames, t_stft,
+		   MAX_SIGNAL_LENGHT * 1e6f / t_stft);
+}
+/*==================[external functions definition]==========================*/
+void app_main(void){
+	int64_t t_start;
+	uint32_t t_float, t_q15;
+	float error, max_error;
+
+	FFTInit();
+	FFTInitQ15();
+	printf("N\tfloat (us)\tQ15 (us)\tspeedup\tmax error (codes)\n");
+	for(uint16_t n=MIN_SIGNAL_LENGHT; n<=MAX_SIGNAL_LENGHT; n*=2){
+		GenerateSignal(n);
+		t_start = esp_timer_get_time();
+		for(uint8_t i=0; i<N_RUNS; i++){
+			FFTMagnitude(signal_float, fft_float, n);
+		}
+		t_float = (esp_timer_get_time() - t_start) / N_RUNS;
+		t_start = esp_timer_get_time();
+		for(uint8_t i=0; i<N_RUNS; i++){
+			FFTMagnitudeQ15(signal_adc, fft_q15, n);
+		}
+		t_q15 = (esp_timer_get_time() - t_start) / N_RUNS;
+		// bin 1 is skipped: FFTMagnitude includes the window leakage of the offset there
+		max_error = 0;
+		for(uint16_t k=2; k<n/2; k++){
+			error = fabsf(fft_float[k] - fft_q15[k]);
+			if(error > max_error){
+				max_error = error;
+			}
+		}
+		printf("%u\t%lu\t\t%lu\t\t%.1f\t%.1f\n", n, t_float, t_q15, (float)t_float / t_q15, max_error);
+	}
+	RealPathCheck();
+	RadixBenchmark();
+	StftBenchmark();
+}
+/*==================[end of file]============================================*/
@@ -0,0 +1,6 @@
+/* Host build shim: IDF version checked by esp-dsp headers (see README.md) */
+#ifndef ESP_IDF_VERSION_H_
+#define ESP_IDF_VERSION_H_
+#define ESP_IDF_VERSION_VAL(major, minor, patch)	(((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION		ESP_IDF_VERSION_VAL(5, 1, 6)
+#endif /* ESP_IDF_VERSION_H_ */
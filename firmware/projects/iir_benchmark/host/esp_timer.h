@@ -0,0 +1,11 @@
+/* Host build shim: esp_timer_get_time() on the monotonic clock (see README.md) */
+#ifndef ESP_TIMER_H_
+#define ESP_TIMER_H_
+#include <stdint.h>
+#include <time.h>
+static inline int64_t esp_timer_get_time(void){
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (int64_t)t.tv_sec * 1000000 + t.tv_nsec / 1000;
+}
+#endif /* ESP_TIMER_H_ */
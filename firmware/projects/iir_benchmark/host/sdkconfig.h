@@ -0,0 +1,6 @@
+/* Host build shim: signal processing menuconfig options, default values (see README.md) */
+#ifndef SDKCONFIG_H_
+#define SDKCONFIG_H_
+#define CONFIG_SIGNAL_PROCESSING_FFT_MAX_LENGHT		2048
+#define CONFIG_SIGNAL_PROCESSING_IIR_MAX_SECTIONS	4
+#endif /* SDKCONFIG_H_ */
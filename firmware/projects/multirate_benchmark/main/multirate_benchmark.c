@@ -0,0 +1,229 @@
+/*! @mainpage Multirate Benchmark
+ *
+ * @section genDesc General Description
+ *
+ * Measures on the ESP32-C6 the execution time of the floating point (DecimatorProcess)
+ * and fixed point (DecimatorProcessQ15) decimators for several decimation factors, with
+ * the default FIR lenght (14 * factor). The test signal is a synthetic 12 bit ADC record
+ * (offset plus a tone). Short fixed point filters, whose center coefficient is at the
+ * limit of the Q15 range, are checked first: the DC gain must be kept and coefficients
+ * that do not fit must be rejected, failing an assert otherwise. Two resampled streams
+ * started at different times are also checked to land on the same output timeline once
+ * the phase of the later one is set, as well as two streams at different input rates started
+ * together. Results are printed through the monitor serial port.
+ *
+ * @section hardConn Hardware Connection
+ *
+ * |    Peripheral  |   ESP32   	|
+ * |:--------------:|:--------------|
+ * | 	-		 	| 	-			|
+ *
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ * | 17/10/2026 | Resampled streams alignment check              |
+ * | 17/10/2026 | Different input rates alignment check          |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+#include "esp_timer.h"
+#include "decimator.h"
+#include "resampler.h"
+/*==================[macros and definitions]=================================*/
+#define SAMPLE_FREC			1000	/*!< Input sample frequency (Hz) */
+#define SIGNAL_LENGHT		1024	/*!< Samples of the test signal */
+#define MAX_FACTOR			8		/*!< Largest decimation factor tested */
+#define MAX_TAPS			(14 * MAX_FACTOR)	/*!< FIR lenght of the largest factor */
+#define N_RUNS				20		/*!< Executions averaged for each measurement */
+#define ADC_OFFSET			2048	/*!< Test signal offset (in ADC codes) */
+#define SHORT_TAPS			3		/*!< FIR lenght of the short filter checks */
+#define SHORT_DC			1000	/*!< DC input of the short filter checks */
+#define STREAM_IN_FREC		250		/*!< Input sample frequency of the resampled streams (Hz) */
+#define STREAM_OUT_FREC		100		/*!< Output sample frequency of the resampled streams (Hz) */
+#define STREAM_SLOW_FREC	250		/*!< Input sample frequency of the slow stream in the rates check (Hz) */
+#define STREAM_DELAY		0.0123f	/*!< Start of the second stream after the first one (s) */
+#define STREAM_TONE			5		/*!< Tone of the resampled streams (Hz) */
+#define STREAM_SKIP			4		/*!< First output samples left out (history filled with the first input) */
+#define ALIGN_TOLERANCE		0.5f	/*!< Maximum difference between aligned streams (codes) */
+/*==================[internal data definition]===============================*/
+static int16_t signal_q15[SIGNAL_LENGHT];
+static float signal_float[SIGNAL_LENGHT];
+static int16_t output_q15[SIGNAL_LENGHT];
+static float output_float[SIGNAL_LENGHT];
+static int16_t buffer_q15[DECIMATOR_BUFFER_SIZE(MAX_TAPS, MAX_FACTOR)];
+static float buffer_float[DECIMATOR_BUFFER_SIZE(MAX_TAPS, MAX_FACTOR)];
+static float stream_late[SIGNAL_LENGHT];
+static float output_late[SIGNAL_LENGHT];
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Fill the test signal arrays with an offset plus a tone
+ */
+static void GenerateSignal(void){
+	for(uint16_t i=0; i<SIGNAL_LENGHT; i++){
+		signal_q15[i] = ADC_OFFSET + 1000 * sinf(2 * M_PI * 10 * i / SAMPLE_FREC);
+		signal_float[i] = signal_q15[i];
+	}
+}
+
+/**
+ * @brief Check the fixed point decimator with filters at the limit of the Q15 range
+ *
+ * A 3 taps design is {0, 1, 0}: its center coefficient must not wrap to -1.
+ */
+static void ShortFilterCheck(void){
+	decimator_q15_t decimator;
+	decimator_config_t config = {SAMPLE_FREC, 2, SHORT_TAPS, 0};
+	static const float too_large[SHORT_TAPS] = {0, 0.99999f, 0};
+	// Center rounded to 32767, sum rounded to 32768: the DC gain correction overflows
+	static const float correction_too_large[SHORT_TAPS] = {0.000014f, 0.99996f, 0.000014f};
+	uint16_t n_out;
+
+	for(uint16_t i=0; i<SIGNAL_LENGHT; i++){
+		signal_q15[i] = SHORT_DC;
+	}
+	assert(DecimatorInitQ15(&decimator, &config, buffer_q15));
+	n_out = DecimatorProcessQ15(&decimator, signal_q15, output_q15, SIGNAL_LENGHT);
+	assert(n_out == SIGNAL_LENGHT / config.factor);
+	for(uint16_t i=SHORT_TAPS; i<n_out; i++){
+		assert(output_q15[i] == SHORT_DC);
+	}
+	assert(!DecimatorInitCoeffQ15(&decimator, too_large, SHORT_TAPS, 1, buffer_q15));
+	assert(!DecimatorInitCoeffQ15(&decimator, correction_too_large, SHORT_TAPS, 1, buffer_q15));
+	printf("Short Q15 filters: DC %d -> %d\n", SHORT_DC, output_q15[n_out - 1]);
+}
+
+/**
+ * @brief Largest difference between the reference stream output and the late stream one
+ *
+ * @param first		Reference output sample at the time of the first late output sample
+ * @param n_late	Number of late output samples
+ * @return float	Maximum difference (codes)
+ */
+static float StreamDifference(uint16_t first, uint16_t n_late){
+	float error, max_error = 0;
+	for(uint16_t i=STREAM_SKIP; i<n_late; i++){
+		error = fabsf(output_late[i] - output_float[first + i]);
+		if(error > max_error){
+			max_error = error;
+		}
+	}
+	return max_error;
+}
+
+/**
+ * @brief Check that two streams started at different times are aligned by ResamplerSetPhase()
+ *
+ * Both streams sample the same tone at STREAM_IN_FREC, the late one STREAM_DELAY after the
+ * reference one. Without phase, its output timeline is shifted up to one output period.
+ */
+static void StreamAlignCheck(void){
+	resampler_t reference, late;
+	uint16_t first = ceilf(STREAM_DELAY * STREAM_OUT_FREC);
+	float phase = ((float)first / STREAM_OUT_FREC - STREAM_DELAY) * STREAM_IN_FREC;
+	// Late stream shortened so its output samples are all within the reference ones
+	uint16_t lenght_late = SIGNAL_LENGHT - first * STREAM_IN_FREC / STREAM_OUT_FREC - 1;
+	float error_phase, error_no_phase;
+	uint16_t n_out;
+
+	for(uint16_t i=0; i<SIGNAL_LENGHT; i++){
+		signal_float[i] = ADC_OFFSET + 1000 * sinf(2 * M_PI * STREAM_TONE * i / STREAM_IN_FREC);
+		stream_late[i] = ADC_OFFSET + 1000 * sinf(2 * M_PI * STREAM_TONE * (STREAM_DELAY + (float)i / STREAM_IN_FREC));
+	}
+	ResamplerInit(&reference, STREAM_IN_FREC, STREAM_OUT_FREC);
+	ResamplerProcess(&reference, signal_float, output_float, SIGNAL_LENGHT);
+	ResamplerInit(&late, STREAM_IN_FREC, STREAM_OUT_FREC);
+	n_out = ResamplerProcess(&late, stream_late, output_late, lenght_late);
+	error_no_phase = StreamDifference(first, n_out);
+	assert(ResamplerSetPhase(&late, phase));
+	n_out = ResamplerProcess(&late, stream_late, output_late, lenght_late);
+	error_phase = StreamDifference(first, n_out);
+	assert(error_phase <= ALIGN_TOLERANCE);
+	assert(!ResamplerSetPhase(&late, -1));
+	printf("Streams %.1f ms apart: max difference %.2f codes (%.2f without phase)\n",
+		   STREAM_DELAY * 1000, error_phase, error_no_phase);
+}
+
+/**
+ * @brief Check that streams at different input rates started together share the output timeline
+ *
+ * The same tone is sampled at SAMPLE_FREC and STREAM_SLOW_FREC from the same instant: output
+ * sample n of both streams must be the tone at n / STREAM_OUT_FREC (the interpolator latency,
+ * 2 input samples, differs between rates and must not shift the outputs).
+ */
+static void RateAlignCheck(void){
+	resampler_t fast, slow;
+	uint16_t lenght_slow = SIGNAL_LENGHT * STREAM_SLOW_FREC / SAMPLE_FREC;
+	uint16_t n_fast, n_slow;
+	float tone, error, max_error = 0;
+
+	for(uint16_t i=0; i<SIGNAL_LENGHT; i++){
+		signal_float[i] = ADC_OFFSET + 1000 * sinf(2 * M_PI * STREAM_TONE * i / SAMPLE_FREC);
+	}
+	for(uint16_t i=0; i<lenght_slow; i++){
+		stream_late[i] = ADC_OFFSET + 1000 * sinf(2 * M_PI * STREAM_TONE * i / STREAM_SLOW_FREC);
+	}
+	ResamplerInit(&fast, SAMPLE_FREC, STREAM_OUT_FREC);
+	n_fast = ResamplerProcess(&fast, signal_float, output_float, SIGNAL_LENGHT);
+	ResamplerInit(&slow, STREAM_SLOW_FREC, STREAM_OUT_FREC);
+	n_slow = ResamplerProcess(&slow, stream_late, output_late, lenght_slow);
+	for(uint16_t i=0; i<n_fast && i<n_slow; i++){
+		tone = ADC_OFFSET + 1000 * sinf(2 * M_PI * STREAM_TONE * i / STREAM_OUT_FREC);
+		error = fmaxf(fabsf(output_float[i] - tone), fabsf(output_late[i] - tone));
+		if(error > max_error){
+			max_error = error;
+		}
+	}
+	assert(max_error <= ALIGN_TOLERANCE);
+	printf("Streams at %d and %d Hz: max difference to the tone %.2f codes\n",
+		   SAMPLE_FREC, STREAM_SLOW_FREC, max_error);
+}
+/*==================[external functions definition]==========================*/
+void app_main(void){
+	decimator_t decimator;
+	decimator_q15_t decimator_q15;
+	decimator_config_t config = {SAMPLE_FREC, 0, 0, 0};
+	int64_t t_start;
+	uint32_t t_float, t_q15;
+	float error, max_error;
+	uint16_t n_out;
+
+	ShortFilterCheck();
+	StreamAlignCheck();
+	RateAlignCheck();
+	GenerateSignal();
+	printf("factor\ttaps\tfloat (us)\tQ15 (us)\tmax error (codes)\n");
+	for(uint16_t factor=2; factor<=MAX_FACTOR; factor*=2){
+		config.factor = factor;
+		config.taps = 14 * factor;
+		DecimatorInit(&decimator, &config, buffer_float);
+		t_start = esp_timer_get_time();
+		for(uint8_t i=0; i<N_RUNS; i++){
+			n_out = DecimatorProcess(&decimator, signal_float, output_float, SIGNAL_LENGHT);
+		}
+		t_float = (esp_timer_get_time() - t_start) / N_RUNS;
+		DecimatorInitQ15(&decimator_q15, &config, buffer_q15);
+		t_start = esp_timer_get_time();
+		for(uint8_t i=0; i<N_RUNS; i++){
+			n_out = DecimatorProcessQ15(&decimator_q15, signal_q15, output_q15, SIGNAL_LENGHT);
+		}
+		t_q15 = (esp_timer_get_time() - t_start) / N_RUNS;
+		max_error = 0;
+		for(uint16_t i=0; i<n_out; i++){
+			error = fabsf(output_float[i] - output_q15[i]);
+			if(error > max_error){
+				max_error = error;
+			}
+		}
+		printf("%u\t%u\t%lu\t\t%lu\t\t%.2f\n", factor, config.taps, t_float, t_q15, max_error);
+	}
+}
+/*==================[end of file]============================================*/
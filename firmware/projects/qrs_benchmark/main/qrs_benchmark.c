@@ -0,0 +1,157 @@
+/*! @mainpage QRS Benchmark
+ *
+ * @section genDesc General Description
+ *
+ * Plays back the ecg[] waveform of Proyecto02_Actividad04 (one beat every 1.024 s, scaled
+ * to 12 bit ADC codes) through the streaming QRS detector at 250 and 500 Hz. For each
+ * sample frequency it reports the detected beats against the expected ones, the R peak
+ * location error, the heart rate and the execution time (average per sample and worst
+ * single sample). Each run is repeated with the beat at full scale (about +-4000 codes),
+ * and an assert fails if a beat is missed or an R peak is misplaced. Results are printed through the monitor serial port.
+ *
+ * @section hardConn Hardware Connection
+ *
+ * |    Peripheral  |   ESP32   	|
+ * |:--------------:|:--------------|
+ * | 	-		 	| 	-			|
+ *
+ *
+ * @section changelog Changelog
+ *
+ * |   Date	    | Description                                    |
+ * |:----------:|:-----------------------------------------------|
+ * | 17/10/2026 | Document creation		                         |
+ * | 17/10/2026 | Full scale run, beats and R error asserts      |
+ *
+ */
+
+/*==================[inclusions]=============================================*/
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_timer.h"
+#include "qrs_detector.h"
+/*==================[macros and definitions]=================================*/
+#define ECG_LENGHT			256		/*!< Samples of the ecg[] beat */
+#define ECG_FREC			250		/*!< Sample frequency of the ecg[] beat (Hz) */
+#define ECG_R_INDEX			96		/*!< R peak position in ecg[] */
+#define ECG_OFFSET			1000	/*!< ADC code of the baseline */
+#define ECG_GAIN			8		/*!< ADC codes per ecg[] unit */
+#define FULL_SCALE_OFFSET	-4095	/*!< Baseline of the full scale beat */
+#define FULL_SCALE_GAIN		32		/*!< Codes per ecg[] unit of the full scale beat (up to about +4000) */
+#define MAX_FREC_FACTOR		2		/*!< Highest sample frequency / ECG_FREC */
+#define N_BEATS				60		/*!< Beats played back on each run */
+#define MAX_BEATS			4		/*!< Beats returned by each QrsDetectorProcess() call */
+#define R_TOLERANCE			2		/*!< Accepted R peak location error (samples) */
+/*==================[internal data definition]===============================*/
+static const uint8_t ecg[ECG_LENGHT] = {
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18, 18, 18, 17, 17,
+	17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 17, 17, 16, 16,
+	16, 16, 17, 17, 18, 18, 18, 17, 17, 17, 17, 18, 18, 19, 21, 22,
+	24, 25, 26, 27, 28, 29, 31, 32, 33, 34, 34, 35, 37, 38, 37, 34,
+	29, 24, 19, 15, 14, 15, 16, 17, 17, 17, 16, 15, 14, 13, 13, 13,
+	13, 13, 13, 13, 12, 12, 10, 6, 2, 3, 15, 43, 88, 145, 199, 237,
+	252, 242, 211, 167, 117, 70, 35, 16, 14, 22, 32, 38, 37, 32, 27, 24,
+	24, 26, 27, 28, 28, 27, 28, 28, 30, 31, 31, 31, 32, 33, 34, 36,
+	38, 39, 40, 41, 42, 43, 45, 47, 49, 51, 53, 55, 57, 60, 62, 65,
+	68, 71, 75, 79, 83, 87, 92, 97, 101, 106, 111, 116, 121, 125, 129, 133,
+	136, 138, 139, 140, 140, 139, 137, 133, 129, 123, 117, 109, 101, 92, 84, 77,
+	70, 64, 58, 52, 47, 42, 39, 36, 34, 31, 30, 28, 27, 26, 25, 25,
+	25, 25, 25, 25, 25, 25, 24, 24, 24, 24, 25, 25, 25, 25, 25, 25,
+	25, 24, 24, 24, 24, 24, 24, 24, 24, 23, 23, 22, 22, 21, 21, 21,
+	20, 20, 20, 20, 20, 19, 19, 18, 18, 18, 19, 19, 19, 19, 18, 17,
+	17, 18, 18, 18, 18, 18, 18, 18, 18, 17, 17, 17, 17, 17, 17, 17
+};
+static int16_t beat_signal[MAX_FREC_FACTOR * ECG_LENGHT];
+/*==================[internal functions declaration]=========================*/
+/**
+ * @brief Fill beat_signal with one ecg[] beat in ADC codes, linearly interpolated to the sample frequency
+ *
+ * @param factor Sample frequency / ECG_FREC
+ * @param offset Code of the baseline
+ * @param gain	 Codes per ecg[] unit
+ * @return uint16_t Beat lenght (samples)
+ */
+static uint16_t GenerateBeat(uint8_t factor, int16_t offset, int16_t gain){
+	uint16_t lenght = factor * ECG_LENGHT;
+	uint16_t k;
+	int32_t a, b;
+	for(uint16_t i=0; i<lenght; i++){
+		k = i / factor;
+		a = ecg[k];
+		b = ecg[(k + 1) % ECG_LENGHT];
+		beat_signal[i] = offset + gain * (a * factor + (b - a) * (i % factor)) / factor;
+	}
+	return lenght;
+}
+/*==================[external functions definition]==========================*/
+void app_main(void){
+	qrs_detector_t qrs;
+	qrs_beat_t beats[MAX_BEATS];
+	uint16_t lenght, n_beats, sample_frec, r_expected;
+	uint8_t factor;
+	uint16_t detected, expected, r_errors, heart_rate;
+	int32_t r_error, max_r_error;
+	int64_t t_start, t_sample;
+	uint32_t t_total, t_max;
+	bool full_scale;
+
+	printf("fs (Hz)\tscale\tbeats\texpected\tR errors\tmax R error\tHR (bpm)\tus/sample\tmax us/sample\n");
+	for(uint8_t run=0; run<2 * MAX_FREC_FACTOR; run++){
+		factor = run / 2 + 1;
+		full_scale = run % 2;
+		sample_frec = factor * ECG_FREC;
+		if(full_scale){
+			lenght = GenerateBeat(factor, FULL_SCALE_OFFSET, FULL_SCALE_GAIN);
+		} else{
+			lenght = GenerateBeat(factor, ECG_OFFSET, ECG_GAIN);
+		}
+		r_expected = factor * ECG_R_INDEX;
+		// Throughput: whole blocks through QrsDetectorProcess()
+		QrsDetectorInit(&qrs, sample_frec);
+		detected = 0;
+		r_errors = 0;
+		max_r_error = 0;
+		heart_rate = 0;
+		t_start = esp_timer_get_time();
+		for(uint16_t b=0; b<N_BEATS; b++){
+			n_beats = QrsDetectorProcess(&qrs, beat_signal, lenght, beats, MAX_BEATS);
+			for(uint16_t i=0; i<n_beats; i++){
+				r_error = (int32_t)(beats[i].r_sample % lenght) - r_expected;
+				if(r_error < 0){
+					r_error = -r_error;
+				}
+				if(r_error > max_r_error){
+					max_r_error = r_error;
+				}
+				if(r_error > R_TOLERANCE){
+					r_errors++;
+				}
+				heart_rate = beats[i].heart_rate;
+			}
+			detected += n_beats;
+		}
+		t_total = esp_timer_get_time() - t_start;
+		// Bounded cost: worst single sample
+		QrsDetectorInit(&qrs, sample_frec);
+		t_max = 0;
+		for(uint16_t b=0; b<N_BEATS; b++){
+			for(uint16_t i=0; i<lenght; i++){
+				t_start = esp_timer_get_time();
+				QrsDetectorPush(&qrs, beat_signal[i], beats);
+				t_sample = esp_timer_get_time() - t_start;
+				if(t_sample > t_max){
+					t_max = t_sample;
+				}
+			}
+		}
+		// No beats are reported during the 2 s learning phase
+		expected = N_BEATS - (2 * sample_frec - r_expected + lenght - 1) / lenght;
+		printf("%u\t%s\t%u\t%u\t\t%u\t\t%ld\t\t%u\t\t%.3f\t\t%lu\n", sample_frec, full_scale ? "full" : "ecg",
+			detected, expected, r_errors, max_r_error, heart_rate, (float)t_total / (N_BEATS * lenght), t_max);
+		assert(detected == expected);
+		assert(max_r_error <= R_TOLERANCE);
+	}
+}
+/*==================[end of file]============================================*/